@@ -0,0 +1,497 @@
+#include "AsyncWriter.h"
+#include "LoggerException.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <utility>
+
+/**
+ * @brief The writer thread wakes up at least this often even if it was not notified
+*/
+constexpr auto WRITER_IDLE_TIMEOUT = std::chrono::milliseconds(10);
+/**
+ * @brief The writer thread hands over the processed records at least this often
+*/
+constexpr std::size_t MAX_BATCH_SIZE = 256;
+
+namespace
+{
+	std::atomic<std::uint64_t> s_nextWriterId{ 1 };
+
+	/**
+	 * @brief The PER_THREAD queues of a thread, one for every writer it logged to.
+		The writer drains what is left in the queue of an exited thread and removes it
+	*/
+	thread_local aether_cpplogger::ThreadSlots<aether_cpplogger::ProducerQueue> t_threadQueues;
+}
+
+namespace aether_cpplogger
+{
+	ProducerQueue::ProducerQueue(const std::size_t capacity, const std::thread::id threadId, const bool isSingleProducer) :
+		ThreadId(threadId)
+	{
+		if (isSingleProducer)
+		{
+			ThreadRecords.emplace(capacity);
+		}
+		else
+		{
+			SharedRecords.emplace(capacity);
+		}
+	}
+
+	bool ProducerQueue::takeHead()
+	{
+		if (Head)
+		{
+			return true;
+		}
+
+		if (ThreadRecords)
+		{
+			Head = ThreadRecords->front();
+		}
+		//The record is swapped out of the slot, so the slot and the head storage keep their string capacity
+		else if (SharedRecords->tryPop([this](LogRecord& record) { std::swap(HeadStorage, record); }))
+		{
+			Head = &HeadStorage;
+		}
+		return Head != nullptr;
+	}
+
+	void ProducerQueue::releaseHead()
+	{
+		if (ThreadRecords)
+		{
+			ThreadRecords->pop();
+		}
+		Head = nullptr;
+	}
+
+	AsyncWriter::AsyncWriter(const std::size_t capacity, const OverflowPolicy overflowPolicy, const AsyncQueueMode queueMode, RecordHandler handler,
+		BatchHandler batchHandler, IdleHandler idleHandler) :
+		m_capacity(capacity),
+		m_overflowPolicy(overflowPolicy),
+		m_queueMode(queueMode),
+		m_handler(std::move(handler)),
+		m_batchHandler(std::move(batchHandler)),
+		m_idleHandler(std::move(idleHandler)),
+		m_id(s_nextWriterId.fetch_add(1, std::memory_order_relaxed))
+	{
+		if (m_queueMode == AsyncQueueMode::SHARED)
+		{
+			m_sharedQueue = std::make_shared<ProducerQueue>(m_capacity, std::thread::id(), false);
+			m_queues.push_back(m_sharedQueue);
+			m_queuesVersion.fetch_add(1, std::memory_order_release);
+		}
+
+		m_writerThread = std::thread(&AsyncWriter::run, this);
+	}
+
+	AsyncWriter::~AsyncWriter()
+	{
+		m_isRunning.store(false);
+		wakeUpWriter();
+
+		if (m_writerThread.joinable())
+		{
+			m_writerThread.join();
+		}
+
+		std::lock_guard lock(m_queuesMutex);
+		for (const auto& queue : m_queues)
+		{
+			queue->IsOwnerStopped.store(true, std::memory_order_release);
+		}
+	}
+
+	std::uint64_t AsyncWriter::push(const LogSeverity severity, const std::int64_t timestamp, std::string_view message, const CallSite* site,
+		std::string_view fields, std::string_view source, const int line)
+	{
+		const auto threadId = std::this_thread::get_id();
+		const auto& writeRecord = [&](LogRecord& record)
+		{
+			record.Severity = severity;
+			record.Timestamp = timestamp;
+			record.ThreadId = threadId;
+			record.Site = site;
+			//Assigning keeps the capacity of the slot's string so the steady state does not allocate
+			record.Message.assign(message.data(), message.size());
+			record.Fields.assign(fields.data(), fields.size());
+			record.Source.assign(source.data(), source.size());
+			record.Line = line;
+		};
+
+		std::uint64_t droppedRecords = 0;
+		auto& queue = producerQueue();
+		while (!queue.tryPush(writeRecord))
+		{
+			if (m_overflowPolicy == OverflowPolicy::DROP_NEWEST)
+			{
+				queue.DroppedRecords.fetch_add(1, std::memory_order_relaxed);
+				return 1;
+			}
+			else if (m_overflowPolicy == OverflowPolicy::DROP_OLDEST)
+			{
+				//Discard the oldest queued record to make room for the new one. The queues with DROP_OLDEST have a multi-consumer ring
+				if (queue.tryPop([](LogRecord&) {}))
+				{
+					queue.DroppedRecords.fetch_add(1, std::memory_order_relaxed);
+					queue.CompletedRecords.fetch_add(1, std::memory_order_release);
+					droppedRecords += 1;
+				}
+			}
+			else if (threadId == m_writerThread.get_id())
+			{
+				//A receiver logging on the writer thread would wait for itself, so its log is dropped as with DROP_NEWEST
+				queue.DroppedRecords.fetch_add(1, std::memory_order_relaxed);
+				return 1;
+			}
+			else
+			{
+				//Block the logging thread until the writer makes room
+				wakeUpWriter();
+				std::this_thread::yield();
+			}
+		}
+
+		queue.PushedRecords.fetch_add(1, std::memory_order_relaxed);
+
+		//Pairs with the writer thread setting the sleeping flag before checking the queue
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (m_isWriterSleeping.load(std::memory_order_relaxed))
+		{
+			wakeUpWriter();
+		}
+
+		return droppedRecords;
+	}
+
+	void AsyncWriter::flush()
+	{
+		//A receiver flushing on the writer thread would wait for itself
+		if (std::this_thread::get_id() == m_writerThread.get_id())
+		{
+			return;
+		}
+
+		const auto target = countRecords(&ProducerQueue::PushedRecords, &AsyncWriter::m_removedPushedRecords);
+		m_flushWaiters.fetch_add(1);
+		wakeUpWriter();
+
+		std::unique_lock lock(m_mutex);
+		m_drainedCondition.wait(lock, [this, target]()
+			{
+				return countRecords(&ProducerQueue::CompletedRecords, &AsyncWriter::m_removedCompletedRecords) >= target;
+			});
+		m_flushWaiters.fetch_sub(1);
+	}
+
+	std::uint64_t AsyncWriter::droppedRecords() const
+	{
+		return countRecords(&ProducerQueue::DroppedRecords, &AsyncWriter::m_removedDroppedRecords);
+	}
+
+	std::vector<ThreadDropCount> AsyncWriter::droppedRecordsPerThread() const
+	{
+		std::vector<ThreadDropCount> dropCounts;
+
+		std::lock_guard lock(m_queuesMutex);
+		dropCounts.reserve(m_queues.size());
+		for (const auto& queue : m_queues)
+		{
+			//The queue of an exited thread is left out once every record of it is written, even if it is not yet removed
+			const bool isDrained = !queue->IsOwned.load(std::memory_order_acquire) &&
+				queue->CompletedRecords.load(std::memory_order_acquire) == queue->PushedRecords.load(std::memory_order_relaxed);
+			if (!isDrained)
+			{
+				dropCounts.push_back({ queue->ThreadId, queue->DroppedRecords.load(std::memory_order_relaxed) });
+			}
+		}
+
+		return dropCounts;
+	}
+
+	ProducerQueue& AsyncWriter::producerQueue()
+	{
+		if (m_queueMode == AsyncQueueMode::SHARED)
+		{
+			return *m_sharedQueue;
+		}
+
+		if (auto* queue = t_threadQueues.find(m_id))
+		{
+			return *queue;
+		}
+
+		auto queue = std::make_shared<ProducerQueue>(std::min(m_capacity, MAX_THREAD_QUEUE_CAPACITY), std::this_thread::get_id(),
+			m_overflowPolicy != OverflowPolicy::DROP_OLDEST);
+		{
+			std::lock_guard lock(m_queuesMutex);
+			m_queues.push_back(queue);
+			m_queuesVersion.fetch_add(1, std::memory_order_release);
+		}
+		t_threadQueues.add(m_id, queue);
+
+		return *queue;
+	}
+
+	void AsyncWriter::refreshQueues()
+	{
+		if (m_queuesVersion.load(std::memory_order_acquire) == m_writerQueuesVersion)
+		{
+			return;
+		}
+
+		std::lock_guard lock(m_queuesMutex);
+		m_writerQueues = m_queues;
+		m_writerQueuesVersion = m_queuesVersion.load(std::memory_order_relaxed);
+	}
+
+	void AsyncWriter::removeClosedQueues()
+	{
+		//The owner thread pushed its last record before releasing the queue
+		const auto& isRemovable = [](const std::shared_ptr<ProducerQueue>& queue)
+		{
+			return !queue->IsOwned.load(std::memory_order_acquire) && !queue->Head && queue->empty();
+		};
+		if (std::none_of(m_writerQueues.begin(), m_writerQueues.end(), isRemovable))
+		{
+			return;
+		}
+
+		//The counters of the removed queues are kept for flush() and droppedRecords()
+		std::lock_guard lock(m_queuesMutex);
+		m_queues.erase(std::remove_if(m_queues.begin(), m_queues.end(), [this, &isRemovable](const std::shared_ptr<ProducerQueue>& queue)
+			{
+				if (!isRemovable(queue))
+				{
+					return false;
+				}
+
+				m_removedPushedRecords += queue->PushedRecords.load(std::memory_order_relaxed);
+				m_removedCompletedRecords += queue->CompletedRecords.load(std::memory_order_relaxed);
+				m_removedDroppedRecords += queue->DroppedRecords.load(std::memory_order_relaxed);
+				return true;
+			}), m_queues.end());
+		m_writerQueues = m_queues;
+		m_writerQueuesVersion = m_queuesVersion.load(std::memory_order_relaxed);
+	}
+
+	bool AsyncWriter::hasRecords() const
+	{
+		//A newly registered queue may already hold records
+		if (m_queuesVersion.load(std::memory_order_acquire) != m_writerQueuesVersion)
+		{
+			return true;
+		}
+
+		return std::any_of(m_writerQueues.begin(), m_writerQueues.end(), [](const std::shared_ptr<ProducerQueue>& queue)
+			{
+				return queue->Head || !queue->empty();
+			});
+	}
+
+	std::uint64_t AsyncWriter::countRecords(std::atomic<std::uint64_t> ProducerQueue::* counter, std::uint64_t AsyncWriter::* removedRecords) const
+	{
+		std::lock_guard lock(m_queuesMutex);
+		std::uint64_t count = this->*removedRecords;
+		for (const auto& queue : m_queues)
+		{
+			count += ((*queue).*counter).load(std::memory_order_acquire);
+		}
+
+		return count;
+	}
+
+	void AsyncWriter::run()
+	{
+		while (true)
+		{
+			drain();
+			notifyFlushWaiters();
+
+			if (!m_isRunning.load() && !hasRecords())
+			{
+				break;
+			}
+
+			std::unique_lock lock(m_mutex);
+			m_isWriterSleeping.store(true);
+			m_wakeUpCondition.wait_for(lock, WRITER_IDLE_TIMEOUT, [this]()
+				{
+					return hasRecords() || !m_isRunning.load();
+				});
+			m_isWriterSleeping.store(false);
+		}
+	}
+
+	void AsyncWriter::drain()
+	{
+		const auto& processRecord = [this](LogRecord& record)
+		{
+			try
+			{
+				m_handler(record);
+			}
+			catch (const LoggerException& ex)
+			{
+				//There is no caller to forward the exception to on the writer thread
+				std::cerr << ex.what() << std::endl;
+			}
+		};
+
+		const auto& isLater = [](const ProducerQueue* left, const ProducerQueue* right)
+		{
+			return left->Head->Timestamp > right->Head->Timestamp;
+		};
+
+		const auto& completeRecord = [this](ProducerQueue& queue)
+		{
+			if (queue.UnpublishedRecords++ == 0)
+			{
+				m_batchQueues.push_back(&queue);
+			}
+
+			//The batch size is limited, so a continuously refilled queue does not starve the threads waiting in flush()
+			if (++m_batchSize >= MAX_BATCH_SIZE)
+			{
+				completeBatch();
+			}
+		};
+
+		//A single queue is processed in place, the record keeps its slot until it is handled.
+		//The batch ends with the last available record before its slot is released, so the batch handler holds the slot as well
+		refreshQueues();
+		if (m_writerQueues.size() == 1 && !m_writerQueues.front()->Head)
+		{
+			auto& queue = *m_writerQueues.front();
+			const auto& processQueuedRecord = [&](LogRecord& record)
+			{
+				processRecord(record);
+				completeRecord(queue);
+				if (queue.empty())
+				{
+					completeBatch();
+				}
+			};
+			while (m_queuesVersion.load(std::memory_order_acquire) == m_writerQueuesVersion && queue.tryPop(processQueuedRecord))
+			{
+			}
+		}
+
+		//k-way merge of the queues: the heap holds the queues with a head, ordered by its timestamp.
+		//A round ends when a queue runs empty or a queue is registered, the next round looks at every queue again
+		while (true)
+		{
+			refreshQueues();
+
+			m_mergeHeap.clear();
+			for (const auto& queue : m_writerQueues)
+			{
+				if (queue->takeHead())
+				{
+					m_mergeHeap.push_back(queue.get());
+				}
+			}
+			if (m_mergeHeap.empty())
+			{
+				break;
+			}
+			std::make_heap(m_mergeHeap.begin(), m_mergeHeap.end(), isLater);
+
+			//The queue with the oldest head is processed until a head of another queue is older, so a burst of one thread needs no heap operations
+			bool isRoundEnded = false;
+			while (!isRoundEnded)
+			{
+				std::pop_heap(m_mergeHeap.begin(), m_mergeHeap.end(), isLater);
+				auto& queue = *m_mergeHeap.back();
+				m_mergeHeap.pop_back();
+
+				while (true)
+				{
+					processRecord(*queue.Head);
+					queue.releaseHead();
+					completeRecord(queue);
+
+					if (!queue.takeHead() || m_queuesVersion.load(std::memory_order_acquire) != m_writerQueuesVersion)
+					{
+						isRoundEnded = true;
+						break;
+					}
+					if (!m_mergeHeap.empty() && queue.Head->Timestamp > m_mergeHeap.front()->Head->Timestamp)
+					{
+						m_mergeHeap.push_back(&queue);
+						std::push_heap(m_mergeHeap.begin(), m_mergeHeap.end(), isLater);
+						break;
+					}
+				}
+			}
+		}
+
+		completeBatch();
+		removeClosedQueues();
+
+		if (m_idleHandler)
+		{
+			try
+			{
+				m_idleHandler();
+			}
+			catch (const LoggerException& ex)
+			{
+				std::cerr << ex.what() << std::endl;
+			}
+		}
+	}
+
+	void AsyncWriter::completeBatch()
+	{
+		if (m_batchSize == 0)
+		{
+			return;
+		}
+
+		if (m_batchHandler)
+		{
+			try
+			{
+				m_batchHandler();
+			}
+			catch (const LoggerException& ex)
+			{
+				std::cerr << ex.what() << std::endl;
+			}
+		}
+
+		for (auto* queue : m_batchQueues)
+		{
+			queue->CompletedRecords.fetch_add(queue->UnpublishedRecords, std::memory_order_release);
+			queue->UnpublishedRecords = 0;
+		}
+		m_batchQueues.clear();
+		m_batchSize = 0;
+
+		if (m_flushWaiters.load(std::memory_order_relaxed) > 0)
+		{
+			notifyFlushWaiters();
+		}
+	}
+
+	void AsyncWriter::wakeUpWriter()
+	{
+		{
+			std::lock_guard lock(m_mutex);
+		}
+		m_wakeUpCondition.notify_one();
+	}
+
+	void AsyncWriter::notifyFlushWaiters()
+	{
+		{
+			std::lock_guard lock(m_mutex);
+		}
+		m_drainedCondition.notify_all();
+	}
+}
\ No newline at end of file
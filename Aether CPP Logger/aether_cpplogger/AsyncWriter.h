@@ -0,0 +1,328 @@
+#pragma once
+#include "LogRecord.h"
+#include "OverflowPolicy.h"
+#include "RingBuffer.h"
+#include "SpscRingBuffer.h"
+#include "ThreadSlots.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief Defines how the logging threads hand their logs to the writer thread in async mode
+	*/
+	enum class AsyncQueueMode
+	{
+		/**
+		 * @brief Every thread pushes into one queue of the given capacity
+		*/
+		SHARED,
+		/**
+		 * @brief Every logging thread gets its own queue of the given capacity (at most MAX_THREAD_QUEUE_CAPACITY), the writer merges them by timestamp
+		*/
+		PER_THREAD
+	};
+
+	/**
+	 * @brief The largest capacity of a PER_THREAD queue. Every logging thread allocates its queue on its first log,
+		so the capacity is bounded to keep that allocation small
+	*/
+	constexpr std::size_t MAX_THREAD_QUEUE_CAPACITY = 4096;
+
+	/**
+	 * @brief The number of logs a logging thread lost because its async queue was full
+	*/
+	struct ThreadDropCount
+	{
+		std::thread::id ThreadId;
+		std::uint64_t DroppedRecords = 0;
+	};
+
+	/**
+	 * @brief A queue of the AsyncWriter with its counters.
+	 *
+	 * In PER_THREAD mode only its owner thread pushes into it, so the slots and the counters are not shared with other logging threads.
+	 * Such a queue is a single-producer ring without compare-and-swap, unless the owner discards the oldest records itself (DROP_OLDEST),
+	 * which needs the multi-consumer ring of the shared queue.
+	 * The owner thread releases the queue (IsOwned) when it exits, the writer removes it once it is drained
+	*/
+	struct ProducerQueue : ThreadSlot
+	{
+		/**
+		 * @brief Size of a cache line. The counters of the producer and the writer thread are kept apart
+		*/
+		static constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+		/**
+		 * @brief The ring of the shared queue and of the per-thread queues with DROP_OLDEST
+		*/
+		std::optional<RingBuffer<LogRecord>> SharedRecords;
+		/**
+		 * @brief The ring of the other per-thread queues: the owner thread is its only producer, the writer thread its only consumer
+		*/
+		std::optional<SpscRingBuffer<LogRecord>> ThreadRecords;
+		/**
+		 * @brief The thread pushing into the queue, or the default ID for the shared queue
+		*/
+		const std::thread::id ThreadId;
+
+		/**
+		 * @brief Number of records accepted by the queue
+		*/
+		alignas(CACHE_LINE_SIZE) std::atomic<std::uint64_t> PushedRecords{ 0 };
+		/**
+		 * @brief Number of records lost because of the overflow policy
+		*/
+		std::atomic<std::uint64_t> DroppedRecords{ 0 };
+
+		/**
+		 * @brief Number of accepted records which left the queue (written or discarded as oldest)
+		*/
+		alignas(CACHE_LINE_SIZE) std::atomic<std::uint64_t> CompletedRecords{ 0 };
+		/**
+		 * @brief The oldest record taken by the writer thread which still waits for its turn in the merge, nullptr if there is none. Only the writer thread uses it
+		*/
+		LogRecord* Head = nullptr;
+		/**
+		 * @brief The storage of the head taken from a multi-consumer ring. The head of a single-producer ring is read in its slot,
+			which is only released once the record is written
+		*/
+		LogRecord HeadStorage;
+		/**
+		 * @brief The records handled by the writer thread which are not counted as completed yet, because their batch is not finished
+		*/
+		std::uint64_t UnpublishedRecords = 0;
+
+		/**
+		 * @brief Creates the queue
+		 *
+		 * @param capacity The number of records the queue can hold
+		 * @param threadId The thread pushing into the queue, or the default ID for the shared queue
+		 * @param isSingleProducer Whether the owner thread is the only thread which pushes and the writer thread the only one which pops
+		*/
+		ProducerQueue(const std::size_t capacity, const std::thread::id threadId, const bool isSingleProducer);
+
+		/**
+		 * @brief Fills the next free slot with the given writer
+		 *
+		 * @return True if the record was queued, false if the queue is full
+		*/
+		template<typename Writer>
+		bool tryPush(Writer&& writer)
+		{
+			return ThreadRecords ? ThreadRecords->tryPush(std::forward<Writer>(writer)) : SharedRecords->tryPush(std::forward<Writer>(writer));
+		}
+		/**
+		 * @brief Hands the oldest record to the given reader. Only the writer thread calls it, and the producers of a multi-consumer ring
+		 *
+		 * @return True if a record was read, false if the queue is empty
+		*/
+		template<typename Reader>
+		bool tryPop(Reader&& reader)
+		{
+			return ThreadRecords ? ThreadRecords->tryPop(std::forward<Reader>(reader)) : SharedRecords->tryPop(std::forward<Reader>(reader));
+		}
+		/**
+		 * @brief Sets the head to the oldest record of the queue unless it is already set. Only the writer thread calls it
+		 *
+		 * @return True if the queue has a head
+		*/
+		bool takeHead();
+		/**
+		 * @brief Releases the written head. Only the writer thread calls it
+		*/
+		void releaseHead();
+		/**
+		 * @brief Checks whether every record of the queue is taken by the writer thread. Only the writer thread calls it
+		*/
+		bool empty() const
+		{
+			return ThreadRecords ? ThreadRecords->empty() : SharedRecords->empty();
+		}
+	};
+
+	/**
+	 * @brief Background writer of the Logger's async mode.
+	 *
+	 * Logging threads push records into bounded lock-free RingBuffers, either a shared one or one per thread.
+	 * The per-thread queues are created on the first log of a thread and removed after the thread exits and its queue is drained.
+	 * A single writer thread drains the queues with a k-way merge on the record timestamps and hands each record to the given handler,
+	 * so the records which are queued at the same time are handled in timestamp order
+	*/
+	class AsyncWriter
+	{
+	public:
+		/**
+		 * @brief Callable which processes a drained record on the writer thread
+		*/
+		using RecordHandler = std::function<void(const LogRecord&)>;
+		/**
+		 * @brief Callable which is invoked on the writer thread after a batch of records has been processed
+		*/
+		using BatchHandler = std::function<void()>;
+		/**
+		 * @brief Callable which is invoked on the writer thread whenever the queue has been drained
+		*/
+		using IdleHandler = std::function<void()>;
+
+	private:
+		const std::size_t m_capacity;
+		const OverflowPolicy m_overflowPolicy;
+		const AsyncQueueMode m_queueMode;
+		const RecordHandler m_handler;
+		const BatchHandler m_batchHandler;
+		const IdleHandler m_idleHandler;
+		/**
+		 * @brief Identifies the writer in the thread local queue lists, it is never reused unlike the address
+		*/
+		const std::uint64_t m_id;
+
+		/**
+		 * @brief The queue of every thread in SHARED mode
+		*/
+		std::shared_ptr<ProducerQueue> m_sharedQueue;
+		/**
+		 * @brief The registered queues, guarded by m_queuesMutex
+		*/
+		std::vector<std::shared_ptr<ProducerQueue>> m_queues;
+		/**
+		 * @brief Incremented whenever a queue is registered, so the writer thread only copies the list if it changed
+		*/
+		std::atomic<std::uint64_t> m_queuesVersion{ 0 };
+		/**
+		 * @brief The counters of the removed queues, guarded by m_queuesMutex
+		*/
+		std::uint64_t m_removedPushedRecords = 0;
+		std::uint64_t m_removedCompletedRecords = 0;
+		std::uint64_t m_removedDroppedRecords = 0;
+		mutable std::mutex m_queuesMutex;
+
+		/**
+		 * @brief The copy of the queue list and the merge heap of the writer thread
+		*/
+		std::vector<std::shared_ptr<ProducerQueue>> m_writerQueues;
+		std::uint64_t m_writerQueuesVersion = 0;
+		std::vector<ProducerQueue*> m_mergeHeap;
+		/**
+		 * @brief The queues with unpublished records and the number of records in the current batch. Only the writer thread uses them
+		*/
+		std::vector<ProducerQueue*> m_batchQueues;
+		std::size_t m_batchSize = 0;
+		/**
+		 * @brief Number of threads waiting in flush()
+		*/
+		std::atomic<int> m_flushWaiters{ 0 };
+
+		std::atomic<bool> m_isRunning{ true };
+		std::atomic<bool> m_isWriterSleeping{ false };
+		std::mutex m_mutex;
+		std::condition_variable m_wakeUpCondition;
+		std::condition_variable m_drainedCondition;
+
+		std::thread m_writerThread;
+
+		/**
+		 * @brief The loop of the writer thread
+		*/
+		void run();
+		/**
+		 * @brief Pops and processes every available record in timestamp order
+		*/
+		void drain();
+		/**
+		 * @brief Invokes the batch handler and then counts the records of the batch as completed, so flush() returns only
+			after the batch has been handed over
+		*/
+		void completeBatch();
+		/**
+		 * @brief Returns the queue of the calling thread and registers it on the first call
+		*/
+		ProducerQueue& producerQueue();
+		/**
+		 * @brief Updates the writer thread's copy of the queue list if a queue was registered
+		*/
+		void refreshQueues();
+		/**
+		 * @brief Removes the drained queues of the exited threads
+		*/
+		void removeClosedQueues();
+		/**
+		 * @brief Checks whether any queue of the writer thread's list holds a record
+		*/
+		bool hasRecords() const;
+		/**
+		 * @brief Sums a counter of every queue, including the removed ones
+		*/
+		std::uint64_t countRecords(std::atomic<std::uint64_t> ProducerQueue::* counter, std::uint64_t AsyncWriter::* removedRecords) const;
+		/**
+		 * @brief Wakes up the writer thread if it is waiting for records
+		*/
+		void wakeUpWriter();
+		/**
+		 * @brief Wakes up the threads waiting in flush()
+		*/
+		void notifyFlushWaiters();
+
+	public:
+		/**
+		 * @brief Creates the shared queue in SHARED mode and starts the writer thread
+		 *
+		 * @param capacity The number of records a queue can hold
+		 * @param overflowPolicy The behaviour when a queue is full
+		 * @param queueMode Whether the logging threads share a queue or each of them gets its own
+		 * @param handler The callable which processes the drained records
+		 * @param batchHandler The callable which is invoked after a batch of records has been processed (e.g. to notify receivers)
+		 * @param idleHandler The callable which is invoked whenever the queues have been drained (e.g. for time based flushing)
+		*/
+		AsyncWriter(const std::size_t capacity, const OverflowPolicy overflowPolicy, const AsyncQueueMode queueMode, RecordHandler handler,
+			BatchHandler batchHandler, IdleHandler idleHandler);
+		/**
+		 * @brief Drains the queues and stops the writer thread
+		*/
+		~AsyncWriter();
+
+		AsyncWriter(const AsyncWriter&) = delete;
+		AsyncWriter& operator=(const AsyncWriter&) = delete;
+
+		/**
+		 * @brief Queues a log for the writer thread according to the overflow policy
+		 *
+		 * @param severity The severity of the log
+		 * @param timestamp The creation time of the log in microseconds since the Unix epoch
+		 * @param message The raw message of the log or the encoded arguments of the call site
+		 * @param site The descriptor of the call site if the formatting is deferred to the writer thread, otherwise nullptr
+		 * @param fields The encoded fields of a structured log
+		 * @param source The name of the source file where the log originates
+		 * @param line The line number where the log originates
+		 *
+		 * @return The number of logs discarded by the overflow policy: the new log or the oldest queued ones.
+			A full queue drops the new log of the writer thread itself instead of blocking it
+		*/
+		std::uint64_t push(const LogSeverity severity, const std::int64_t timestamp, std::string_view message, const CallSite* site = nullptr,
+			std::string_view fields = std::string_view(), std::string_view source = std::string_view(), const int line = 0);
+		/**
+		 * @brief Blocks until every record queued before this call has been processed. It returns immediately on the writer thread
+		*/
+		void flush();
+
+		/**
+		 * @brief The number of records lost because of the overflow policy
+		*/
+		std::uint64_t droppedRecords() const;
+		/**
+		 * @brief The number of records each logging thread lost because of the overflow policy.
+			It lists the threads whose queue is in use; the queue of an exited thread is left out once it is drained
+		*/
+		std::vector<ThreadDropCount> droppedRecordsPerThread() const;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,152 @@
+#include "BinaryLogFile.h"
+
+namespace aether_cpplogger
+{
+	void BinaryLogFile::setFlushPolicy(const FlushPolicy& flushPolicy)
+	{
+		m_file.setFlushPolicy(flushPolicy);
+	}
+
+	void BinaryLogFile::setStatsCollector(StatsCollector* statsCollector)
+	{
+		m_file.setStatsCollector(statsCollector);
+	}
+
+	bool BinaryLogFile::open(const std::string& path, const DateTime& dateTime, const int index)
+	{
+		close();
+
+		if (!m_file.open(path, dateTime, index))
+		{
+			return false;
+		}
+
+		m_indexStream.open(path + std::string(binary_log::INDEX_EXTENSION), std::ios::app | std::ios::out | std::ios::binary);
+
+		//An existing file is continued, its call site IDs and timestamp base end with the next checkpoint
+		if (m_file.size() == 0)
+		{
+			m_record.clear();
+			m_record += binary_log::MAGIC;
+			m_record += static_cast<char>(binary_log::VERSION);
+			m_record += static_cast<char>(sizeof(void*));
+			m_file.write(m_record, LogSeverity::INFO);
+		}
+		m_isCheckpointNeeded = true;
+
+		return true;
+	}
+
+	void BinaryLogFile::close()
+	{
+		m_file.close();
+		if (m_indexStream.is_open())
+		{
+			m_indexStream.close();
+		}
+		m_callSiteIds.clear();
+	}
+
+	void BinaryLogFile::checkCheckpoint(const std::int64_t timestamp)
+	{
+		if (!m_isCheckpointNeeded && m_file.size() - m_checkpointOffset < binary_log::CHECKPOINT_INTERVAL)
+		{
+			return;
+		}
+
+		m_isCheckpointNeeded = false;
+		m_checkpointOffset = m_file.size();
+		m_lastTimestamp = timestamp;
+		m_callSiteIds.clear();
+
+		m_record += static_cast<char>(binary_log::RecordType::CHECKPOINT);
+		m_record.append(reinterpret_cast<const char*>(&timestamp), sizeof(timestamp));
+
+		//The index is small, it is written right away so readers can always use it
+		if (m_indexStream.is_open())
+		{
+			const auto offset = static_cast<std::int64_t>(m_checkpointOffset);
+			m_indexStream.write(reinterpret_cast<const char*>(&timestamp), sizeof(timestamp));
+			m_indexStream.write(reinterpret_cast<const char*>(&offset), sizeof(offset));
+			m_indexStream.flush();
+		}
+	}
+
+	void BinaryLogFile::appendRecordPrefix(const binary_log::RecordType recordType, const LogSeverity severity, const std::int64_t timestamp)
+	{
+		m_record += static_cast<char>(recordType);
+		binary_log::appendSignedVarint(m_record, timestamp - m_lastTimestamp);
+		m_record += static_cast<char>(severity);
+		m_lastTimestamp = timestamp;
+	}
+
+	void BinaryLogFile::writeMessage(std::string_view message, const LogSeverity severity, const std::int64_t timestamp)
+	{
+		m_record.clear();
+		checkCheckpoint(timestamp);
+
+		appendRecordPrefix(binary_log::RecordType::MESSAGE, severity, timestamp);
+		binary_log::appendString(m_record, message);
+
+		m_file.write(m_record, severity);
+	}
+
+	void BinaryLogFile::writeFormatted(const CallSite& callSite, std::string_view arguments, const std::int64_t timestamp)
+	{
+		m_record.clear();
+		checkCheckpoint(timestamp);
+
+		const auto [callSiteId, isNewCallSite] = m_callSiteIds.try_emplace(&callSite, m_callSiteIds.size());
+		if (isNewCallSite)
+		{
+			m_record += static_cast<char>(binary_log::RecordType::CALL_SITE);
+			binary_log::appendVarint(m_record, callSiteId->second);
+			m_record += static_cast<char>(callSite.Severity);
+			binary_log::appendVarint(m_record, static_cast<std::uint64_t>(callSite.Line));
+			binary_log::appendString(m_record, callSite.Format);
+			binary_log::appendString(m_record, callSite.Source);
+			binary_log::appendString(m_record, callSite.ArgumentTypes);
+		}
+
+		appendRecordPrefix(binary_log::RecordType::FORMATTED, callSite.Severity, timestamp);
+		binary_log::appendVarint(m_record, callSiteId->second);
+		binary_log::appendString(m_record, arguments);
+
+		m_file.write(m_record, callSite.Severity);
+	}
+
+	void BinaryLogFile::flush()
+	{
+		m_file.flush();
+	}
+
+	void BinaryLogFile::flushIfDue()
+	{
+		m_file.flushIfDue();
+	}
+
+	bool BinaryLogFile::isOpen() const
+	{
+		return m_file.isOpen();
+	}
+
+	bool BinaryLogFile::isSameDate(const DateTime& dateTime) const
+	{
+		return m_file.isSameDate(dateTime);
+	}
+
+	int BinaryLogFile::index() const
+	{
+		return m_file.index();
+	}
+
+	const std::string& BinaryLogFile::path() const
+	{
+		return m_file.path();
+	}
+
+	std::uintmax_t BinaryLogFile::size() const
+	{
+		return m_file.size();
+	}
+}
\ No newline at end of file
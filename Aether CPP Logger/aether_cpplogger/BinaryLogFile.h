@@ -0,0 +1,140 @@
+#pragma once
+#include "BinaryLogFormat.h"
+#include "CallSite.h"
+#include "DateTime.h"
+#include "FlushPolicy.h"
+#include "LogFile.h"
+#include "LogSeverity.h"
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief The currently written binary log file of the BINARY log file mode. See BinaryLogFormat.h for the layout.
+	 *
+	 * Formatted logs are stored as the ID of their call site and their encoded arguments, so no text is formatted while logging.
+	 * Each call site is defined once per checkpoint section. The bytes are buffered and written by a LogFile according to the FlushPolicy
+	*/
+	class BinaryLogFile
+	{
+	private:
+		LogFile m_file;
+		/**
+		 * @brief The index file with the offset and timestamp of each checkpoint
+		*/
+		std::ofstream m_indexStream;
+
+		/**
+		 * @brief The IDs of the call sites defined in the current checkpoint section
+		*/
+		std::unordered_map<const CallSite*, std::uint64_t> m_callSiteIds;
+		/**
+		 * @brief The timestamp of the previous record. The records store their difference to it
+		*/
+		std::int64_t m_lastTimestamp = 0;
+		/**
+		 * @brief The file offset of the last checkpoint
+		*/
+		std::uintmax_t m_checkpointOffset = 0;
+		bool m_isCheckpointNeeded = true;
+		/**
+		 * @brief The bytes of the currently written records. Its capacity is reused
+		*/
+		std::string m_record;
+
+		/**
+		 * @brief Starts a new checkpoint section if this is the first record of the file or the section is long enough
+		 *
+		 * @param timestamp The timestamp of the next record
+		*/
+		void checkCheckpoint(const std::int64_t timestamp);
+		/**
+		 * @brief Appends the timestamp delta and the severity of the next record to the record buffer
+		*/
+		void appendRecordPrefix(const binary_log::RecordType recordType, const LogSeverity severity, const std::int64_t timestamp);
+
+	public:
+		BinaryLogFile() = default;
+
+		BinaryLogFile(const BinaryLogFile&) = delete;
+		BinaryLogFile& operator=(const BinaryLogFile&) = delete;
+
+		/**
+		 * @brief Sets the policy which defines when the buffered records are written to the file
+		 *
+		 * @param flushPolicy The new flush policy
+		*/
+		void setFlushPolicy(const FlushPolicy& flushPolicy);
+		/**
+		 * @brief Sets the collector which measures the latency of the flushes
+		 *
+		 * @param statsCollector The collector of the logger, nullptr measures nothing
+		*/
+		void setStatsCollector(StatsCollector* statsCollector);
+		/**
+		 * @brief Opens the given file and its index file in append mode. The header is written if the file is empty.
+			The previously opened file is closed
+		 *
+		 * @param path The full path of the log file
+		 * @param dateTime The date of the log file
+		 * @param index The index of the file within its date
+		 *
+		 * @return True if the file could be opened
+		*/
+		bool open(const std::string& path, const DateTime& dateTime, const int index);
+		/**
+		 * @brief Writes the buffered records and closes the file if it is open
+		*/
+		void close();
+		/**
+		 * @brief Writes a log with a ready message
+		 *
+		 * @param message The raw message of the log without the prefixes
+		 * @param severity The severity of the log
+		 * @param timestamp The creation time of the log in microseconds since the Unix epoch
+		*/
+		void writeMessage(std::string_view message, const LogSeverity severity, const std::int64_t timestamp);
+		/**
+		 * @brief Writes a formatted log as the ID of its call site and its encoded arguments. The call site is defined first if needed
+		 *
+		 * @param callSite The call site of the log. Its address identifies it, so it must be the static instance of the call site
+		 * @param arguments The arguments encoded by the ArgumentCodec of the call site
+		 * @param timestamp The creation time of the log in microseconds since the Unix epoch
+		*/
+		void writeFormatted(const CallSite& callSite, std::string_view arguments, const std::int64_t timestamp);
+		/**
+		 * @brief Writes the buffered records to the file
+		*/
+		void flush();
+		/**
+		 * @brief Flushes the buffer if the flush interval of the policy has elapsed
+		*/
+		void flushIfDue();
+
+		/**
+		 * @brief Returns whether a file is currently open
+		*/
+		bool isOpen() const;
+		/**
+		 * @brief Checks whether the open file belongs to the date of the given DateTime
+		*/
+		bool isSameDate(const DateTime& dateTime) const;
+		/**
+		 * @brief Returns the index of the open file within its date
+		*/
+		int index() const;
+		/**
+		 * @brief Returns the full path of the open file. It is empty if no file is open
+		*/
+		const std::string& path() const;
+		/**
+		 * @brief Returns the tracked size of the open file in bytes
+		*/
+		std::uintmax_t size() const;
+	};
+}
\ No newline at end of file
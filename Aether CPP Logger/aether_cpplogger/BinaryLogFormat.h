@@ -0,0 +1,94 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief The layout of the binary log files (.logb).
+	 *
+	 * A file starts with the header (MAGIC, VERSION and the pointer size of the writer) and continues with records.
+	 * Every record starts with its RecordType byte. Integers are unsigned LEB128 varints, timestamps are zigzag encoded varint deltas
+	 * to the previous record and strings are a varint length followed by the characters. Fixed size values and the encoded arguments
+	 * are stored in the byte order of the writing machine.
+	 *
+	 * A CHECKPOINT resets the timestamp base and the call site IDs, so decoding can start at any checkpoint.
+	 * The offset and timestamp of each checkpoint are appended to the index file (.logb.idx) as two fixed 8 byte values
+	*/
+	namespace binary_log
+	{
+		/**
+		 * @brief The first bytes of every binary log file
+		*/
+		constexpr std::string_view MAGIC = "AETHLOGB";
+		constexpr std::uint8_t VERSION = 1;
+		/**
+		 * @brief The size of the file header in bytes
+		*/
+		constexpr std::size_t HEADER_SIZE = MAGIC.size() + 2;
+		/**
+		 * @brief A new checkpoint is written when this many bytes have been written since the last one
+		*/
+		constexpr std::uintmax_t CHECKPOINT_INTERVAL = 64 * 1024;
+		/**
+		 * @brief The size of one entry of the index file in bytes
+		*/
+		constexpr std::size_t INDEX_ENTRY_SIZE = 2 * sizeof(std::int64_t);
+		/**
+		 * @brief The extension of the index file which is appended to the name of the log file
+		*/
+		constexpr std::string_view INDEX_EXTENSION = ".idx";
+
+		enum class RecordType : std::uint8_t
+		{
+			/**
+			 * @brief The absolute timestamp (fixed 8 bytes) of the next record. It starts a new decodable section
+			*/
+			CHECKPOINT = 1,
+			/**
+			 * @brief The definition of a call site: ID, severity, line, format, source and argument types
+			*/
+			CALL_SITE = 2,
+			/**
+			 * @brief A formatted log: timestamp delta, severity, call site ID and the encoded arguments
+			*/
+			FORMATTED = 3,
+			/**
+			 * @brief A log with a ready message: timestamp delta, severity and the message
+			*/
+			MESSAGE = 4
+		};
+
+		/**
+		 * @brief Appends the value as an unsigned LEB128 varint
+		*/
+		inline void appendVarint(std::string& destination, std::uint64_t value)
+		{
+			while (value >= 0x80)
+			{
+				destination += static_cast<char>((value & 0x7F) | 0x80);
+				value >>= 7;
+			}
+			destination += static_cast<char>(value);
+		}
+
+		/**
+		 * @brief Appends the signed value as a zigzag encoded varint, so small negative values stay short
+		*/
+		inline void appendSignedVarint(std::string& destination, const std::int64_t value)
+		{
+			appendVarint(destination, (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63));
+		}
+
+		/**
+		 * @brief Appends the string as its varint length followed by its characters
+		*/
+		inline void appendString(std::string& destination, std::string_view value)
+		{
+			appendVarint(destination, value.size());
+			destination += value;
+		}
+	}
+}
\ No newline at end of file
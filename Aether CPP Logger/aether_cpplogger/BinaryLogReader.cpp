@@ -0,0 +1,323 @@
+#include "BinaryLogReader.h"
+#include "BinaryLogFormat.h"
+#include "LoggerException.h"
+#include "LoggerInstance.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+
+namespace
+{
+	/**
+	 * @brief Reads an encoded argument of the given type. Throws LoggerException if the arguments end before it
+	*/
+	template<typename T>
+	T readArgument(const char*& arguments, const char* end)
+	{
+		if (static_cast<std::size_t>(end - arguments) < sizeof(T))
+		{
+			throw aether_cpplogger::LoggerException("Binary log file is corrupted: truncated arguments");
+		}
+
+		T value;
+		std::memcpy(&value, arguments, sizeof(T));
+		arguments += sizeof(T);
+
+		return value;
+	}
+
+	/**
+	 * @brief Reads an unsigned value of the writer's pointer size (pointers and string lengths)
+	*/
+	std::uint64_t readPointerSized(const char*& arguments, const char* end, const std::size_t pointerSize)
+	{
+		return pointerSize == sizeof(std::uint32_t) ? readArgument<std::uint32_t>(arguments, end) : readArgument<std::uint64_t>(arguments, end);
+	}
+}
+
+namespace aether_cpplogger
+{
+	BinaryLogReader::BinaryLogReader(const std::string& path) :
+		m_path(path)
+	{
+		m_stream.open(path, std::ios::in | std::ios::binary);
+		if (!m_stream.is_open())
+		{
+			throw LoggerException("Binary log file could not be opened: " + path);
+		}
+
+		char header[binary_log::HEADER_SIZE];
+		if (!m_stream.read(header, sizeof(header)) ||
+			std::string_view(header, binary_log::MAGIC.size()) != binary_log::MAGIC ||
+			static_cast<std::uint8_t>(header[binary_log::MAGIC.size()]) != binary_log::VERSION)
+		{
+			throw LoggerException("Not a binary log file or unsupported version: " + path);
+		}
+
+		m_pointerSize = static_cast<std::uint8_t>(header[binary_log::MAGIC.size() + 1]);
+		if (m_pointerSize != sizeof(std::uint32_t) && m_pointerSize != sizeof(std::uint64_t))
+		{
+			throw LoggerException("Binary log file is corrupted: invalid pointer size");
+		}
+	}
+
+	bool BinaryLogReader::seek(const std::int64_t timestamp)
+	{
+		m_fromTimestamp = timestamp;
+		m_callSites.clear();
+		m_stream.clear();
+
+		//Each index entry is the timestamp and the offset of a checkpoint
+		std::vector<std::pair<std::int64_t, std::int64_t>> checkpoints;
+		std::ifstream indexStream(m_path + std::string(binary_log::INDEX_EXTENSION), std::ios::in | std::ios::binary);
+		std::pair<std::int64_t, std::int64_t> checkpoint;
+		while (indexStream.read(reinterpret_cast<char*>(&checkpoint.first), sizeof(checkpoint.first)) &&
+			indexStream.read(reinterpret_cast<char*>(&checkpoint.second), sizeof(checkpoint.second)))
+		{
+			checkpoints.push_back(checkpoint);
+		}
+
+		if (checkpoints.empty())
+		{
+			m_stream.seekg(binary_log::HEADER_SIZE);
+			return false;
+		}
+
+		//Start at the last checkpoint which is not later than the requested time
+		auto found = std::upper_bound(checkpoints.begin(), checkpoints.end(), timestamp,
+			[](const std::int64_t value, const std::pair<std::int64_t, std::int64_t>& entry) { return value < entry.first; });
+		if (found != checkpoints.begin())
+		{
+			--found;
+		}
+
+		m_stream.seekg(found->second);
+		return true;
+	}
+
+	bool BinaryLogReader::next(BinaryLogEntry& entry)
+	{
+		std::uint8_t recordType;
+		while (readByte(recordType))
+		{
+			switch (static_cast<binary_log::RecordType>(recordType))
+			{
+			case binary_log::RecordType::CHECKPOINT:
+			{
+				std::int64_t timestamp;
+				if (!m_stream.read(reinterpret_cast<char*>(&timestamp), sizeof(timestamp)))
+				{
+					return false;
+				}
+				m_lastTimestamp = timestamp;
+				m_callSites.clear();
+				break;
+			}
+			case binary_log::RecordType::CALL_SITE:
+			{
+				std::uint64_t id;
+				std::uint8_t severity;
+				std::uint64_t line;
+				CallSiteDefinition callSite;
+				if (!readVarint(id) || !readByte(severity) || !readVarint(line) ||
+					!readString(callSite.Format) || !readString(callSite.Source) || !readString(callSite.ArgumentTypes))
+				{
+					return false;
+				}
+				if (id != m_callSites.size())
+				{
+					throw LoggerException("Binary log file is corrupted: unexpected call site ID");
+				}
+
+				callSite.Severity = static_cast<LogSeverity>(severity);
+				callSite.Line = static_cast<int>(line);
+				m_callSites.push_back(std::move(callSite));
+				break;
+			}
+			case binary_log::RecordType::FORMATTED:
+			{
+				std::uint64_t id;
+				if (!readRecordPrefix(entry) || !readVarint(id) || !readString(m_arguments))
+				{
+					return false;
+				}
+				if (id >= m_callSites.size())
+				{
+					throw LoggerException("Binary log file is corrupted: undefined call site");
+				}
+
+				if (entry.Timestamp >= m_fromTimestamp)
+				{
+					entry.Message.clear();
+					formatArguments(entry.Message, m_callSites[id]);
+					return true;
+				}
+				break;
+			}
+			case binary_log::RecordType::MESSAGE:
+			{
+				if (!readRecordPrefix(entry) || !readString(entry.Message))
+				{
+					return false;
+				}
+
+				if (entry.Timestamp >= m_fromTimestamp)
+				{
+					return true;
+				}
+				break;
+			}
+			default:
+				throw LoggerException("Binary log file is corrupted: unknown record type");
+			}
+		}
+
+		return false;
+	}
+
+	void BinaryLogReader::formatLine(std::string& line, const BinaryLogEntry& entry, const TimestampPrecision precision)
+	{
+		m_timestampCache.update(entry.Timestamp);
+
+		line += severityPrefix(entry.Severity);
+		line += m_timestampCache.timeString(precision);
+		line += "\t\t";
+		line += entry.Message;
+	}
+
+	bool BinaryLogReader::readByte(std::uint8_t& value)
+	{
+		const auto character = m_stream.get();
+		if (character == std::ifstream::traits_type::eof())
+		{
+			return false;
+		}
+
+		value = static_cast<std::uint8_t>(character);
+		return true;
+	}
+
+	bool BinaryLogReader::readVarint(std::uint64_t& value)
+	{
+		value = 0;
+		for (int shift = 0; shift < 64; shift += 7)
+		{
+			std::uint8_t byte;
+			if (!readByte(byte))
+			{
+				return false;
+			}
+
+			value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+			if ((byte & 0x80) == 0)
+			{
+				return true;
+			}
+		}
+
+		throw LoggerException("Binary log file is corrupted: invalid varint");
+	}
+
+	bool BinaryLogReader::readSignedVarint(std::int64_t& value)
+	{
+		std::uint64_t encoded;
+		if (!readVarint(encoded))
+		{
+			return false;
+		}
+
+		value = static_cast<std::int64_t>(encoded >> 1) ^ -static_cast<std::int64_t>(encoded & 1);
+		return true;
+	}
+
+	bool BinaryLogReader::readString(std::string& value)
+	{
+		std::uint64_t length;
+		if (!readVarint(length))
+		{
+			return false;
+		}
+
+		value.resize(static_cast<std::size_t>(length));
+		return length == 0 || static_cast<bool>(m_stream.read(&value[0], static_cast<std::streamsize>(length)));
+	}
+
+	bool BinaryLogReader::readRecordPrefix(BinaryLogEntry& entry)
+	{
+		std::int64_t delta;
+		std::uint8_t severity;
+		if (!readSignedVarint(delta) || !readByte(severity))
+		{
+			return false;
+		}
+
+		m_lastTimestamp += delta;
+		entry.Timestamp = m_lastTimestamp;
+		entry.Severity = static_cast<LogSeverity>(severity);
+		return true;
+	}
+
+	void BinaryLogReader::formatArguments(std::string& message, const CallSiteDefinition& callSite) const
+	{
+		std::string_view format = callSite.Format;
+		const char* arguments = m_arguments.data();
+		const char* end = arguments + m_arguments.size();
+
+		for (const char type : callSite.ArgumentTypes)
+		{
+			const bool hasPlaceholder = appendFormatLiteral(message, format);
+			const auto& appendArgument = [&](const auto value)
+			{
+				if (hasPlaceholder)
+				{
+					appendFormatArgument(message, value);
+				}
+			};
+
+			switch (type)
+			{
+			case 's':
+			{
+				const auto length = readPointerSized(arguments, end, m_pointerSize);
+				if (static_cast<std::uint64_t>(end - arguments) < length)
+				{
+					throw LoggerException("Binary log file is corrupted: truncated arguments");
+				}
+				appendArgument(std::string_view(arguments, static_cast<std::size_t>(length)));
+				arguments += length;
+				break;
+			}
+			case 'P':
+			{
+				//The pointer may be wider than the pointers of the reader, so it is formatted as a number
+				char buffer[2 + 2 * sizeof(std::uint64_t)] = { '0', 'x' };
+				const auto result = std::to_chars(buffer + 2, buffer + sizeof(buffer), readPointerSized(arguments, end, m_pointerSize), 16);
+				appendArgument(std::string_view(buffer, static_cast<std::size_t>(result.ptr - buffer)));
+				break;
+			}
+			case '?': appendArgument(readArgument<bool>(arguments, end)); break;
+			case 'c': appendArgument(readArgument<char>(arguments, end)); break;
+			case 'b': appendArgument(readArgument<std::int8_t>(arguments, end)); break;
+			case 'B': appendArgument(readArgument<std::uint8_t>(arguments, end)); break;
+			case 'h': appendArgument(readArgument<std::int16_t>(arguments, end)); break;
+			case 'H': appendArgument(readArgument<std::uint16_t>(arguments, end)); break;
+			case 'i': appendArgument(readArgument<std::int32_t>(arguments, end)); break;
+			case 'I': appendArgument(readArgument<std::uint32_t>(arguments, end)); break;
+			case 'q': appendArgument(readArgument<std::int64_t>(arguments, end)); break;
+			case 'Q': appendArgument(readArgument<std::uint64_t>(arguments, end)); break;
+			case 'f': appendArgument(readArgument<float>(arguments, end)); break;
+			case 'd': appendArgument(readArgument<double>(arguments, end)); break;
+			case 'g': appendArgument(readArgument<long double>(arguments, end)); break;
+			default:
+				throw LoggerException("Binary log file is corrupted: unknown argument type");
+			}
+		}
+		appendFormatLiteral(message, format);
+
+		if (!callSite.Source.empty())
+		{
+			LoggerInstance::appendSourceDetails(message, callSite.Source, callSite.Line);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,151 @@
+#pragma once
+#include "DateTime.h"
+#include "Export.h"
+#include "LogSeverity.h"
+#include "TimestampCache.h"
+
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief A log decoded from a binary log file
+	*/
+	struct BinaryLogEntry
+	{
+		/**
+		 * @brief The creation time of the log in microseconds since the Unix epoch
+		*/
+		std::int64_t Timestamp = 0;
+		LogSeverity Severity = LogSeverity::INFO;
+		/**
+		 * @brief The formatted message with the source details but without the prefixes
+		*/
+		std::string Message;
+	};
+
+	/**
+	 * @brief Decodes the binary log files written in the BINARY log file mode back into logs.
+	 *
+	 * The records are read sequentially, seek() uses the index file to jump close to a given time without decoding the preceding records.
+	 * The arguments are decoded by the type tags of their call site, so the reader does not need the code which wrote the file.
+	 * A file is expected to be read on a machine with the byte order of the writer
+	*/
+	class AETHER_CPPLOGGER_API BinaryLogReader
+	{
+	private:
+		/**
+		 * @brief A call site defined in the current checkpoint section
+		*/
+		struct CallSiteDefinition
+		{
+			LogSeverity Severity;
+			int Line;
+			std::string Format;
+			std::string Source;
+			std::string ArgumentTypes;
+		};
+
+		const std::string m_path;
+		std::ifstream m_stream;
+		/**
+		 * @brief The pointer size of the writer. Pointers and string lengths are stored with this size
+		*/
+		std::size_t m_pointerSize = sizeof(void*);
+
+		/**
+		 * @brief The call sites of the current checkpoint section indexed by their ID
+		*/
+		std::vector<CallSiteDefinition> m_callSites;
+		std::int64_t m_lastTimestamp = 0;
+		/**
+		 * @brief Logs older than this are skipped. It is set by seek()
+		*/
+		std::int64_t m_fromTimestamp = std::numeric_limits<std::int64_t>::min();
+		/**
+		 * @brief The encoded arguments of the current record. Its capacity is reused
+		*/
+		std::string m_arguments;
+
+		TimestampCache m_timestampCache;
+
+		/**
+		 * @brief Reads a single byte
+		 *
+		 * @return False at the end of the file
+		*/
+		bool readByte(std::uint8_t& value);
+		/**
+		 * @brief Reads an unsigned LEB128 varint
+		 *
+		 * @return False at the end of the file
+		*/
+		bool readVarint(std::uint64_t& value);
+		/**
+		 * @brief Reads a zigzag encoded varint
+		 *
+		 * @return False at the end of the file
+		*/
+		bool readSignedVarint(std::int64_t& value);
+		/**
+		 * @brief Reads a varint length followed by the characters
+		 *
+		 * @return False at the end of the file
+		*/
+		bool readString(std::string& value);
+		/**
+		 * @brief Reads the timestamp delta and the severity of a log record and updates the timestamp base
+		 *
+		 * @return False at the end of the file
+		*/
+		bool readRecordPrefix(BinaryLogEntry& entry);
+		/**
+		 * @brief Formats the encoded arguments of the current record with the format of the given call site
+		 *
+		 * @param message The string to be appended
+		 * @param callSite The call site of the record
+		*/
+		void formatArguments(std::string& message, const CallSiteDefinition& callSite) const;
+
+	public:
+		/**
+		 * @brief Opens the given binary log file and checks its header. Throws LoggerException if the file is not a binary log file
+		 *
+		 * @param path The path of the binary log file. Its index file is expected next to it
+		*/
+		explicit BinaryLogReader(const std::string& path);
+
+		BinaryLogReader(const BinaryLogReader&) = delete;
+		BinaryLogReader& operator=(const BinaryLogReader&) = delete;
+
+		/**
+		 * @brief Moves to the first log created at or after the given time. The index file is used to skip the earlier checkpoint sections.
+			Without an index file the reading starts over and the earlier logs are skipped while reading
+		 *
+		 * @param timestamp Microseconds since the Unix epoch
+		 *
+		 * @return True if the index file was used
+		*/
+		bool seek(const std::int64_t timestamp);
+		/**
+		 * @brief Decodes the next log. Throws LoggerException if the file is corrupted
+		 *
+		 * @param entry The decoded log
+		 *
+		 * @return False at the end of the file. A record cut off by the end of the file is treated as the end
+		*/
+		bool next(BinaryLogEntry& entry);
+		/**
+		 * @brief Formats the log as a line of the text log files e.g.: [INFO]		21:02:08		Message
+		 *
+		 * @param line The string to be appended
+		 * @param entry The log to be formatted
+		 * @param precision The fractional second digits of the time
+		*/
+		void formatLine(std::string& line, const BinaryLogEntry& entry, const TimestampPrecision precision);
+	};
+}
\ No newline at end of file
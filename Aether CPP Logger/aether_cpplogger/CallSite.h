@@ -0,0 +1,49 @@
+#pragma once
+#include "LogSeverity.h"
+
+#include <string>
+#include <string_view>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief Formats encoded arguments according to the format
+	 *
+	 * @param destination The string to be appended
+	 * @param format The format with a {} placeholder for each argument
+	 * @param arguments The arguments encoded by the ArgumentCodec of the call site
+	*/
+	using DecodeFunction = void (*)(std::string& destination, std::string_view format, const char* arguments);
+
+	/**
+	 * @brief The compile time descriptor of a formatted log call. The AETHER_LOG_* macros create one static instance for each call site,
+		so a deferred log only has to carry a pointer to it next to the encoded arguments
+	*/
+	struct CallSite
+	{
+		/**
+		 * @brief The severity of the logs made at this call site
+		*/
+		LogSeverity Severity;
+		/**
+		 * @brief The format of the logs. It points to a string literal
+		*/
+		std::string_view Format;
+		/**
+		 * @brief The name of the source file of the call site. Empty if no source details are logged (INFO, WARNING and ERROR severity)
+		*/
+		std::string_view Source;
+		/**
+		 * @brief The line number of the call site
+		*/
+		int Line;
+		/**
+		 * @brief Formats the arguments encoded at this call site
+		*/
+		DecodeFunction Decode;
+		/**
+		 * @brief The type tags of the encoded arguments (see argumentType()). The binary log files store them instead of the Decode function
+		*/
+		std::string_view ArgumentTypes;
+	};
+}
\ No newline at end of file
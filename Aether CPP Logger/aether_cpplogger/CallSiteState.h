@@ -0,0 +1,87 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief The runtime state of a call site: its token bucket and its sample counter.
+		The AETHER_LOG_* macros create one static instance for each call site, so the state is found without a lookup.
+	 *
+	 * The bucket is kept as a single theoretical arrival time (generic cell rate algorithm): each log moves it forward by the interval,
+	 * a log is allowed while the arrival time is at most a burst ahead of the current time. It is updated with a compare and swap
+	*/
+	class CallSiteState
+	{
+	private:
+		std::atomic<std::int64_t> m_theoreticalArrival{ 0 };
+		/**
+		 * @brief Number of logs skipped by the rate limit since the last allowed log
+		*/
+		std::atomic<std::uint64_t> m_suppressedRecords{ 0 };
+		/**
+		 * @brief Number of logs of the call site which reached the interval sampling
+		*/
+		std::atomic<std::uint64_t> m_sampleCount{ 0 };
+
+	public:
+		constexpr CallSiteState() = default;
+
+		CallSiteState(const CallSiteState&) = delete;
+		CallSiteState& operator=(const CallSiteState&) = delete;
+
+		/**
+		 * @brief Counts a log for the interval sampling
+		 *
+		 * @param interval Every interval-th log of the call site is kept, starting with the first one
+		 *
+		 * @return True if the log is kept
+		*/
+		bool isSampled(const std::uint32_t interval)
+		{
+			return m_sampleCount.fetch_add(1, std::memory_order_relaxed) % interval == 0;
+		}
+
+		/**
+		 * @brief Takes a token from the bucket
+		 *
+		 * @param now The current time in microseconds
+		 * @param interval The time in microseconds in which a token is refilled
+		 * @param burst The number of tokens the bucket holds
+		 *
+		 * @return True if the log is allowed
+		*/
+		bool tryAcquire(const std::int64_t now, const std::int64_t interval, const std::int64_t burst)
+		{
+			auto arrival = m_theoreticalArrival.load(std::memory_order_relaxed);
+			while (true)
+			{
+				const auto nextArrival = std::max(arrival, now) + interval;
+				if (nextArrival - now > burst * interval)
+				{
+					m_suppressedRecords.fetch_add(1, std::memory_order_relaxed);
+					return false;
+				}
+
+				if (m_theoreticalArrival.compare_exchange_weak(arrival, nextArrival, std::memory_order_relaxed))
+				{
+					return true;
+				}
+			}
+		}
+
+		/**
+		 * @brief Returns the number of logs skipped since the last call and resets it
+		*/
+		std::uint64_t takeSuppressedRecords()
+		{
+			//Most calls find nothing, so the counter is only written if it changed
+			if (m_suppressedRecords.load(std::memory_order_relaxed) == 0)
+			{
+				return 0;
+			}
+			return m_suppressedRecords.exchange(0, std::memory_order_relaxed);
+		}
+	};
+}
\ No newline at end of file
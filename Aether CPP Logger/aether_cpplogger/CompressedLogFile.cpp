@@ -0,0 +1,126 @@
+#include "CompressedLogFile.h"
+#include "LogFile.h"
+#include "StatsCollector.h"
+
+namespace aether_cpplogger
+{
+	CompressedLogFile::~CompressedLogFile()
+	{
+		close();
+	}
+
+	void CompressedLogFile::setCompressionPolicy(const CompressionPolicy& policy)
+	{
+		m_policy = policy;
+	}
+
+	void CompressedLogFile::setStatsCollector(StatsCollector* statsCollector)
+	{
+		m_statsCollector = statsCollector;
+	}
+
+	bool CompressedLogFile::open(const std::string& path, const DateTime& dateTime, const int index)
+	{
+		close();
+
+		if (!m_writer.open(path, m_policy.Level))
+		{
+			return false;
+		}
+
+		m_year = dateTime.Year;
+		m_month = dateTime.Month;
+		m_day = dateTime.Day;
+		m_index = index;
+		m_path = path;
+
+		return true;
+	}
+
+	void CompressedLogFile::close()
+	{
+		if (m_writer.isOpen())
+		{
+			m_writer.close();
+		}
+		m_year = 0;
+		m_month = 0;
+		m_day = 0;
+		m_index = 1;
+		m_size = 0;
+		m_frameSize = 0;
+		m_path.clear();
+	}
+
+	void CompressedLogFile::writeLine(std::string_view message)
+	{
+		if (m_frameSize == 0)
+		{
+			m_frameStart = std::chrono::steady_clock::now();
+		}
+
+		m_writer.write(message);
+		m_writer.write(LINE_ENDING);
+
+		const std::size_t lineSize = message.size() + LINE_ENDING.size();
+		m_size += lineSize;
+		m_frameSize += lineSize;
+
+		if (m_frameSize >= m_policy.FrameSize || isFrameIntervalElapsed())
+		{
+			flush();
+		}
+	}
+
+	void CompressedLogFile::flush()
+	{
+		if (m_frameSize > 0 && m_writer.isOpen())
+		{
+			LatencyTimer timer(m_statsCollector, LatencyKind::FLUSH);
+			m_writer.sync();
+		}
+		m_frameSize = 0;
+	}
+
+	void CompressedLogFile::flushIfDue()
+	{
+		if (m_frameSize > 0 && isFrameIntervalElapsed())
+		{
+			flush();
+		}
+	}
+
+	bool CompressedLogFile::isFrameIntervalElapsed() const
+	{
+		return m_policy.FrameInterval.count() > 0 &&
+			std::chrono::steady_clock::now() - m_frameStart >= m_policy.FrameInterval;
+	}
+
+	bool CompressedLogFile::isOpen() const
+	{
+		return m_writer.isOpen();
+	}
+
+	bool CompressedLogFile::isSameDate(const DateTime& dateTime) const
+	{
+		return m_writer.isOpen() &&
+			m_day == dateTime.Day &&
+			m_month == dateTime.Month &&
+			m_year == dateTime.Year;
+	}
+
+	int CompressedLogFile::index() const
+	{
+		return m_index;
+	}
+
+	const std::string& CompressedLogFile::path() const
+	{
+		return m_path;
+	}
+
+	std::uintmax_t CompressedLogFile::size() const
+	{
+		return m_size;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,141 @@
+#pragma once
+#include "CompressionPolicy.h"
+#include "DateTime.h"
+#include "GzipWriter.h"
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace aether_cpplogger
+{
+	class StatsCollector;
+
+	/**
+	 * @brief The currently written log file of the COMPRESSED log file mode.
+	 *
+	 * The lines are compressed while they are written into <name>.log.gz. The file is a series of gzip members (frames),
+	 * a frame is ended after FrameSize bytes or FrameInterval according to the CompressionPolicy. Every completed frame
+	 * can be decompressed by gzip tools, so a crash loses at most the unfinished frame and a reader can follow the file.
+	 * The tracked size is the uncompressed size, so the size limit of the Logger keeps its meaning
+	*/
+	class CompressedLogFile
+	{
+	private:
+		GzipWriter m_writer;
+		/**
+		 * @brief The full path of the open file
+		*/
+		std::string m_path;
+		/**
+		 * @brief The date of the file. A new file is needed when the date of the log differs
+		*/
+		int m_year = 0;
+		int m_month = 0;
+		int m_day = 0;
+		/**
+		 * @brief The index of the file within its date
+		*/
+		int m_index = 1;
+		/**
+		 * @brief The uncompressed size of the file in bytes
+		*/
+		std::uintmax_t m_size = 0;
+
+		CompressionPolicy m_policy;
+		/**
+		 * @brief The uncompressed bytes of the unfinished frame
+		*/
+		std::size_t m_frameSize = 0;
+		/**
+		 * @brief The time of the first line of the unfinished frame
+		*/
+		std::chrono::steady_clock::time_point m_frameStart;
+		/**
+		 * @brief The collector which measures the frame ends, nullptr if they are not measured
+		*/
+		StatsCollector* m_statsCollector = nullptr;
+
+		/**
+		 * @brief Checks whether the frame interval of the policy has elapsed for the unfinished frame
+		*/
+		bool isFrameIntervalElapsed() const;
+
+	public:
+		CompressedLogFile() = default;
+		/**
+		 * @brief Ends the unfinished frame and closes the file
+		*/
+		~CompressedLogFile();
+
+		CompressedLogFile(const CompressedLogFile&) = delete;
+		CompressedLogFile& operator=(const CompressedLogFile&) = delete;
+
+		/**
+		 * @brief Sets the compression level and the frame settings. The level applies from the next opened file
+		 *
+		 * @param policy The new compression policy
+		*/
+		void setCompressionPolicy(const CompressionPolicy& policy);
+		/**
+		 * @brief Sets the collector which measures the latency of the frame ends as flushes
+		 *
+		 * @param statsCollector The collector of the logger, nullptr measures nothing
+		*/
+		void setStatsCollector(StatsCollector* statsCollector);
+		/**
+		 * @brief Creates the given file. The previously opened file is closed
+		 *
+		 * @param path The full path of the compressed log file. An existing file is overwritten
+		 * @param dateTime The date of the log file
+		 * @param index The index of the file within its date
+		 *
+		 * @return True if the file could be created
+		*/
+		bool open(const std::string& path, const DateTime& dateTime, const int index);
+		/**
+		 * @brief Ends the unfinished frame and closes the file if it is open
+		*/
+		void close();
+		/**
+		 * @brief Compresses the message as a new line and ends the frame if the policy requires
+		 *
+		 * @param message The message to be written
+		*/
+		void writeLine(std::string_view message);
+		/**
+		 * @brief Ends the unfinished frame, so every written line can be read from the file
+		*/
+		void flush();
+		/**
+		 * @brief Ends the unfinished frame if the frame interval of the policy has elapsed
+		*/
+		void flushIfDue();
+
+		/**
+		 * @brief Returns whether a file is currently open
+		*/
+		bool isOpen() const;
+		/**
+		 * @brief Checks whether the open file belongs to the date of the given DateTime
+		 *
+		 * @param dateTime The DateTime to be compared
+		 *
+		 * @return True if a file is open and its date matches
+		*/
+		bool isSameDate(const DateTime& dateTime) const;
+		/**
+		 * @brief Returns the index of the open file within its date
+		*/
+		int index() const;
+		/**
+		 * @brief Returns the full path of the open file. It is empty if no file is open
+		*/
+		const std::string& path() const;
+		/**
+		 * @brief Returns the uncompressed size of the open file in bytes
+		*/
+		std::uintmax_t size() const;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,41 @@
+#pragma once
+#include <chrono>
+#include <cstddef>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief Defines whether and how the completed text log files are compressed.
+		A log file is completed when the Logger moves on to the next file because of the size limit or the date.
+		The completed files are compressed to <name>.log.gz by background threads and the originals are removed.
+		The level and the frame settings apply to the active log file of the COMPRESSED log file mode as well
+	*/
+	struct CompressionPolicy
+	{
+		/**
+		 * @brief Compress the completed log files
+		*/
+		bool IsEnabled = false;
+		/**
+		 * @brief The compression level from 0 (fastest) to 9 (smallest)
+		*/
+		int Level = 6;
+		/**
+		 * @brief The number of background threads compressing the files
+		*/
+		std::size_t WorkerCount = 1;
+		/**
+		 * @brief Run the background threads with the lowest CPU and I/O priority, so they do not compete with the application
+		*/
+		bool IsLowPriority = true;
+		/**
+		 * @brief COMPRESSED mode: end the current frame when at least this many uncompressed bytes were written to it.
+			A crash loses at most the logs of the unfinished frame. 0 ends a frame after every log
+		*/
+		std::size_t FrameSize = 64 * 1024;
+		/**
+		 * @brief COMPRESSED mode: end the current frame when its first log is older than this interval. 0 disables the interval
+		*/
+		std::chrono::milliseconds FrameInterval = std::chrono::milliseconds(1000);
+	};
+}
\ No newline at end of file
@@ -0,0 +1,114 @@
+#pragma once
+#include <string>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief Defines the fractional second digits of the log time prefix
+	*/
+	enum class TimestampPrecision
+	{
+		SECONDS,
+		MILLISECONDS,
+		MICROSECONDS
+	};
+
+	/**
+	 * @brief Writes the given non-negative value as zero-padded decimal digits
+	 *
+	 * @param destination The first character to be written
+	 * @param value The value to be written
+	 * @param width The number of digits to be written
+	*/
+	inline void writePaddedDigits(char* destination, int value, const int width)
+	{
+		for (int i = width - 1; i >= 0; --i)
+		{
+			destination[i] = static_cast<char>('0' + value % 10);
+			value /= 10;
+		}
+	}
+
+	/**
+	 * @brief A structure to handle date and time data
+	*/
+	struct DateTime
+	{
+		/**
+		 * @brief The year this DateTime reflects
+		*/
+		int Year;
+		/**
+		 * @brief The month this DateTime reflects
+		*/
+		int Month;
+		/**
+		 * @brief The day this DateTime reflects
+		*/
+		int Day;
+		/**
+		 * @brief The hours this DateTime reflects
+		*/
+		int Hours;
+		/**
+		 * @brief The minutes this DateTime reflects
+		*/
+		int Minutes;
+		/**
+		 * @brief The seconds this DateTime reflects
+		*/
+		int Seconds;
+		/**
+		 * @brief The microseconds within the second this DateTime reflects
+		*/
+		int Microseconds = 0;
+
+		/**
+		 * @brief Formats the date related variables into a string
+		 * @return The formatted date related variables as a string e.: 1900-10-03
+		*/
+		std::string currentDateString() const
+		{
+			std::string dateString = "0000-00-00";
+			writePaddedDigits(&dateString[0], Year, 4);
+			writePaddedDigits(&dateString[5], Month, 2);
+			writePaddedDigits(&dateString[8], Day, 2);
+
+			return dateString;
+		}
+
+		/**
+		 * @brief Formats the time related variables into a string
+		 * @return The formatted time related variables as a string e.: 21:02:08
+		*/
+		std::string currentTimeString() const
+		{
+			return currentTimeString(TimestampPrecision::SECONDS);
+		}
+
+		/**
+		 * @brief Formats the time related variables into a string with the given fractional second digits
+		 * @return The formatted time related variables as a string e.: 21:02:08.042 with millisecond precision
+		*/
+		std::string currentTimeString(const TimestampPrecision precision) const
+		{
+			std::string timeString = "00:00:00";
+			writePaddedDigits(&timeString[0], Hours, 2);
+			writePaddedDigits(&timeString[3], Minutes, 2);
+			writePaddedDigits(&timeString[6], Seconds, 2);
+
+			if (precision == TimestampPrecision::MILLISECONDS)
+			{
+				timeString += ".000";
+				writePaddedDigits(&timeString[9], Microseconds / 1000, 3);
+			}
+			else if (precision == TimestampPrecision::MICROSECONDS)
+			{
+				timeString += ".000000";
+				writePaddedDigits(&timeString[9], Microseconds, 6);
+			}
+
+			return timeString;
+		}
+	};
+}
\ No newline at end of file
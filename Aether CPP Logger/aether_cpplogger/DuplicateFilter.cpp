@@ -0,0 +1,68 @@
+#include "DuplicateFilter.h"
+
+namespace aether_cpplogger
+{
+	std::uint64_t DuplicateFilter::hash(std::string_view data, std::uint64_t hash)
+	{
+		for (const char character : data)
+		{
+			hash ^= static_cast<unsigned char>(character);
+			hash *= 1099511628211ull;
+		}
+		return hash;
+	}
+
+	bool DuplicateFilter::isRepeated(const std::uint64_t key, const LogSeverity severity, std::uint64_t& repeatCount, LogSeverity& repeatSeverity)
+	{
+		//The lowest key bit is set, so the empty state never matches a log
+		const std::uint64_t logState = ((key | 1) << (COUNT_BITS + SEVERITY_BITS)) | (static_cast<std::uint64_t>(severity) << COUNT_BITS);
+
+		auto state = m_state.load(std::memory_order_relaxed);
+		while (true)
+		{
+			//A saturated repeat count is reported, the log is then written as a new log
+			if ((state & ~COUNT_MASK) == logState && (state & COUNT_MASK) < COUNT_MASK)
+			{
+				if (m_state.compare_exchange_weak(state, state + 1, std::memory_order_relaxed))
+				{
+					m_suppressedRecords.fetch_add(1, std::memory_order_relaxed);
+					return true;
+				}
+				continue;
+			}
+
+			if (m_state.compare_exchange_weak(state, logState, std::memory_order_relaxed))
+			{
+				repeatCount = state & COUNT_MASK;
+				repeatSeverity = static_cast<LogSeverity>((state >> COUNT_BITS) & ((1 << SEVERITY_BITS) - 1));
+				return false;
+			}
+		}
+	}
+
+	bool DuplicateFilter::takeRepeats(std::uint64_t& repeatCount, LogSeverity& repeatSeverity)
+	{
+		//The previous log is kept, so its further repeats are still skipped
+		auto state = m_state.load(std::memory_order_relaxed);
+		while ((state & COUNT_MASK) > 0)
+		{
+			if (m_state.compare_exchange_weak(state, state & ~COUNT_MASK, std::memory_order_relaxed))
+			{
+				repeatCount = state & COUNT_MASK;
+				repeatSeverity = static_cast<LogSeverity>((state >> COUNT_BITS) & ((1 << SEVERITY_BITS) - 1));
+				return true;
+			}
+		}
+		return false;
+	}
+
+	void DuplicateFilter::reset()
+	{
+		m_state.store(0, std::memory_order_relaxed);
+	}
+
+	std::uint64_t DuplicateFilter::suppressedRecords() const
+	{
+		return m_suppressedRecords.load(std::memory_order_relaxed);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,72 @@
+#pragma once
+#include "LogSeverity.h"
+
+#include <atomic>
+#include <cstdint>
+#include <string_view>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief Detects logs which repeat the previous log of a logger.
+	 *
+	 * The last log is kept as a hash of its content together with its severity and its repeat count in a single atomic word,
+	 * so checking and counting a log is a load and a compare and swap. The repeat count is reported when a different log arrives.
+	 * Two different logs with the same hash are taken as repeated, with 45 bits of hash this is not expected in practice
+	*/
+	class DuplicateFilter
+	{
+	private:
+		static constexpr int COUNT_BITS = 16;
+		static constexpr int SEVERITY_BITS = 3;
+		static constexpr std::uint64_t COUNT_MASK = (std::uint64_t(1) << COUNT_BITS) - 1;
+
+		/**
+		 * @brief The hash of the last log in the upper bits, its severity and the number of its skipped repeats in the lower bits
+		*/
+		std::atomic<std::uint64_t> m_state{ 0 };
+		/**
+		 * @brief Number of logs skipped as repeats
+		*/
+		std::atomic<std::uint64_t> m_suppressedRecords{ 0 };
+
+	public:
+		/**
+		 * @brief Hashes the given bytes (FNV-1a)
+		 *
+		 * @param data The bytes to be hashed
+		 * @param hash The hash of the preceding bytes, so several parts can be combined
+		*/
+		static std::uint64_t hash(std::string_view data, std::uint64_t hash = 14695981039346656037ull);
+
+		/**
+		 * @brief Checks whether the log repeats the previous one. A repeated log is counted, otherwise it becomes the previous log
+		 *
+		 * @param key The hash of the log content
+		 * @param severity The severity of the log
+		 * @param repeatCount Set to the number of skipped repeats of the previous log if the log is not repeated
+		 * @param repeatSeverity Set to the severity of the previous log if the log is not repeated
+		 *
+		 * @return True if the log is a repeat and is to be skipped
+		*/
+		bool isRepeated(const std::uint64_t key, const LogSeverity severity, std::uint64_t& repeatCount, LogSeverity& repeatSeverity);
+		/**
+		 * @brief Takes the number of skipped repeats of the previous log, so it can be reported before a flush
+		 *
+		 * @param repeatCount Set to the number of skipped repeats
+		 * @param repeatSeverity Set to the severity of the previous log
+		 *
+		 * @return True if there were skipped repeats
+		*/
+		bool takeRepeats(std::uint64_t& repeatCount, LogSeverity& repeatSeverity);
+		/**
+		 * @brief Forgets the previous log
+		*/
+		void reset();
+
+		/**
+		 * @brief The number of logs skipped as repeats
+		*/
+		std::uint64_t suppressedRecords() const;
+	};
+}
\ No newline at end of file
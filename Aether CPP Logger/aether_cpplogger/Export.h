@@ -0,0 +1,13 @@
+#pragma once
+
+//The aether_cpplogger project defines AETHER_CPPLOGGER_EXPORTS, so the library exports its classes and the clients import them.
+//Importing is required for the static data members which are read by the inline functions of the headers
+#if defined(_WIN32)
+#ifdef AETHER_CPPLOGGER_EXPORTS
+#define AETHER_CPPLOGGER_API __declspec(dllexport)
+#else
+#define AETHER_CPPLOGGER_API __declspec(dllimport)
+#endif
+#else
+#define AETHER_CPPLOGGER_API
+#endif
\ No newline at end of file
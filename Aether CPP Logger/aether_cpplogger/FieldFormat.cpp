@@ -0,0 +1,283 @@
+#include "FieldFormat.h"
+#include "LogField.h"
+
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace
+{
+	constexpr std::uint64_t ONES = 0x0101010101010101ULL;
+	constexpr std::uint64_t HIGH_BITS = 0x8080808080808080ULL;
+
+	/**
+	 * @brief True if any byte of the word is lower than the given value (at most 128)
+	*/
+	constexpr bool hasByteLess(const std::uint64_t word, const std::uint8_t value)
+	{
+		return ((word - ONES * value) & ~word & HIGH_BITS) != 0;
+	}
+
+	/**
+	 * @brief True if any byte of the word equals the given value
+	*/
+	constexpr bool hasByte(const std::uint64_t word, const std::uint8_t value)
+	{
+		return hasByteLess(word ^ (ONES * value), 1);
+	}
+
+	/**
+	 * @brief True if any byte of the word has to be escaped in a JSON string
+	*/
+	constexpr bool hasJsonSpecial(const std::uint64_t word)
+	{
+		return hasByteLess(word, 0x20) || hasByte(word, '"') || hasByte(word, '\\');
+	}
+
+	constexpr bool isJsonSpecial(const unsigned char character)
+	{
+		return character < 0x20 || character == '"' || character == '\\';
+	}
+
+	/**
+	 * @brief True if the value has to be quoted in a logfmt line
+	*/
+	bool needsLogfmtQuotes(std::string_view value)
+	{
+		if (value.empty())
+		{
+			return true;
+		}
+
+		std::size_t i = 0;
+		for (; i + sizeof(std::uint64_t) <= value.size(); i += sizeof(std::uint64_t))
+		{
+			std::uint64_t word;
+			std::memcpy(&word, value.data() + i, sizeof(word));
+			//The space is covered by the check for bytes lower than 0x21
+			if (hasByteLess(word, 0x21) || hasByte(word, '=') || hasByte(word, '"') || hasByte(word, '\\'))
+			{
+				return true;
+			}
+		}
+
+		for (; i < value.size(); ++i)
+		{
+			const auto character = static_cast<unsigned char>(value[i]);
+			if (character <= ' ' || character == '=' || character == '"' || character == '\\')
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	void appendEscapedCharacter(std::string& destination, const unsigned char character)
+	{
+		switch (character)
+		{
+		case '"':
+			destination += "\\\"";
+			break;
+		case '\\':
+			destination += "\\\\";
+			break;
+		case '\n':
+			destination += "\\n";
+			break;
+		case '\r':
+			destination += "\\r";
+			break;
+		case '\t':
+			destination += "\\t";
+			break;
+		case '\b':
+			destination += "\\b";
+			break;
+		case '\f':
+			destination += "\\f";
+			break;
+		default:
+		{
+			constexpr char hexDigits[] = "0123456789abcdef";
+			const char escaped[] = { '\\', 'u', '0', '0', hexDigits[character >> 4], hexDigits[character & 0xF] };
+			destination.append(escaped, sizeof(escaped));
+			break;
+		}
+		}
+	}
+
+	/**
+	 * @brief Appends an integer, floating point or boolean field value. Non-finite floating point values are written as null in JSON
+	*/
+	void appendScalarValue(std::string& destination, const aether_cpplogger::LogField& field, const bool isJson)
+	{
+		char buffer[64];
+		std::to_chars_result result{ buffer, std::errc() };
+
+		switch (field.Type)
+		{
+		case '?':
+			destination += field.Boolean ? std::string_view("true") : std::string_view("false");
+			return;
+		case 'q':
+			result = std::to_chars(buffer, buffer + sizeof(buffer), field.Integer);
+			break;
+		case 'Q':
+			result = std::to_chars(buffer, buffer + sizeof(buffer), field.Unsigned);
+			break;
+		default:
+			if (isJson && !std::isfinite(field.Float))
+			{
+				destination += "null";
+				return;
+			}
+			result = std::to_chars(buffer, buffer + sizeof(buffer), field.Float);
+			break;
+		}
+
+		destination.append(buffer, result.ptr);
+	}
+
+	/**
+	 * @brief Appends the key of a logfmt pair. Characters which would break the pair are replaced by underscores
+	*/
+	void appendLogfmtKey(std::string& destination, std::string_view key)
+	{
+		for (const char character : key)
+		{
+			const auto byte = static_cast<unsigned char>(character);
+			destination += byte <= ' ' || character == '=' || character == '"' ? '_' : character;
+		}
+	}
+
+	void appendJsonString(std::string& destination, std::string_view value)
+	{
+		destination += '"';
+		aether_cpplogger::appendJsonEscaped(destination, value);
+		destination += '"';
+	}
+}
+
+namespace aether_cpplogger
+{
+	void appendJsonEscaped(std::string& destination, std::string_view value)
+	{
+		const char* const data = value.data();
+		const std::size_t size = value.size();
+
+		//Start of the pending run of characters which need no escaping
+		std::size_t runStart = 0;
+		std::size_t i = 0;
+		while (i < size)
+		{
+			//Skip whole words without special characters
+			if (i + sizeof(std::uint64_t) <= size)
+			{
+				std::uint64_t word;
+				std::memcpy(&word, data + i, sizeof(word));
+				if (!hasJsonSpecial(word))
+				{
+					i += sizeof(word);
+					continue;
+				}
+			}
+
+			const auto character = static_cast<unsigned char>(data[i]);
+			if (isJsonSpecial(character))
+			{
+				destination.append(data + runStart, i - runStart);
+				appendEscapedCharacter(destination, character);
+				runStart = i + 1;
+			}
+			++i;
+		}
+
+		destination.append(data + runStart, size - runStart);
+	}
+
+	void appendLogfmtValue(std::string& destination, std::string_view value)
+	{
+		if (needsLogfmtQuotes(value))
+		{
+			appendJsonString(destination, value);
+		}
+		else
+		{
+			destination += value;
+		}
+	}
+
+	void appendLogfmtFields(std::string& destination, std::string_view fields)
+	{
+		bool isFirst = true;
+		forEachField(fields, [&](const LogField& field)
+			{
+				if (!isFirst)
+				{
+					destination += ' ';
+				}
+				isFirst = false;
+
+				appendLogfmtKey(destination, field.Key);
+				destination += '=';
+				if (field.Type == 's')
+				{
+					appendLogfmtValue(destination, field.String);
+				}
+				else
+				{
+					appendScalarValue(destination, field, false);
+				}
+			});
+	}
+
+	void appendJsonLine(std::string& destination, std::string_view date, std::string_view time, const LogSeverity severity, std::string_view message, std::string_view fields)
+	{
+		destination += "{\"time\":\"";
+		destination += date;
+		destination += 'T';
+		destination += time;
+		destination += "\",\"severity\":\"";
+		destination += severityName(severity);
+		destination += "\",\"message\":";
+		appendJsonString(destination, message);
+
+		forEachField(fields, [&destination](const LogField& field)
+			{
+				destination += ',';
+				appendJsonString(destination, field.Key);
+				destination += ':';
+				if (field.Type == 's')
+				{
+					appendJsonString(destination, field.String);
+				}
+				else
+				{
+					appendScalarValue(destination, field, true);
+				}
+			});
+
+		destination += '}';
+	}
+
+	void appendLogfmtLine(std::string& destination, std::string_view date, std::string_view time, const LogSeverity severity, std::string_view message, std::string_view fields)
+	{
+		destination += "time=";
+		destination += date;
+		destination += 'T';
+		destination += time;
+		destination += " severity=";
+		destination += severityName(severity);
+		destination += " message=";
+		appendLogfmtValue(destination, message);
+
+		if (!fields.empty())
+		{
+			destination += ' ';
+			appendLogfmtFields(destination, fields);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,55 @@
+#pragma once
+#include "LogSeverity.h"
+
+#include <string>
+#include <string_view>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief Appends the value as the content of a JSON string without the quotes.
+		Quotes, backslashes and control characters are escaped, everything else (including UTF-8 sequences) is copied as it is.
+		Eight bytes are checked at once, so runs without special characters are copied in bulk
+	 *
+	 * @param destination The string to be appended
+	 * @param value The value to be escaped
+	*/
+	void appendJsonEscaped(std::string& destination, std::string_view value);
+	/**
+	 * @brief Appends the value as a logfmt value. It is quoted and escaped like a JSON string only if it is empty
+		or contains a space, an equals sign, a quote, a backslash or a control character
+	 *
+	 * @param destination The string to be appended
+	 * @param value The value to be written
+	*/
+	void appendLogfmtValue(std::string& destination, std::string_view value);
+	/**
+	 * @brief Appends the encoded fields (see encodeField()) as space separated logfmt key=value pairs
+	 *
+	 * @param destination The string to be appended
+	 * @param fields The encoded fields
+	*/
+	void appendLogfmtFields(std::string& destination, std::string_view fields);
+	/**
+	 * @brief Appends a log as a single line JSON object. The fields are written directly as members after the message
+	 *
+	 * @param destination The string to be appended
+	 * @param date The date of the log e.g.: 1900-10-03
+	 * @param time The time of the log e.g.: 21:02:08.042
+	 * @param severity The severity of the log
+	 * @param message The raw message of the log
+	 * @param fields The encoded fields of the log
+	*/
+	void appendJsonLine(std::string& destination, std::string_view date, std::string_view time, const LogSeverity severity, std::string_view message, std::string_view fields);
+	/**
+	 * @brief Appends a log as a single logfmt line
+	 *
+	 * @param destination The string to be appended
+	 * @param date The date of the log e.g.: 1900-10-03
+	 * @param time The time of the log e.g.: 21:02:08.042
+	 * @param severity The severity of the log
+	 * @param message The raw message of the log
+	 * @param fields The encoded fields of the log
+	*/
+	void appendLogfmtLine(std::string& destination, std::string_view date, std::string_view time, const LogSeverity severity, std::string_view message, std::string_view fields);
+}
\ No newline at end of file
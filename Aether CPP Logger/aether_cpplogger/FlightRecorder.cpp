@@ -0,0 +1,567 @@
+#include "FlightRecorder.h"
+#include "ThreadSlots.h"
+
+#include <algorithm>
+#include <csignal>
+#include <cstring>
+#include <thread>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#include <share.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief A slot of a ring. The sequence is odd while the owner thread writes the slot and even when the slot holds
+		the record of the position (sequence - 2) / 2. The fields are atomic, so a dump which races with the writer is not undefined
+	*/
+	struct FlightRecord
+	{
+		std::atomic<std::uint64_t> Sequence{ 0 };
+		std::atomic<std::int64_t> Timestamp{ 0 };
+		std::atomic<std::uint32_t> Length{ 0 };
+		std::atomic<LogSeverity> Severity{ LogSeverity::INFO };
+		/**
+		 * @brief The number of the thread which made the record. A reused ring still holds records of the exited thread
+		*/
+		std::atomic<std::uint32_t> ThreadNumber{ 0 };
+	};
+
+	struct FlightRecorderRing : ThreadSlot
+	{
+		/**
+		 * @brief The next ring in the list of the recorder, it is set before the ring is published
+		*/
+		FlightRecorderRing* Next = nullptr;
+		/**
+		 * @brief The number of the thread in the dump, a reused ring gets a new number
+		*/
+		std::atomic<std::uint32_t> ThreadNumber{ 0 };
+		std::atomic<std::uint64_t> WritePosition{ 0 };
+		/**
+		 * @brief The write position at the end of the last dump
+		*/
+		std::atomic<std::uint64_t> DumpedPosition{ 0 };
+		std::unique_ptr<FlightRecord[]> Records;
+		/**
+		 * @brief The number of text words of a slot, enough for the maximal record size
+		*/
+		const std::size_t WordsPerRecord;
+		/**
+		 * @brief The texts of the slots. They are copied in atomic words, so a dump which races with the writer is not undefined either
+		*/
+		std::unique_ptr<std::atomic<std::uint64_t>[]> Text;
+
+		FlightRecorderRing(const std::size_t recordsPerThread, const std::size_t maxRecordSize)
+			: Records(new FlightRecord[recordsPerThread]),
+			WordsPerRecord((maxRecordSize + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t)),
+			Text(new std::atomic<std::uint64_t>[recordsPerThread * WordsPerRecord])
+		{
+		}
+
+		/**
+		 * @brief Copies the text into the words of the slot. Only the owner thread calls it
+		*/
+		void storeText(const std::size_t index, std::string_view text)
+		{
+			auto* words = Text.get() + index * WordsPerRecord;
+			const std::size_t fullWords = text.size() / sizeof(std::uint64_t);
+			std::uint64_t word = 0;
+			for (std::size_t i = 0; i < fullWords; ++i)
+			{
+				std::memcpy(&word, text.data() + i * sizeof(std::uint64_t), sizeof(std::uint64_t));
+				words[i].store(word, std::memory_order_relaxed);
+			}
+
+			const std::size_t rest = text.size() % sizeof(std::uint64_t);
+			if (rest > 0)
+			{
+				word = 0;
+				std::memcpy(&word, text.data() + fullWords * sizeof(std::uint64_t), rest);
+				words[fullWords].store(word, std::memory_order_relaxed);
+			}
+		}
+
+		/**
+		 * @brief Copies the given number of text bytes of the slot into the buffer
+		*/
+		void loadText(const std::size_t index, char* text, const std::size_t length) const
+		{
+			const auto* words = Text.get() + index * WordsPerRecord;
+			for (std::size_t offset = 0; offset < length; offset += sizeof(std::uint64_t))
+			{
+				const auto word = words[offset / sizeof(std::uint64_t)].load(std::memory_order_relaxed);
+				std::memcpy(text + offset, &word, std::min(sizeof(std::uint64_t), length - offset));
+			}
+		}
+	};
+}
+
+namespace
+{
+	constexpr std::size_t MAX_RECORD_SIZE = 2048;
+	constexpr std::size_t MAX_SIGNAL_RECORDERS = 16;
+	constexpr std::int64_t MICROSECONDS_PER_SECOND = 1000000;
+	constexpr std::int64_t SECONDS_PER_DAY = 86400;
+	constexpr int FATAL_SIGNALS[] = { SIGSEGV, SIGABRT, SIGFPE, SIGILL };
+	constexpr std::size_t FATAL_SIGNAL_COUNT = sizeof(FATAL_SIGNALS) / sizeof(FATAL_SIGNALS[0]);
+
+	using SignalHandler = void (*)(int);
+
+	std::uint64_t nextRecorderId()
+	{
+		static std::atomic<std::uint64_t> s_nextRecorderId{ 1 };
+		return s_nextRecorderId.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief The recorders which are dumped on a fatal signal. A fixed array, so the signal handler neither locks nor allocates
+	*/
+	std::atomic<aether_cpplogger::FlightRecorder*> s_signalRecorders[MAX_SIGNAL_RECORDERS] = {};
+	/**
+	 * @brief The number of running signal handler dumps. A recorder removed from s_signalRecorders may still be dumped until it drops to zero
+	*/
+	std::atomic<int> s_runningSignalDumps{ 0 };
+	SignalHandler s_previousHandlers[FATAL_SIGNAL_COUNT] = {};
+	std::once_flag s_signalHandlersFlag;
+
+	/**
+	 * @brief The rings the calling thread records into, one entry for each recorder it logged with.
+		The ring of an exited thread is kept by its recorder and is reused by the next new thread
+	*/
+	thread_local aether_cpplogger::ThreadSlots<aether_cpplogger::FlightRecorderRing> t_threadRings;
+
+	std::string_view signalName(const int signal)
+	{
+		switch (signal)
+		{
+		case SIGSEGV:
+			return "SIGSEGV";
+		case SIGABRT:
+			return "SIGABRT";
+		case SIGFPE:
+			return "SIGFPE";
+		case SIGILL:
+			return "SIGILL";
+		}
+
+		return "signal";
+	}
+
+	/**
+	 * @brief Dumps the recorders, then passes the signal to the previous handler or to the default action
+	*/
+	void handleFatalSignal(const int signal)
+	{
+		aether_cpplogger::FlightRecorder::dumpAll(signalName(signal));
+
+		SignalHandler previousHandler = SIG_DFL;
+		for (std::size_t i = 0; i < FATAL_SIGNAL_COUNT; ++i)
+		{
+			if (FATAL_SIGNALS[i] == signal && s_previousHandlers[i] != SIG_IGN && s_previousHandlers[i] != SIG_ERR)
+			{
+				previousHandler = s_previousHandlers[i];
+			}
+		}
+		std::signal(signal, previousHandler);
+		std::raise(signal);
+	}
+
+	void installSignalHandlers()
+	{
+		std::call_once(s_signalHandlersFlag, []()
+			{
+				for (std::size_t i = 0; i < FATAL_SIGNAL_COUNT; ++i)
+				{
+					s_previousHandlers[i] = std::signal(FATAL_SIGNALS[i], handleFatalSignal);
+				}
+			});
+	}
+
+	int openDumpFile(const char* path)
+	{
+#ifdef _WIN32
+		int file = -1;
+		_sopen_s(&file, path, _O_WRONLY | _O_CREAT | _O_APPEND | _O_BINARY, _SH_DENYNO, _S_IREAD | _S_IWRITE);
+		return file;
+#else
+		return ::open(path, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+#endif
+	}
+
+	void writeDumpFile(const int file, const char* data, std::size_t size)
+	{
+		while (size > 0)
+		{
+#ifdef _WIN32
+			const auto written = _write(file, data, static_cast<unsigned>(size));
+#else
+			const auto written = ::write(file, data, size);
+#endif
+			if (written <= 0)
+			{
+				return;
+			}
+			data += written;
+			size -= static_cast<std::size_t>(written);
+		}
+	}
+
+	void closeDumpFile(const int file)
+	{
+#ifdef _WIN32
+		_close(file);
+#else
+		::close(file);
+#endif
+	}
+
+	/**
+	 * @brief Buffers the dump on the stack and writes it to the file in large chunks
+	*/
+	class DumpWriter
+	{
+	private:
+		static constexpr std::size_t BUFFER_SIZE = 4096;
+
+		const int m_file;
+		char m_buffer[BUFFER_SIZE];
+		std::size_t m_size = 0;
+
+	public:
+		explicit DumpWriter(const int file)
+			: m_file(file)
+		{
+		}
+
+		~DumpWriter()
+		{
+			flush();
+		}
+
+		void flush()
+		{
+			writeDumpFile(m_file, m_buffer, m_size);
+			m_size = 0;
+		}
+
+		/**
+		 * @brief Returns room for the given number of bytes, the bytes are only added by commit
+		*/
+		char* reserve(const std::size_t size)
+		{
+			if (m_size + size > BUFFER_SIZE)
+			{
+				flush();
+			}
+			return m_buffer + m_size;
+		}
+
+		void commit(const std::size_t size)
+		{
+			m_size += size;
+		}
+
+		void append(std::string_view text)
+		{
+			text = text.substr(0, BUFFER_SIZE);
+			std::memcpy(reserve(text.size()), text.data(), text.size());
+			commit(text.size());
+		}
+
+		void appendNumber(std::uint64_t number, const int minDigits = 1)
+		{
+			char digits[20];
+			int count = 0;
+			do
+			{
+				digits[count++] = static_cast<char>('0' + number % 10);
+				number /= 10;
+			} while (number > 0 || count < minDigits);
+
+			char* out = reserve(count);
+			for (int i = 0; i < count; ++i)
+			{
+				out[i] = digits[count - 1 - i];
+			}
+			commit(count);
+		}
+
+		/**
+		 * @brief Appends the UTC time of the timestamp e.g.: 2024-05-17T21:02:08.042000Z.
+			The civil date is computed by hand, because gmtime is not async-signal-safe
+		*/
+		void appendTimestamp(const std::int64_t timestamp)
+		{
+			const auto seconds = timestamp >= 0 ? timestamp / MICROSECONDS_PER_SECOND : (timestamp + 1) / MICROSECONDS_PER_SECOND - 1;
+			const auto microseconds = timestamp - seconds * MICROSECONDS_PER_SECOND;
+			const auto days = seconds >= 0 ? seconds / SECONDS_PER_DAY : (seconds + 1) / SECONDS_PER_DAY - 1;
+			const auto secondOfDay = seconds - days * SECONDS_PER_DAY;
+
+			//Days since 1970-01-01 to the proleptic Gregorian calendar
+			const auto shiftedDays = days + 719468;
+			const auto era = (shiftedDays >= 0 ? shiftedDays : shiftedDays - 146096) / 146097;
+			const auto dayOfEra = shiftedDays - era * 146097;
+			const auto yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+			const auto dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+			const auto monthIndex = (5 * dayOfYear + 2) / 153;
+			const auto day = dayOfYear - (153 * monthIndex + 2) / 5 + 1;
+			const auto month = monthIndex < 10 ? monthIndex + 3 : monthIndex - 9;
+			const auto year = yearOfEra + era * 400 + (month <= 2 ? 1 : 0);
+
+			appendNumber(static_cast<std::uint64_t>(std::max<std::int64_t>(year, 0)), 4);
+			append("-");
+			appendNumber(static_cast<std::uint64_t>(month), 2);
+			append("-");
+			appendNumber(static_cast<std::uint64_t>(day), 2);
+			append("T");
+			appendNumber(static_cast<std::uint64_t>(secondOfDay / 3600), 2);
+			append(":");
+			appendNumber(static_cast<std::uint64_t>(secondOfDay / 60 % 60), 2);
+			append(":");
+			appendNumber(static_cast<std::uint64_t>(secondOfDay % 60), 2);
+			append(".");
+			appendNumber(static_cast<std::uint64_t>(microseconds), 6);
+			append("Z ");
+		}
+	};
+}
+
+namespace aether_cpplogger
+{
+	FlightRecorder::FlightRecorder(const LogSeverity severity, const std::size_t recordsPerThread, const std::size_t maxRecordSize,
+		const bool isDumpedOnError, const bool isDumpedOnSignal)
+		: m_severity(severity),
+		m_recordsPerThread(std::max<std::size_t>(recordsPerThread, 1)),
+		m_maxRecordSize(std::clamp<std::size_t>(maxRecordSize, 1, MAX_RECORD_SIZE)),
+		m_isDumpedOnError(isDumpedOnError),
+		m_id(nextRecorderId())
+	{
+		if (!isDumpedOnSignal)
+		{
+			return;
+		}
+
+		//Without a free entry the recorder is only dumped on errors and on request
+		for (auto& signalRecorder : s_signalRecorders)
+		{
+			FlightRecorder* expected = nullptr;
+			if (signalRecorder.compare_exchange_strong(expected, this))
+			{
+				installSignalHandlers();
+				break;
+			}
+		}
+	}
+
+	FlightRecorder::~FlightRecorder()
+	{
+		for (auto& signalRecorder : s_signalRecorders)
+		{
+			FlightRecorder* expected = this;
+			signalRecorder.compare_exchange_strong(expected, nullptr);
+		}
+
+		//A signal handler which already picked up the recorder may still dump it. The handler registers before it reads the
+		//recorders, so it either sees the recorder removed or it is counted here
+		while (s_runningSignalDumps.load() != 0)
+		{
+			std::this_thread::yield();
+		}
+
+		std::lock_guard<std::mutex> lock(m_ringsMutex);
+		for (const auto& ring : m_rings)
+		{
+			ring->IsOwnerStopped.store(true, std::memory_order_release);
+		}
+	}
+
+	LogSeverity FlightRecorder::severity() const
+	{
+		return m_severity;
+	}
+
+	bool FlightRecorder::isDumpedOnError() const
+	{
+		return m_isDumpedOnError;
+	}
+
+	void FlightRecorder::setDumpPath(std::string_view path)
+	{
+		const auto size = path.size() < MAX_DUMP_PATH_SIZE ? path.size() : 0;
+		std::memcpy(m_dumpPath, path.data(), size);
+		m_dumpPath[size] = '\0';
+	}
+
+	FlightRecorderRing& FlightRecorder::threadRing()
+	{
+		if (auto* ring = t_threadRings.find(m_id))
+		{
+			return *ring;
+		}
+
+		std::shared_ptr<FlightRecorderRing> ring;
+		{
+			std::lock_guard<std::mutex> lock(m_ringsMutex);
+			for (const auto& candidate : m_rings)
+			{
+				if (candidate->claim())
+				{
+					ring = candidate;
+					break;
+				}
+			}
+
+			if (!ring)
+			{
+				ring = std::make_shared<FlightRecorderRing>(m_recordsPerThread, m_maxRecordSize);
+				ring->Next = m_firstRing.load(std::memory_order_relaxed);
+				m_rings.push_back(ring);
+				m_firstRing.store(ring.get(), std::memory_order_release);
+			}
+		}
+
+		ring->ThreadNumber.store(m_nextThreadNumber.fetch_add(1, std::memory_order_relaxed), std::memory_order_relaxed);
+		t_threadRings.add(m_id, ring);
+		return *ring;
+	}
+
+	void FlightRecorder::record(const LogSeverity severity, const std::int64_t timestamp, std::string_view message)
+	{
+		auto& ring = threadRing();
+		const auto position = ring.WritePosition.load(std::memory_order_relaxed);
+		const auto index = static_cast<std::size_t>(position % m_recordsPerThread);
+		auto& slot = ring.Records[index];
+		const auto length = std::min(message.size(), m_maxRecordSize);
+
+		slot.Sequence.store(2 * position + 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		ring.storeText(index, message.substr(0, length));
+		slot.Timestamp.store(timestamp, std::memory_order_relaxed);
+		slot.Length.store(static_cast<std::uint32_t>(length), std::memory_order_relaxed);
+		slot.Severity.store(severity, std::memory_order_relaxed);
+		slot.ThreadNumber.store(ring.ThreadNumber.load(std::memory_order_relaxed), std::memory_order_relaxed);
+		slot.Sequence.store(2 * position + 2, std::memory_order_release);
+		ring.WritePosition.store(position + 1, std::memory_order_release);
+	}
+
+	void FlightRecorder::dump(std::string_view reason)
+	{
+		if (m_isDumping.test_and_set(std::memory_order_acquire))
+		{
+			return;
+		}
+		writeDump(reason);
+		m_isDumping.clear(std::memory_order_release);
+	}
+
+	void FlightRecorder::dumpAll(std::string_view reason) noexcept
+	{
+		s_runningSignalDumps.fetch_add(1);
+		for (auto& signalRecorder : s_signalRecorders)
+		{
+			auto* recorder = signalRecorder.load(std::memory_order_acquire);
+			if (recorder == nullptr)
+			{
+				continue;
+			}
+
+			//A dump interrupted by the signal on this thread would never finish, so the flag is only waited for a while.
+			//Without the flag the recorder is skipped, the dump which holds it is still writing
+			bool isDumping = true;
+			for (int i = 0; i < 1000000 && isDumping; ++i)
+			{
+				isDumping = recorder->m_isDumping.test_and_set(std::memory_order_acquire);
+			}
+			if (isDumping)
+			{
+				continue;
+			}
+			recorder->writeDump(reason);
+			recorder->m_isDumping.clear(std::memory_order_release);
+		}
+		s_runningSignalDumps.fetch_sub(1);
+	}
+
+	void FlightRecorder::writeDump(std::string_view reason) noexcept
+	{
+		if (m_dumpPath[0] == '\0')
+		{
+			return;
+		}
+
+		const int file = openDumpFile(m_dumpPath);
+		if (file < 0)
+		{
+			return;
+		}
+
+		{
+			DumpWriter writer(file);
+			writer.append("=== Flight recorder dump (");
+			writer.append(reason);
+			writer.append(") ===\n");
+
+			for (auto* ring = m_firstRing.load(std::memory_order_acquire); ring != nullptr; ring = ring->Next)
+			{
+				const auto end = ring->WritePosition.load(std::memory_order_acquire);
+				const auto dumpedPosition = ring->DumpedPosition.load(std::memory_order_relaxed);
+				const auto begin = std::max(dumpedPosition, end > m_recordsPerThread ? end - m_recordsPerThread : 0);
+				if (begin >= end)
+				{
+					continue;
+				}
+
+				//A header starts the records of every thread, the records of an exited thread may precede those of the thread reusing the ring
+				std::uint32_t headerThreadNumber = 0;
+				for (auto position = begin; position < end; ++position)
+				{
+					const auto index = static_cast<std::size_t>(position % m_recordsPerThread);
+					const auto& slot = ring->Records[index];
+					const auto sequence = slot.Sequence.load(std::memory_order_acquire);
+					if (sequence != 2 * position + 2)
+					{
+						continue;
+					}
+
+					const auto timestamp = slot.Timestamp.load(std::memory_order_relaxed);
+					const auto length = std::min<std::size_t>(slot.Length.load(std::memory_order_relaxed), m_maxRecordSize);
+					const auto severity = slot.Severity.load(std::memory_order_relaxed);
+					const auto threadNumber = slot.ThreadNumber.load(std::memory_order_relaxed);
+
+					//The text is only written if the owner did not overwrite the slot while it was copied
+					char line[MAX_RECORD_SIZE];
+					ring->loadText(index, line, length);
+					std::atomic_thread_fence(std::memory_order_acquire);
+					if (slot.Sequence.load(std::memory_order_relaxed) != sequence)
+					{
+						continue;
+					}
+
+					if (threadNumber != headerThreadNumber)
+					{
+						writer.append("--- Thread ");
+						writer.appendNumber(threadNumber);
+						writer.append(" ---\n");
+						headerThreadNumber = threadNumber;
+					}
+					writer.appendTimestamp(timestamp);
+					writer.append(severityPrefix(severity));
+					writer.append(std::string_view(line, length));
+					writer.append("\n");
+				}
+				ring->DumpedPosition.store(end, std::memory_order_relaxed);
+			}
+		}
+
+		closeDumpFile(file);
+	}
+}
\ No newline at end of file
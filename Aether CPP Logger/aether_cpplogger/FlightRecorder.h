@@ -0,0 +1,123 @@
+#pragma once
+#include "LogSeverity.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief The records of a thread in a FlightRecorder. Only its owner thread writes it
+	*/
+	struct FlightRecorderRing;
+
+	/**
+	 * @brief In-memory circular buffers of the latest logs of each thread, which are dumped to a file on demand or on a fatal signal.
+	 *
+	 * Every thread gets a ring of fixed size slots on its first record, so recording is a copy into memory of its own.
+	 * The ring of an exited thread is reused by the next new thread, every record keeps the number of the thread which made it. The rings are linked into a list which is only ever prepended,
+	 * so the dump can walk it from a signal handler. The dump only uses async-signal-safe calls: it formats into a stack buffer
+	 * and appends it to the dump file with the low-level file functions. A record which is overwritten while it is dumped is skipped
+	*/
+	class FlightRecorder
+	{
+	private:
+		static constexpr std::size_t MAX_DUMP_PATH_SIZE = 1024;
+
+		const LogSeverity m_severity;
+		const std::size_t m_recordsPerThread;
+		const std::size_t m_maxRecordSize;
+		const bool m_isDumpedOnError;
+		/**
+		 * @brief Identifies the recorder in the thread local ring lists, it is never reused unlike the address
+		*/
+		const std::uint64_t m_id;
+
+		/**
+		 * @brief The head of the list of rings which is walked by the dump
+		*/
+		std::atomic<FlightRecorderRing*> m_firstRing{ nullptr };
+		/**
+		 * @brief The owners of the rings, guarded by m_ringsMutex
+		*/
+		std::vector<std::shared_ptr<FlightRecorderRing>> m_rings;
+		std::mutex m_ringsMutex;
+		std::atomic<std::uint32_t> m_nextThreadNumber{ 1 };
+
+		/**
+		 * @brief The null terminated path of the dump file. It is kept in place, so the signal handler does not touch the heap
+		*/
+		char m_dumpPath[MAX_DUMP_PATH_SIZE] = {};
+		/**
+		 * @brief Set while a dump is written, the dumps of the logging threads are not written concurrently
+		*/
+		std::atomic_flag m_isDumping = ATOMIC_FLAG_INIT;
+
+		/**
+		 * @brief Returns the ring of the calling thread and creates or reuses one on the first call
+		*/
+		FlightRecorderRing& threadRing();
+		/**
+		 * @brief Appends the records which were not dumped yet to the dump file
+		 *
+		 * @param reason The cause of the dump which is written into its header
+		*/
+		void writeDump(std::string_view reason) noexcept;
+
+	public:
+		/**
+		 * @param severity The most verbose severity which is recorded
+		 * @param recordsPerThread The number of latest logs kept for each thread
+		 * @param maxRecordSize The maximal size of a recorded message in bytes
+		 * @param isDumpedOnError Whether the records are dumped when an ERROR log is made
+		 * @param isDumpedOnSignal Whether the records are dumped when the process receives a fatal signal
+		*/
+		FlightRecorder(const LogSeverity severity, const std::size_t recordsPerThread, const std::size_t maxRecordSize,
+			const bool isDumpedOnError, const bool isDumpedOnSignal);
+		~FlightRecorder();
+
+		FlightRecorder(const FlightRecorder&) = delete;
+		FlightRecorder& operator=(const FlightRecorder&) = delete;
+
+		/**
+		 * @brief The most verbose severity which is recorded
+		*/
+		LogSeverity severity() const;
+		/**
+		 * @brief Whether the records are dumped when an ERROR log is made
+		*/
+		bool isDumpedOnError() const;
+		/**
+		 * @brief Sets the file the dumps are appended to. It must not be called while a dump is possible
+		 *
+		 * @param path The path of the dump file. A longer path than 1023 bytes disables the dump
+		*/
+		void setDumpPath(std::string_view path);
+
+		/**
+		 * @brief Copies the log into the ring of the calling thread, the oldest record of the ring is overwritten
+		 *
+		 * @param severity The severity of the log
+		 * @param timestamp The creation time of the log in microseconds since the Unix epoch
+		 * @param message The message of the log
+		*/
+		void record(const LogSeverity severity, const std::int64_t timestamp, std::string_view message);
+		/**
+		 * @brief Appends the records which were not dumped yet to the dump file. Nothing is written while another thread dumps
+		 *
+		 * @param reason The cause of the dump which is written into its header
+		*/
+		void dump(std::string_view reason);
+		/**
+		 * @brief Dumps every recorder registered for the fatal signals. It is called by the signal handler
+		 *
+		 * @param reason The cause of the dump which is written into its header
+		*/
+		static void dumpAll(std::string_view reason) noexcept;
+	};
+}
\ No newline at end of file
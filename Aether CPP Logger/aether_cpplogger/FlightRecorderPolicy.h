@@ -0,0 +1,45 @@
+#pragma once
+#include "LogSeverity.h"
+
+#include <cstddef>
+#include <string>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief Defines the in-memory flight recorder of the latest logs of each thread.
+		The recorder keeps logs up to its own severity even if the severity limit discards them, and writes them to the dump file
+		when an ERROR log is made, when the process receives a fatal signal or on request
+	*/
+	struct FlightRecorderPolicy
+	{
+		/**
+		 * @brief Record the logs in memory
+		*/
+		bool IsEnabled = false;
+		/**
+		 * @brief The most verbose severity which is recorded
+		*/
+		LogSeverity Severity = LogSeverity::TRACE;
+		/**
+		 * @brief The number of latest logs kept for each thread
+		*/
+		std::size_t RecordsPerThread = 1024;
+		/**
+		 * @brief The maximal size of a recorded message in bytes (at most 2048), longer messages are truncated
+		*/
+		std::size_t MaxRecordSize = 256;
+		/**
+		 * @brief Dump the records when an ERROR log is made
+		*/
+		bool IsDumpedOnError = true;
+		/**
+		 * @brief Dump the records when the process receives SIGSEGV, SIGABRT, SIGFPE or SIGILL
+		*/
+		bool IsDumpedOnSignal = true;
+		/**
+		 * @brief The file the dumps are appended to. If it is empty, flight_recorder.log in the log path is used
+		*/
+		std::string DumpPath;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,28 @@
+#pragma once
+#include <chrono>
+#include <cstddef>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief Defines when the buffered logs are written to the log file.
+		The logs are collected in memory and written with a single write call per flush.
+		The buffer is flushed as soon as any of the enabled conditions is met
+	*/
+	struct FlushPolicy
+	{
+		/**
+		 * @brief Flush when at least this many bytes are buffered. 0 flushes every log immediately
+		*/
+		std::size_t BufferSize = 0;
+		/**
+		 * @brief Flush when the last flush is older than this interval. 0 disables the interval.
+			A background thread checks the interval, so the lines are written even if no further log comes
+		*/
+		std::chrono::milliseconds Interval = std::chrono::milliseconds(0);
+		/**
+		 * @brief Flush immediately after every ERROR log so crash related logs are not lost
+		*/
+		bool FlushOnError = true;
+	};
+}
\ No newline at end of file
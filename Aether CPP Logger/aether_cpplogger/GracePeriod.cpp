@@ -0,0 +1,24 @@
+#include "GracePeriod.h"
+
+#include <thread>
+
+namespace aether_cpplogger
+{
+	void GracePeriod::synchronize()
+	{
+		std::lock_guard lock(m_writerMutex);
+
+		//A reader may read the epoch before a flip and register after it, so one flip would not cover it.
+		//After two flips both counters have been drained once since the new object was published
+		for (int i = 0; i < 2; ++i)
+		{
+			const int epoch = m_epoch.load();
+			m_epoch.store(epoch ^ 1);
+
+			while (m_readers[epoch].load() != 0)
+			{
+				std::this_thread::yield();
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+#pragma once
+#include <atomic>
+#include <mutex>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief Tells when a replaced object is no longer read (a minimal RCU scheme).
+	 *
+	 * A reader only registers itself in the reader counter of the current epoch while it uses the published object,
+	 * so reading never takes a lock. A writer publishes the new object, then synchronize() waits until every reader
+	 * which could still see the old object has finished, so the old object can be destroyed right away
+	*/
+	class GracePeriod
+	{
+	private:
+		/**
+		 * @brief Selects the reader counter new readers register in
+		*/
+		std::atomic<int> m_epoch{ 0 };
+		/**
+		 * @brief The number of running readers for each epoch
+		*/
+		std::atomic<int> m_readers[2] = { { 0 }, { 0 } };
+		/**
+		 * @brief Mutex which serializes the waiting writers, the epoch flips of two writers must not interleave
+		*/
+		std::mutex m_writerMutex;
+
+	public:
+		/**
+		 * @brief Keeps a reader registered in the reader counter of its epoch until the end of the scope
+		*/
+		class ReadGuard
+		{
+		private:
+			std::atomic<int>& m_readers;
+
+		public:
+			explicit ReadGuard(GracePeriod& gracePeriod) :
+				m_readers(gracePeriod.m_readers[gracePeriod.m_epoch.load()])
+			{
+				m_readers.fetch_add(1);
+			}
+
+			~ReadGuard()
+			{
+				m_readers.fetch_sub(1);
+			}
+
+			ReadGuard(const ReadGuard&) = delete;
+			ReadGuard& operator=(const ReadGuard&) = delete;
+		};
+
+		GracePeriod() = default;
+
+		GracePeriod(const GracePeriod&) = delete;
+		GracePeriod& operator=(const GracePeriod&) = delete;
+
+		/**
+		 * @brief Waits until every reader started before the call has finished.
+			It must not be called by a reader, because it would wait for itself
+		*/
+		void synchronize();
+	};
+}
\ No newline at end of file
@@ -0,0 +1,408 @@
+#include "GzipWriter.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <iterator>
+
+namespace
+{
+	/**
+	 * @brief Maximal hash chain length for each compression level
+	*/
+	constexpr int MAX_CHAIN[] = { 0, 4, 8, 16, 32, 64, 128, 256, 1024, 4096 };
+
+	constexpr std::uint16_t LENGTH_BASE[] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+		35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+	constexpr std::uint8_t LENGTH_EXTRA[] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+		3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+	constexpr std::uint16_t DISTANCE_BASE[] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+		257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+	constexpr std::uint8_t DISTANCE_EXTRA[] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+		7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+	constexpr std::uint32_t reverseBits(std::uint32_t value, const int count)
+	{
+		std::uint32_t result = 0;
+		for (int i = 0; i < count; ++i)
+		{
+			result = (result << 1) | (value & 1);
+			value >>= 1;
+		}
+		return result;
+	}
+
+	/**
+	 * @brief A Huffman code already reversed for the least significant bit first output
+	*/
+	struct HuffmanCode
+	{
+		std::uint16_t Code;
+		std::uint8_t Length;
+	};
+
+	/**
+	 * @brief The fixed literal/length codes of deflate (RFC 1951 3.2.6)
+	*/
+	const std::array<HuffmanCode, 288>& fixedLiteralCodes()
+	{
+		static const auto codes = []()
+		{
+			std::array<HuffmanCode, 288> result{};
+			for (std::uint32_t symbol = 0; symbol < result.size(); ++symbol)
+			{
+				std::uint32_t code;
+				int length;
+				if (symbol < 144)
+				{
+					code = 0x30 + symbol;
+					length = 8;
+				}
+				else if (symbol < 256)
+				{
+					code = 0x190 + symbol - 144;
+					length = 9;
+				}
+				else if (symbol < 280)
+				{
+					code = symbol - 256;
+					length = 7;
+				}
+				else
+				{
+					code = 0xC0 + symbol - 280;
+					length = 8;
+				}
+				result[symbol] = { static_cast<std::uint16_t>(reverseBits(code, length)), static_cast<std::uint8_t>(length) };
+			}
+			return result;
+		}();
+
+		return codes;
+	}
+
+	const std::array<std::uint32_t, 256>& crcTable()
+	{
+		static const auto table = []()
+		{
+			std::array<std::uint32_t, 256> result{};
+			for (std::uint32_t i = 0; i < result.size(); ++i)
+			{
+				std::uint32_t crc = i;
+				for (int bit = 0; bit < 8; ++bit)
+				{
+					crc = (crc & 1) ? 0xEDB88320u ^ (crc >> 1) : crc >> 1;
+				}
+				result[i] = crc;
+			}
+			return result;
+		}();
+
+		return table;
+	}
+
+	std::uint32_t updateCrc(std::uint32_t crc, std::string_view data)
+	{
+		const auto& table = crcTable();
+		crc = ~crc;
+		for (const char character : data)
+		{
+			crc = table[(crc ^ static_cast<unsigned char>(character)) & 0xFF] ^ (crc >> 8);
+		}
+		return ~crc;
+	}
+
+	std::size_t hashOf(const unsigned char* bytes)
+	{
+		return ((static_cast<std::size_t>(bytes[0]) << 10) ^ (static_cast<std::size_t>(bytes[1]) << 5) ^ bytes[2]) & 0x7FFF;
+	}
+
+	void appendLittleEndian(std::string& destination, const std::uint32_t value)
+	{
+		for (int i = 0; i < 4; ++i)
+		{
+			destination += static_cast<char>((value >> (8 * i)) & 0xFF);
+		}
+	}
+}
+
+namespace aether_cpplogger
+{
+	bool GzipWriter::open(const std::string& path, const int level)
+	{
+		m_stream.open(path, std::ios::out | std::ios::binary | std::ios::trunc);
+		if (!m_stream.is_open())
+		{
+			return false;
+		}
+
+		m_maxChain = MAX_CHAIN[std::clamp(level, 0, 9)];
+		m_window.assign(2 * WINDOW_SIZE, 0);
+		m_head.assign(HASH_SIZE, -1);
+		m_previous.assign(WINDOW_SIZE, -1);
+		m_bitBuffer = 0;
+		m_bitCount = 0;
+		m_output.clear();
+
+		startMember();
+
+		return true;
+	}
+
+	void GzipWriter::write(std::string_view data)
+	{
+		if (!m_isMemberOpen)
+		{
+			startMember();
+		}
+
+		m_crc = updateCrc(m_crc, data);
+		m_inputSize += static_cast<std::uint32_t>(data.size());
+
+		while (!data.empty())
+		{
+			const std::size_t count = std::min(data.size(), m_window.size() - m_windowEnd);
+			std::memcpy(m_window.data() + m_windowEnd, data.data(), count);
+			m_windowEnd += count;
+			data.remove_prefix(count);
+
+			if (m_windowEnd == m_window.size())
+			{
+				deflate(false);
+				slideWindow();
+			}
+		}
+	}
+
+	bool GzipWriter::sync()
+	{
+		if (!m_stream.is_open())
+		{
+			return false;
+		}
+
+		//An empty member is not needed, the next member is started by the next write
+		if (m_isMemberOpen && m_inputSize > 0)
+		{
+			finishMember();
+			m_stream.flush();
+		}
+
+		return m_stream.good();
+	}
+
+	bool GzipWriter::close()
+	{
+		if (!m_stream.is_open())
+		{
+			return false;
+		}
+
+		if (m_isMemberOpen)
+		{
+			finishMember();
+		}
+
+		const bool isWritten = m_stream.good();
+		m_stream.close();
+
+		m_window.clear();
+		m_window.shrink_to_fit();
+		m_head.clear();
+		m_previous.clear();
+
+		return isWritten;
+	}
+
+	bool GzipWriter::isOpen() const
+	{
+		return m_stream.is_open();
+	}
+
+	void GzipWriter::startMember()
+	{
+		//The members are independent, matches never reach into an earlier member
+		m_windowEnd = 0;
+		m_position = 0;
+		std::fill(m_head.begin(), m_head.end(), -1);
+		std::fill(m_previous.begin(), m_previous.end(), -1);
+		m_crc = 0;
+		m_inputSize = 0;
+		m_isMemberOpen = true;
+
+		//Magic, deflate method, no flags, no modification time, no extra flags, unknown operating system
+		m_output.append("\x1F\x8B\x08\x00\x00\x00\x00\x00\x00\xFF", 10);
+
+		//A single fixed Huffman block which is closed by finishMember()
+		writeBits(0, 1);
+		writeBits(1, 2);
+	}
+
+	void GzipWriter::finishMember()
+	{
+		deflate(true);
+		writeLiteral(256);
+
+		//An empty final block marks the end of the deflate stream
+		writeBits(1, 1);
+		writeBits(1, 2);
+		writeLiteral(256);
+		if (m_bitCount > 0)
+		{
+			writeBits(0, 8 - m_bitCount);
+		}
+
+		appendLittleEndian(m_output, m_crc);
+		appendLittleEndian(m_output, m_inputSize);
+		flushOutput();
+		m_isMemberOpen = false;
+	}
+
+	void GzipWriter::writeBits(const std::uint32_t value, const int count)
+	{
+		m_bitBuffer |= static_cast<std::uint64_t>(value) << m_bitCount;
+		m_bitCount += count;
+
+		while (m_bitCount >= 8)
+		{
+			m_output += static_cast<char>(m_bitBuffer & 0xFF);
+			m_bitBuffer >>= 8;
+			m_bitCount -= 8;
+		}
+	}
+
+	void GzipWriter::flushOutput()
+	{
+		m_stream.write(m_output.data(), static_cast<std::streamsize>(m_output.size()));
+		m_output.clear();
+	}
+
+	void GzipWriter::writeLiteral(const unsigned int symbol)
+	{
+		const auto& code = fixedLiteralCodes()[symbol];
+		writeBits(code.Code, code.Length);
+	}
+
+	void GzipWriter::writeMatch(const std::size_t length, const std::size_t distance)
+	{
+		const auto lengthIndex = static_cast<std::size_t>(std::distance(std::begin(LENGTH_BASE),
+			std::upper_bound(std::begin(LENGTH_BASE), std::end(LENGTH_BASE), length)) - 1);
+		writeLiteral(257 + static_cast<unsigned int>(lengthIndex));
+		writeBits(static_cast<std::uint32_t>(length - LENGTH_BASE[lengthIndex]), LENGTH_EXTRA[lengthIndex]);
+
+		//The distance codes are plain 5 bit codes
+		const auto distanceIndex = static_cast<std::size_t>(std::distance(std::begin(DISTANCE_BASE),
+			std::upper_bound(std::begin(DISTANCE_BASE), std::end(DISTANCE_BASE), distance)) - 1);
+		writeBits(reverseBits(static_cast<std::uint32_t>(distanceIndex), 5), 5);
+		writeBits(static_cast<std::uint32_t>(distance - DISTANCE_BASE[distanceIndex]), DISTANCE_EXTRA[distanceIndex]);
+	}
+
+	void GzipWriter::insertHash(const std::size_t position)
+	{
+		const std::size_t hash = hashOf(m_window.data() + position);
+		m_previous[position & (WINDOW_SIZE - 1)] = m_head[hash];
+		m_head[hash] = static_cast<std::int32_t>(position);
+	}
+
+	std::size_t GzipWriter::findMatch(std::size_t& distance) const
+	{
+		const std::size_t maxLength = std::min(MAX_MATCH, m_windowEnd - m_position);
+		if (maxLength < MIN_MATCH)
+		{
+			return 0;
+		}
+
+		//Matches can reach back at most WINDOW_SIZE - 1 bytes
+		const std::int64_t limit = static_cast<std::int64_t>(m_position) - static_cast<std::int64_t>(WINDOW_SIZE);
+		const unsigned char* const current = m_window.data() + m_position;
+
+		std::size_t bestLength = MIN_MATCH - 1;
+		std::int32_t candidate = m_head[hashOf(current)];
+		for (int chain = m_maxChain; chain > 0 && candidate >= 0 && candidate > limit; --chain)
+		{
+			const unsigned char* const earlier = m_window.data() + candidate;
+
+			//Check the byte after the best length first, most candidates fail there
+			if (earlier[bestLength] == current[bestLength])
+			{
+				std::size_t length = 0;
+				while (length < maxLength && earlier[length] == current[length])
+				{
+					++length;
+				}
+
+				if (length > bestLength)
+				{
+					bestLength = length;
+					distance = m_position - static_cast<std::size_t>(candidate);
+					if (length == maxLength)
+					{
+						break;
+					}
+				}
+			}
+
+			candidate = m_previous[static_cast<std::size_t>(candidate) & (WINDOW_SIZE - 1)];
+		}
+
+		return bestLength >= MIN_MATCH ? bestLength : 0;
+	}
+
+	void GzipWriter::deflate(const bool isLast)
+	{
+		const std::size_t end = isLast ? m_windowEnd : m_windowEnd - MIN_LOOKAHEAD;
+		while (m_position < end)
+		{
+			std::size_t length = 0;
+			std::size_t distance = 0;
+			if (m_maxChain > 0)
+			{
+				length = findMatch(distance);
+			}
+
+			if (length == 0)
+			{
+				if (m_maxChain > 0 && m_position + MIN_MATCH <= m_windowEnd)
+				{
+					insertHash(m_position);
+				}
+				writeLiteral(m_window[m_position]);
+				++m_position;
+				continue;
+			}
+
+			writeMatch(length, distance);
+			for (std::size_t i = 0; i < length; ++i, ++m_position)
+			{
+				if (m_position + MIN_MATCH <= m_windowEnd)
+				{
+					insertHash(m_position);
+				}
+			}
+
+			if (m_output.size() >= 65536)
+			{
+				flushOutput();
+			}
+		}
+
+		if (m_output.size() >= 65536)
+		{
+			flushOutput();
+		}
+	}
+
+	void GzipWriter::slideWindow()
+	{
+		std::memmove(m_window.data(), m_window.data() + WINDOW_SIZE, WINDOW_SIZE);
+		m_windowEnd -= WINDOW_SIZE;
+		m_position -= WINDOW_SIZE;
+
+		const auto& slide = [](std::int32_t& position)
+		{
+			position = position >= static_cast<std::int32_t>(WINDOW_SIZE) ? position - static_cast<std::int32_t>(WINDOW_SIZE) : -1;
+		};
+		std::for_each(m_head.begin(), m_head.end(), slide);
+		std::for_each(m_previous.begin(), m_previous.end(), slide);
+	}
+}
\ No newline at end of file
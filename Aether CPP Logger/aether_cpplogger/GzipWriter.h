@@ -0,0 +1,160 @@
+#pragma once
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief Streaming gzip (RFC 1952) file writer.
+	 *
+	 * The data is compressed with LZ77 over a 32KB window and the fixed Huffman codes of deflate (RFC 1951),
+	 * so the memory use is constant and no external library is needed. The output can be read by any gzip tool.
+	 * The compression level sets how many earlier matches are searched for each position: 0 stores every byte as a literal.
+	 * sync() ends the current gzip member, the next write starts a new one. gzip tools read the members as one stream,
+	 * and every member before the last sync point stays readable if the writing process dies
+	*/
+	class GzipWriter
+	{
+	private:
+		static constexpr std::size_t WINDOW_SIZE = 32768;
+		static constexpr std::size_t HASH_SIZE = 32768;
+		static constexpr std::size_t MIN_MATCH = 3;
+		static constexpr std::size_t MAX_MATCH = 258;
+		/**
+		 * @brief The bytes kept after the encoded position while more input can arrive, so every match can reach its maximal length
+		*/
+		static constexpr std::size_t MIN_LOOKAHEAD = MAX_MATCH + MIN_MATCH + 1;
+
+		std::ofstream m_stream;
+		/**
+		 * @brief The maximal number of earlier positions compared for a match
+		*/
+		int m_maxChain = 0;
+
+		/**
+		 * @brief The last WINDOW_SIZE encoded bytes followed by the input which is not yet encoded
+		*/
+		std::vector<unsigned char> m_window;
+		std::size_t m_windowEnd = 0;
+		/**
+		 * @brief The window position of the next byte to be encoded
+		*/
+		std::size_t m_position = 0;
+		/**
+		 * @brief The latest window position of each hash of three bytes, -1 if there is none
+		*/
+		std::vector<std::int32_t> m_head;
+		/**
+		 * @brief The previous window position with the same hash for each position of the last WINDOW_SIZE bytes
+		*/
+		std::vector<std::int32_t> m_previous;
+
+		std::uint64_t m_bitBuffer = 0;
+		int m_bitCount = 0;
+		/**
+		 * @brief The compressed bytes which are not yet written to the file
+		*/
+		std::string m_output;
+
+		/**
+		 * @brief The CRC32 and the size of the input of the current member
+		*/
+		std::uint32_t m_crc = 0;
+		std::uint32_t m_inputSize = 0;
+		/**
+		 * @brief Flag which indicates whether the header of the current member is written. A member is started by the first write after a sync point
+		*/
+		bool m_isMemberOpen = false;
+
+		/**
+		 * @brief Resets the window and the hash chains and writes the header of a new member
+		*/
+		void startMember();
+		/**
+		 * @brief Encodes the remaining input, writes the trailer of the current member and writes the output to the file
+		*/
+		void finishMember();
+
+		/**
+		 * @brief Appends the lowest bits of the value to the output, least significant bit first
+		*/
+		void writeBits(const std::uint32_t value, const int count);
+		/**
+		 * @brief Writes the complete bytes of the output to the file
+		*/
+		void flushOutput();
+		/**
+		 * @brief Writes the code of a literal or the end of block symbol
+		*/
+		void writeLiteral(const unsigned int symbol);
+		/**
+		 * @brief Writes the codes of a match
+		*/
+		void writeMatch(const std::size_t length, const std::size_t distance);
+		/**
+		 * @brief Links the window position into the hash chain of its three bytes
+		*/
+		void insertHash(const std::size_t position);
+		/**
+		 * @brief Finds the longest earlier occurrence of the bytes at the current position
+		 *
+		 * @param distance Set to the distance of the match
+		 *
+		 * @return The length of the match or 0 if there is no match of at least MIN_MATCH bytes
+		*/
+		std::size_t findMatch(std::size_t& distance) const;
+		/**
+		 * @brief Encodes the window up to the lookahead or up to its end on the last call
+		 *
+		 * @param isLast Flag which indicates whether no more input follows
+		*/
+		void deflate(const bool isLast);
+		/**
+		 * @brief Drops the oldest WINDOW_SIZE bytes of the window
+		*/
+		void slideWindow();
+
+	public:
+		GzipWriter() = default;
+
+		GzipWriter(const GzipWriter&) = delete;
+		GzipWriter& operator=(const GzipWriter&) = delete;
+
+		/**
+		 * @brief Creates the file and writes the gzip header
+		 *
+		 * @param path The full path of the compressed file. An existing file is overwritten
+		 * @param level The compression level from 0 (fastest) to 9 (smallest)
+		 *
+		 * @return True if the file could be created
+		*/
+		bool open(const std::string& path, const int level);
+		/**
+		 * @brief Compresses the data. It can be called any number of times
+		 *
+		 * @param data The bytes to be compressed
+		*/
+		void write(std::string_view data);
+		/**
+		 * @brief Ends the current member and writes it to the file, so everything written so far can be decompressed.
+			Nothing happens if no data was written since the last sync point
+		 *
+		 * @return True if every byte could be written to the file
+		*/
+		bool sync();
+		/**
+		 * @brief Encodes the remaining input, writes the gzip trailer and closes the file
+		 *
+		 * @return True if every byte could be written to the file
+		*/
+		bool close();
+
+		/**
+		 * @brief Returns whether a file is currently open
+		*/
+		bool isOpen() const;
+	};
+}
\ No newline at end of file
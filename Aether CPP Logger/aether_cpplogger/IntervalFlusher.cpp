@@ -0,0 +1,43 @@
+#include "IntervalFlusher.h"
+
+#include <algorithm>
+
+namespace aether_cpplogger
+{
+	IntervalFlusher::IntervalFlusher(const std::chrono::milliseconds interval, std::function<void()> flush) :
+		m_interval(interval),
+		m_flush(std::move(flush))
+	{
+		m_thread = std::thread([this]() { run(); });
+	}
+
+	IntervalFlusher::~IntervalFlusher()
+	{
+		{
+			std::lock_guard lock(m_mutex);
+			m_isStopping = true;
+		}
+		m_stopCondition.notify_all();
+
+		m_thread.join();
+	}
+
+	std::chrono::milliseconds IntervalFlusher::interval() const
+	{
+		return m_interval;
+	}
+
+	void IntervalFlusher::run()
+	{
+		const auto period = std::max<std::chrono::milliseconds>(m_interval / 4, std::chrono::milliseconds(1));
+
+		std::unique_lock lock(m_mutex);
+		while (!m_stopCondition.wait_for(lock, period, [this]() { return m_isStopping; }))
+		{
+			//The function takes the log file mutex, so it is called without holding the mutex of the flusher
+			lock.unlock();
+			m_flush();
+			lock.lock();
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,58 @@
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief Background thread which calls the given function periodically while a FlushPolicy::Interval is set.
+	 *
+	 * Without it the interval is only checked when the next line is written or by the async writer thread when it is idle,
+	 * so a quiet sync logger would keep its buffered lines until its next log. The thread wakes up four times per interval,
+	 * so the buffered lines are written at most a quarter of the interval late
+	*/
+	class IntervalFlusher
+	{
+	private:
+		const std::chrono::milliseconds m_interval;
+		const std::function<void()> m_flush;
+
+		std::mutex m_mutex;
+		/**
+		 * @brief Wakes up the thread when the flusher stops
+		*/
+		std::condition_variable m_stopCondition;
+		bool m_isStopping = false;
+
+		std::thread m_thread;
+
+		/**
+		 * @brief The loop of the thread
+		*/
+		void run();
+
+	public:
+		/**
+		 * @brief Starts the thread
+		 *
+		 * @param interval The flush interval. The function is called four times per interval, but at most every millisecond
+		 * @param flush The function which writes the lines whose interval elapsed. It is called from the thread of the flusher
+		*/
+		IntervalFlusher(const std::chrono::milliseconds interval, std::function<void()> flush);
+		/**
+		 * @brief Stops the thread. It waits for a running call of the function
+		*/
+		~IntervalFlusher();
+
+		IntervalFlusher(const IntervalFlusher&) = delete;
+		IntervalFlusher& operator=(const IntervalFlusher&) = delete;
+
+		/**
+		 * @brief Returns the flush interval the flusher was started with
+		*/
+		std::chrono::milliseconds interval() const;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,144 @@
+#include "LatencyHistogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace
+{
+	/**
+	 * @brief Returns the position of the highest set bit of a value which is not zero
+	*/
+	std::size_t highestBit(const std::uint64_t value)
+	{
+#ifdef _MSC_VER
+		//The 64-bit scan is not available on 32-bit targets, so the halves are scanned separately
+		unsigned long index = 0;
+		const auto high = static_cast<unsigned long>(value >> 32);
+		if (high != 0)
+		{
+			_BitScanReverse(&index, high);
+			return index + 32;
+		}
+		_BitScanReverse(&index, static_cast<unsigned long>(value));
+		return index;
+#else
+		return 63 - static_cast<std::size_t>(__builtin_clzll(value));
+#endif
+	}
+}
+
+namespace aether_cpplogger
+{
+	std::size_t LatencyHistogram::bucketIndex(const std::uint64_t value)
+	{
+		if (value < SUB_BUCKET_COUNT)
+		{
+			return static_cast<std::size_t>(value);
+		}
+		if (value >= (std::uint64_t(1) << MAX_VALUE_BITS))
+		{
+			return BUCKET_COUNT - 1;
+		}
+
+		//The bits after the highest one select the bucket within its power of two
+		const auto bit = highestBit(value);
+		const auto subBucket = static_cast<std::size_t>(value >> (bit - SUB_BUCKET_BITS)) & (SUB_BUCKET_COUNT - 1);
+		return (bit - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT + subBucket;
+	}
+
+	std::uint64_t LatencyHistogram::bucketLowerBound(const std::size_t bucket)
+	{
+		const auto powerIndex = bucket / SUB_BUCKET_COUNT;
+		if (powerIndex == 0)
+		{
+			return bucket;
+		}
+
+		const auto subBucket = bucket % SUB_BUCKET_COUNT;
+		return static_cast<std::uint64_t>(SUB_BUCKET_COUNT + subBucket) << (powerIndex - 1);
+	}
+
+	std::uint64_t LatencyHistogram::bucketUpperBound(const std::size_t bucket)
+	{
+		const auto powerIndex = bucket / SUB_BUCKET_COUNT;
+		const std::uint64_t width = powerIndex == 0 ? 1 : std::uint64_t(1) << (powerIndex - 1);
+		return bucketLowerBound(bucket) + width - 1;
+	}
+
+	void LatencyHistogram::record(const std::uint64_t value)
+	{
+		m_buckets[bucketIndex(value)] += 1;
+		m_count += 1;
+		m_sum += value;
+		m_max = std::max(m_max, value);
+	}
+
+	void LatencyHistogram::addBucket(const std::size_t bucket, const std::uint64_t count)
+	{
+		m_buckets[bucket] += count;
+		m_count += count;
+	}
+
+	void LatencyHistogram::addTotals(const std::uint64_t sum, const std::uint64_t max)
+	{
+		m_sum += sum;
+		m_max = std::max(m_max, max);
+	}
+
+	void LatencyHistogram::merge(const LatencyHistogram& other)
+	{
+		for (std::size_t i = 0; i < BUCKET_COUNT; ++i)
+		{
+			m_buckets[i] += other.m_buckets[i];
+		}
+		m_count += other.m_count;
+		addTotals(other.m_sum, other.m_max);
+	}
+
+	std::uint64_t LatencyHistogram::count() const
+	{
+		return m_count;
+	}
+
+	std::uint64_t LatencyHistogram::bucketCount(const std::size_t bucket) const
+	{
+		return m_buckets[bucket];
+	}
+
+	std::chrono::nanoseconds LatencyHistogram::mean() const
+	{
+		return std::chrono::nanoseconds(m_count > 0 ? static_cast<std::int64_t>(m_sum / m_count) : 0);
+	}
+
+	std::chrono::nanoseconds LatencyHistogram::max() const
+	{
+		return std::chrono::nanoseconds(static_cast<std::int64_t>(m_max));
+	}
+
+	std::chrono::nanoseconds LatencyHistogram::percentile(const double quantile) const
+	{
+		if (m_count == 0)
+		{
+			return std::chrono::nanoseconds(0);
+		}
+
+		//The rank of the value, the first value is rank 1
+		const auto rank = std::max<std::uint64_t>(static_cast<std::uint64_t>(std::ceil(std::clamp(quantile, 0.0, 1.0) * m_count)), 1);
+
+		std::uint64_t seen = 0;
+		for (std::size_t i = 0; i < BUCKET_COUNT; ++i)
+		{
+			seen += m_buckets[i];
+			if (seen >= rank)
+			{
+				return std::chrono::nanoseconds(static_cast<std::int64_t>(std::min(bucketUpperBound(i), m_max)));
+			}
+		}
+
+		return max();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,99 @@
+#pragma once
+#include "Export.h"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief A latency distribution in log-linear buckets, in the manner of the HDR histograms.
+	 *
+	 * The values below 16ns have a bucket of their own, above that every power of two is split into 16 buckets,
+	 * so a bucket is at most 6.25% wide relative to its values. The values from 2^36ns (about 68 seconds) share the last bucket.
+	 * The percentiles are reported as the upper bound of their bucket, but never above the largest recorded value
+	*/
+	class AETHER_CPPLOGGER_API LatencyHistogram
+	{
+	public:
+		static constexpr std::size_t SUB_BUCKET_BITS = 4;
+		static constexpr std::size_t SUB_BUCKET_COUNT = std::size_t(1) << SUB_BUCKET_BITS;
+		/**
+		 * @brief The bit width of the largest value which has a bucket of its own
+		*/
+		static constexpr std::size_t MAX_VALUE_BITS = 36;
+		static constexpr std::size_t BUCKET_COUNT = SUB_BUCKET_COUNT * (MAX_VALUE_BITS - SUB_BUCKET_BITS + 1);
+
+	private:
+		std::array<std::uint64_t, BUCKET_COUNT> m_buckets{};
+		std::uint64_t m_count = 0;
+		std::uint64_t m_sum = 0;
+		std::uint64_t m_max = 0;
+
+	public:
+		/**
+		 * @brief Returns the bucket of the given value
+		 *
+		 * @param value The value in nanoseconds
+		*/
+		static std::size_t bucketIndex(const std::uint64_t value);
+		/**
+		 * @brief Returns the smallest value of the given bucket in nanoseconds
+		*/
+		static std::uint64_t bucketLowerBound(const std::size_t bucket);
+		/**
+		 * @brief Returns the largest value of the given bucket in nanoseconds
+		*/
+		static std::uint64_t bucketUpperBound(const std::size_t bucket);
+
+		/**
+		 * @brief Adds a single value to the histogram
+		 *
+		 * @param value The value in nanoseconds
+		*/
+		void record(const std::uint64_t value);
+		/**
+		 * @brief Adds values which were counted elsewhere, e.g. in the shards of the logger's counters
+		 *
+		 * @param bucket The bucket of the values
+		 * @param count The number of the values
+		*/
+		void addBucket(const std::size_t bucket, const std::uint64_t count);
+		/**
+		 * @brief Adds the sum and the maximum of values which were added with addBucket()
+		 *
+		 * @param sum The sum of the values in nanoseconds
+		 * @param max The largest of the values in nanoseconds
+		*/
+		void addTotals(const std::uint64_t sum, const std::uint64_t max);
+		/**
+		 * @brief Adds every value of the other histogram
+		*/
+		void merge(const LatencyHistogram& other);
+
+		/**
+		 * @brief Returns the number of the recorded values
+		*/
+		std::uint64_t count() const;
+		/**
+		 * @brief Returns the number of the values in the given bucket
+		*/
+		std::uint64_t bucketCount(const std::size_t bucket) const;
+		/**
+		 * @brief Returns the average of the recorded values. It is zero if nothing was recorded
+		*/
+		std::chrono::nanoseconds mean() const;
+		/**
+		 * @brief Returns the largest recorded value
+		*/
+		std::chrono::nanoseconds max() const;
+		/**
+		 * @brief Returns the value which the given fraction of the recorded values does not exceed. It is zero if nothing was recorded
+		 *
+		 * @param quantile The fraction between 0 and 1, e.g. 0.99 for the 99th percentile
+		*/
+		std::chrono::nanoseconds percentile(const double quantile) const;
+	};
+}
\ No newline at end of file
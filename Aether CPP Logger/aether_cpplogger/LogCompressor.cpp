@@ -0,0 +1,161 @@
+#include "LogCompressor.h"
+#include "GzipWriter.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#elif defined(__linux__)
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace aether_cpplogger
+{
+	LogCompressor::LogCompressor(const CompressionPolicy& policy) :
+		m_policy(policy)
+	{
+		const std::size_t workerCount = std::max<std::size_t>(1, m_policy.WorkerCount);
+		for (std::size_t i = 0; i < workerCount; ++i)
+		{
+			m_workers.emplace_back([this]() { run(); });
+		}
+	}
+
+	LogCompressor::~LogCompressor()
+	{
+		{
+			std::lock_guard lock(m_mutex);
+			m_isStopping = true;
+		}
+		m_workCondition.notify_all();
+
+		for (auto& worker : m_workers)
+		{
+			worker.join();
+		}
+	}
+
+	void LogCompressor::enqueue(const std::string& path)
+	{
+		{
+			std::lock_guard lock(m_mutex);
+			if (!m_pendingFiles.insert(path).second)
+			{
+				return;
+			}
+			m_queue.push_back(path);
+		}
+		m_workCondition.notify_one();
+	}
+
+	void LogCompressor::wait()
+	{
+		std::unique_lock lock(m_mutex);
+		m_idleCondition.wait(lock, [this]() { return m_pendingFiles.empty(); });
+	}
+
+	void LogCompressor::run()
+	{
+		if (m_policy.IsLowPriority)
+		{
+			lowerThreadPriority();
+		}
+
+		std::unique_lock lock(m_mutex);
+		while (true)
+		{
+			m_workCondition.wait(lock, [this]() { return m_isStopping || !m_queue.empty(); });
+
+			//The queued files are still compressed when stopping
+			if (m_queue.empty())
+			{
+				return;
+			}
+
+			const std::string path = std::move(m_queue.front());
+			m_queue.pop_front();
+
+			lock.unlock();
+			if (!compressFile(path, m_policy.Level))
+			{
+				std::cerr << "Log file could not be compressed: " << path << std::endl;
+			}
+			lock.lock();
+
+			m_pendingFiles.erase(path);
+			if (m_pendingFiles.empty())
+			{
+				m_idleCondition.notify_all();
+			}
+		}
+	}
+
+	void LogCompressor::lowerThreadPriority()
+	{
+#ifdef _WIN32
+		//Lowers the CPU, I/O and memory priority of the thread
+		SetThreadPriority(GetCurrentThread(), THREAD_MODE_BACKGROUND_BEGIN);
+#elif defined(__linux__)
+		//The nice value and the I/O priority of a single thread are set through its thread ID
+		const auto threadId = static_cast<id_t>(syscall(SYS_gettid));
+		setpriority(PRIO_PROCESS, threadId, 19);
+
+		constexpr int IOPRIO_WHO_PROCESS = 1;
+		constexpr int IOPRIO_CLASS_IDLE = 3;
+		constexpr int IOPRIO_CLASS_SHIFT = 13;
+		syscall(SYS_ioprio_set, IOPRIO_WHO_PROCESS, static_cast<int>(threadId), IOPRIO_CLASS_IDLE << IOPRIO_CLASS_SHIFT);
+#endif
+	}
+
+	bool LogCompressor::compressFile(const std::string& path, const int level)
+	{
+		//The file may have been compressed already by an earlier request
+		if (!std::filesystem::exists(path))
+		{
+			return true;
+		}
+
+		const std::string compressedPath = path + std::string(COMPRESSED_EXTENSION);
+		const std::string temporaryPath = compressedPath + ".tmp";
+
+		std::ifstream input(path, std::ios::in | std::ios::binary);
+		GzipWriter writer;
+		if (!input.is_open() || !writer.open(temporaryPath, level))
+		{
+			return false;
+		}
+
+		//The file is read in chunks, so the memory use does not depend on the file size
+		std::string buffer(65536, '\0');
+		while (input.read(buffer.data(), static_cast<std::streamsize>(buffer.size())) || input.gcount() > 0)
+		{
+			writer.write(std::string_view(buffer.data(), static_cast<std::size_t>(input.gcount())));
+		}
+
+		const bool isCompressed = !input.bad() && writer.close();
+		input.close();
+
+		std::error_code error;
+		if (!isCompressed)
+		{
+			std::filesystem::remove(temporaryPath, error);
+			return false;
+		}
+
+		std::filesystem::rename(temporaryPath, compressedPath, error);
+		if (error)
+		{
+			std::filesystem::remove(temporaryPath, error);
+			return false;
+		}
+
+		return std::filesystem::remove(path, error);
+	}
+}
\ No newline at end of file
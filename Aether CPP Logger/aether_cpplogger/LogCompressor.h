@@ -0,0 +1,95 @@
+#pragma once
+#include "CompressionPolicy.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief The extension appended to the name of a compressed log file
+	*/
+	constexpr std::string_view COMPRESSED_EXTENSION = ".gz";
+
+	/**
+	 * @brief Background compressor of the completed log files.
+	 *
+	 * The Logger hands over each completed file and returns immediately, the worker threads compress the files
+	 * in a streaming fashion into <path>.gz and remove the originals. A file is first written to <path>.gz.tmp
+	 * and only renamed when it is complete, so a <path>.gz file is always whole
+	*/
+	class LogCompressor
+	{
+	private:
+		const CompressionPolicy m_policy;
+
+		std::mutex m_mutex;
+		/**
+		 * @brief Wakes up the workers when a file is queued or the compressor stops
+		*/
+		std::condition_variable m_workCondition;
+		/**
+		 * @brief Wakes up the waiting threads when the last file is done
+		*/
+		std::condition_variable m_idleCondition;
+		std::deque<std::string> m_queue;
+		/**
+		 * @brief The queued files and the files being compressed, so a file is not queued twice
+		*/
+		std::unordered_set<std::string> m_pendingFiles;
+		bool m_isStopping = false;
+
+		std::vector<std::thread> m_workers;
+
+		/**
+		 * @brief The loop of the worker threads
+		*/
+		void run();
+		/**
+		 * @brief Lowers the CPU and I/O priority of the calling thread
+		*/
+		static void lowerThreadPriority();
+
+	public:
+		/**
+		 * @brief Starts the worker threads
+		 *
+		 * @param policy The compression settings
+		*/
+		explicit LogCompressor(const CompressionPolicy& policy);
+		/**
+		 * @brief Compresses the queued files and stops the worker threads
+		*/
+		~LogCompressor();
+
+		LogCompressor(const LogCompressor&) = delete;
+		LogCompressor& operator=(const LogCompressor&) = delete;
+
+		/**
+		 * @brief Queues a completed log file for compression. Nothing happens if the file is already queued
+		 *
+		 * @param path The full path of the log file. The file must not be written anymore
+		*/
+		void enqueue(const std::string& path);
+		/**
+		 * @brief Blocks until every queued file is compressed
+		*/
+		void wait();
+
+		/**
+		 * @brief Compresses the file to <path>.gz and removes the original
+		 *
+		 * @param path The full path of the file
+		 * @param level The compression level from 0 to 9
+		 *
+		 * @return True if the file could be compressed
+		*/
+		static bool compressFile(const std::string& path, const int level);
+	};
+}
\ No newline at end of file
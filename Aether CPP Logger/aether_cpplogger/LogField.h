@@ -0,0 +1,162 @@
+#pragma once
+#include "MessageFormat.h"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief A typed key-value pair of a structured log e.g.: { "user_id", 42 }.
+	 *
+	 * The field does not copy the key and string values, it is only valid during the log call.
+	 * The type is one of the argumentType() tags: 'q' signed integer, 'Q' unsigned integer, 'd' floating point, '?' boolean and 's' string
+	*/
+	struct LogField
+	{
+		/**
+		 * @brief The name of the field
+		*/
+		std::string_view Key;
+		/**
+		 * @brief The type tag of the value
+		*/
+		char Type = 's';
+		union
+		{
+			std::int64_t Integer;
+			std::uint64_t Unsigned;
+			double Float;
+			bool Boolean;
+		};
+		/**
+		 * @brief The value of a string field
+		*/
+		std::string_view String;
+
+		/**
+		 * @brief Creates a field from a string, character, boolean, arithmetic or enum value
+		 *
+		 * @param key The name of the field
+		 * @param value The value of the field
+		*/
+		template<typename T>
+		LogField(std::string_view key, const T& value) :
+			Key(key),
+			Integer(0)
+		{
+			if constexpr (std::is_array_v<T> && std::is_convertible_v<const T&, std::string_view>)
+			{
+				String = std::string_view(value);
+			}
+			else if constexpr (std::is_same_v<std::decay_t<T>, char*> || std::is_same_v<std::decay_t<T>, const char*>)
+			{
+				String = value ? std::string_view(value) : std::string_view("(null)");
+			}
+			else if constexpr (std::is_convertible_v<const T&, std::string_view>)
+			{
+				String = std::string_view(value);
+			}
+			else if constexpr (std::is_same_v<T, char>)
+			{
+				String = std::string_view(&value, 1);
+			}
+			else if constexpr (std::is_same_v<T, bool>)
+			{
+				Type = '?';
+				Boolean = value;
+			}
+			else if constexpr (std::is_enum_v<T>)
+			{
+				Type = std::is_signed_v<std::underlying_type_t<T>> ? 'q' : 'Q';
+				Integer = static_cast<std::int64_t>(value);
+			}
+			else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>)
+			{
+				Type = 'q';
+				Integer = value;
+			}
+			else if constexpr (std::is_integral_v<T>)
+			{
+				Type = 'Q';
+				Unsigned = value;
+			}
+			else
+			{
+				static_assert(std::is_floating_point_v<T>, "The log field type is not supported");
+				Type = 'd';
+				Float = static_cast<double>(value);
+			}
+		}
+	};
+
+	/**
+	 * @brief Appends the raw bytes of the field to the destination, so it can be queued without referring to the caller's memory.
+		The key and string values are stored as their length followed by their characters, the other values as 8 bytes
+	 *
+	 * @param destination The string to be appended. Its capacity is reused
+	 * @param field The field to be encoded
+	*/
+	inline void encodeField(std::string& destination, const LogField& field)
+	{
+		const auto& appendString = [&destination](std::string_view string)
+		{
+			const std::size_t length = string.size();
+			destination.append(reinterpret_cast<const char*>(&length), sizeof(length));
+			destination += string;
+		};
+
+		appendString(field.Key);
+		destination += field.Type;
+		if (field.Type == 's')
+		{
+			appendString(field.String);
+		}
+		else
+		{
+			destination.append(reinterpret_cast<const char*>(&field.Unsigned), sizeof(field.Unsigned));
+		}
+	}
+
+	/**
+	 * @brief Calls the visitor with each field encoded by encodeField(). The fields refer to the encoded bytes
+	 *
+	 * @param fields The encoded fields
+	 * @param visitor Callable taking a const LogField&
+	*/
+	template<typename Visitor>
+	void forEachField(std::string_view fields, Visitor&& visitor)
+	{
+		const char* cursor = fields.data();
+		const char* const end = cursor + fields.size();
+
+		const auto& readString = [&cursor]()
+		{
+			std::size_t length;
+			std::memcpy(&length, cursor, sizeof(length));
+			const std::string_view string(cursor + sizeof(length), length);
+			cursor += sizeof(length) + length;
+			return string;
+		};
+
+		while (cursor < end)
+		{
+			LogField field(readString(), std::string_view());
+			field.Type = *cursor++;
+			if (field.Type == 's')
+			{
+				field.String = readString();
+			}
+			else
+			{
+				std::memcpy(&field.Unsigned, cursor, sizeof(field.Unsigned));
+				cursor += sizeof(field.Unsigned);
+			}
+
+			visitor(static_cast<const LogField&>(field));
+		}
+	}
+}
\ No newline at end of file
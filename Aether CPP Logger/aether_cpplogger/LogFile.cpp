@@ -0,0 +1,148 @@
+#include "LogFile.h"
+#include "StatsCollector.h"
+
+#include <algorithm>
+#include <filesystem>
+
+namespace
+{
+	//The largest part of the buffer which is reserved up front
+	constexpr std::size_t MAX_BUFFER_RESERVE = 1048576;
+}
+
+namespace aether_cpplogger
+{
+	LogFile::~LogFile()
+	{
+		close();
+	}
+
+	void LogFile::setFlushPolicy(const FlushPolicy& flushPolicy)
+	{
+		flush();
+
+		m_flushPolicy = flushPolicy;
+		//Large thresholds (e.g. SIZE_MAX to flush only by interval) let the buffer grow on demand instead of reserving all of it
+		m_buffer.reserve(std::min(m_flushPolicy.BufferSize, MAX_BUFFER_RESERVE) + 1024);
+	}
+
+	void LogFile::setStatsCollector(StatsCollector* statsCollector)
+	{
+		m_statsCollector = statsCollector;
+	}
+
+	bool LogFile::open(const std::string& path, const DateTime& dateTime, const int index)
+	{
+		close();
+
+		//The stream is unbuffered, the lines are buffered by this class and written in one call per flush
+		m_stream.rdbuf()->pubsetbuf(nullptr, 0);
+		m_stream.open(path, std::ios::app | std::ios::out | std::ios::binary);
+		if (!m_stream.is_open())
+		{
+			return false;
+		}
+
+		//This is the only time the size is queried from the file system
+		m_year = dateTime.Year;
+		m_month = dateTime.Month;
+		m_day = dateTime.Day;
+		m_index = index;
+		m_size = std::filesystem::file_size(path);
+		m_path = path;
+
+		return true;
+	}
+
+	void LogFile::close()
+	{
+		if (m_stream.is_open())
+		{
+			flush();
+			m_stream.close();
+		}
+		m_buffer.clear();
+		m_year = 0;
+		m_month = 0;
+		m_day = 0;
+		m_index = 1;
+		m_size = 0;
+		m_path.clear();
+	}
+
+	void LogFile::writeLine(std::string_view message, const LogSeverity severity)
+	{
+		m_buffer += message;
+		m_size += message.size();
+
+		write(LINE_ENDING, severity);
+	}
+
+	void LogFile::write(std::string_view data, const LogSeverity severity)
+	{
+		m_buffer += data;
+		m_size += data.size();
+
+		if (m_buffer.size() >= m_flushPolicy.BufferSize ||
+			(m_flushPolicy.FlushOnError && severity == LogSeverity::ERROR) ||
+			isFlushIntervalElapsed())
+		{
+			flush();
+		}
+	}
+
+	void LogFile::flush()
+	{
+		if (!m_buffer.empty() && m_stream.is_open())
+		{
+			LatencyTimer timer(m_statsCollector, LatencyKind::FLUSH);
+			m_stream.write(m_buffer.data(), m_buffer.size());
+			m_stream.flush();
+		}
+		//Clearing keeps the capacity of the buffer
+		m_buffer.clear();
+		m_lastFlush = std::chrono::steady_clock::now();
+	}
+
+	void LogFile::flushIfDue()
+	{
+		if (!m_buffer.empty() && isFlushIntervalElapsed())
+		{
+			flush();
+		}
+	}
+
+	bool LogFile::isFlushIntervalElapsed() const
+	{
+		return m_flushPolicy.Interval.count() > 0 &&
+			std::chrono::steady_clock::now() - m_lastFlush >= m_flushPolicy.Interval;
+	}
+
+	bool LogFile::isOpen() const
+	{
+		return m_stream.is_open();
+	}
+
+	bool LogFile::isSameDate(const DateTime& dateTime) const
+	{
+		return m_stream.is_open() &&
+			m_day == dateTime.Day &&
+			m_month == dateTime.Month &&
+			m_year == dateTime.Year;
+	}
+
+	int LogFile::index() const
+	{
+		return m_index;
+	}
+
+	const std::string& LogFile::path() const
+	{
+		return m_path;
+	}
+
+	std::uintmax_t LogFile::size() const
+	{
+		return m_size;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,155 @@
+#pragma once
+#include "DateTime.h"
+#include "FlushPolicy.h"
+#include "LogSeverity.h"
+
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <string_view>
+
+namespace aether_cpplogger
+{
+	class StatsCollector;
+
+	/**
+	 * @brief Line ending of the log files. The files are written in binary mode so the tracked size matches the size on disk
+	*/
+#ifdef _WIN32
+	constexpr std::string_view LINE_ENDING = "\r\n";
+#else
+	constexpr std::string_view LINE_ENDING = "\n";
+#endif
+
+	/**
+	 * @brief The currently written log file of the Logger.
+	 *
+	 * The file is kept open between the logs and its size is tracked in memory,
+	 * so the file system is only queried when the file is opened.
+	 * The lines are collected in a reusable buffer and written according to the FlushPolicy
+	*/
+	class LogFile
+	{
+	private:
+		std::ofstream m_stream;
+		/**
+		 * @brief The full path of the open file
+		*/
+		std::string m_path;
+		/**
+		 * @brief The date of the file. A new file is needed when the date of the log differs
+		*/
+		int m_year = 0;
+		int m_month = 0;
+		int m_day = 0;
+		/**
+		 * @brief The index of the file within its date
+		*/
+		int m_index = 1;
+		/**
+		 * @brief The size of the file in bytes including everything written through this object
+		*/
+		std::uintmax_t m_size = 0;
+
+		FlushPolicy m_flushPolicy;
+		/**
+		 * @brief The lines which are not yet written to the file
+		*/
+		std::string m_buffer;
+		std::chrono::steady_clock::time_point m_lastFlush = std::chrono::steady_clock::now();
+		/**
+		 * @brief The collector which measures the flushes, nullptr if they are not measured
+		*/
+		StatsCollector* m_statsCollector = nullptr;
+
+		/**
+		 * @brief Checks whether the flush interval of the policy has elapsed
+		*/
+		bool isFlushIntervalElapsed() const;
+
+	public:
+		LogFile() = default;
+		/**
+		 * @brief Writes the buffered lines and closes the file
+		*/
+		~LogFile();
+
+		LogFile(const LogFile&) = delete;
+		LogFile& operator=(const LogFile&) = delete;
+
+		/**
+		 * @brief Sets the policy which defines when the buffered lines are written to the file
+		 *
+		 * @param flushPolicy The new flush policy
+		*/
+		void setFlushPolicy(const FlushPolicy& flushPolicy);
+		/**
+		 * @brief Sets the collector which measures the latency of the flushes
+		 *
+		 * @param statsCollector The collector of the logger, nullptr measures nothing
+		*/
+		void setStatsCollector(StatsCollector* statsCollector);
+		/**
+		 * @brief Opens the given file in append mode. The previously opened file is closed
+		 *
+		 * @param path The full path of the log file
+		 * @param dateTime The date of the log file
+		 * @param index The index of the file within its date
+		 *
+		 * @return True if the file could be opened
+		*/
+		bool open(const std::string& path, const DateTime& dateTime, const int index);
+		/**
+		 * @brief Writes the buffered lines and closes the file if it is open
+		*/
+		void close();
+		/**
+		 * @brief Adds the given message as a new line to the buffer and flushes it if the policy requires
+		 *
+		 * @param message The message to be written
+		 * @param severity The severity of the log. ERROR logs can trigger an immediate flush
+		*/
+		void writeLine(std::string_view message, const LogSeverity severity);
+		/**
+		 * @brief Adds the given bytes to the buffer as they are and flushes it if the policy requires
+		 *
+		 * @param data The bytes to be written
+		 * @param severity The severity of the log. ERROR logs can trigger an immediate flush
+		*/
+		void write(std::string_view data, const LogSeverity severity);
+		/**
+		 * @brief Writes the buffered lines to the file with a single write call
+		*/
+		void flush();
+		/**
+		 * @brief Flushes the buffer if the flush interval of the policy has elapsed
+		*/
+		void flushIfDue();
+
+		/**
+		 * @brief Returns whether a file is currently open
+		*/
+		bool isOpen() const;
+		/**
+		 * @brief Checks whether the open file belongs to the date of the given DateTime
+		 *
+		 * @param dateTime The DateTime to be compared
+		 *
+		 * @return True if a file is open and its date matches
+		*/
+		bool isSameDate(const DateTime& dateTime) const;
+		/**
+		 * @brief Returns the index of the open file within its date
+		*/
+		int index() const;
+		/**
+		 * @brief Returns the full path of the open file. It is empty if no file is open
+		*/
+		const std::string& path() const;
+		/**
+		 * @brief Returns the tracked size of the open file in bytes
+		*/
+		std::uintmax_t size() const;
+	};
+}
\ No newline at end of file
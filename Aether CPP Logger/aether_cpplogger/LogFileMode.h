@@ -0,0 +1,27 @@
+#pragma once
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief Defines how the logs are written to the log file
+	*/
+	enum class LogFileMode
+	{
+		/**
+		 * @brief The lines are collected in a buffer and written with a write call according to the FlushPolicy
+		*/
+		BUFFERED,
+		/**
+		 * @brief The lines are copied directly into a memory-mapped, preallocated log file
+		*/
+		MAPPED,
+		/**
+		 * @brief The logs are written to a binary log file (.logb) without formatting their text. See BinaryLogFormat.h and BinaryLogReader
+		*/
+		BINARY,
+		/**
+		 * @brief The lines are compressed into a .log.gz file while they are written. See CompressedLogFile and CompressionPolicy
+		*/
+		COMPRESSED
+	};
+}
\ No newline at end of file
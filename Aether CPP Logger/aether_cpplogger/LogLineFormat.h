@@ -0,0 +1,23 @@
+#pragma once
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief Defines the layout of the lines written to the text log file and the console
+	*/
+	enum class LogLineFormat
+	{
+		/**
+		 * @brief Tab separated severity, time and message. The fields of structured logs follow the message in logfmt form
+		*/
+		TEXT,
+		/**
+		 * @brief One JSON object per line with the time, severity, message and the fields of the log as its members
+		*/
+		JSON,
+		/**
+		 * @brief One logfmt line of key=value pairs with the time, severity, message and the fields of the log
+		*/
+		LOGFMT
+	};
+}
\ No newline at end of file
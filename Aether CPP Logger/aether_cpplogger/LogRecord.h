@@ -0,0 +1,49 @@
+#pragma once
+#include "CallSite.h"
+#include "LogSeverity.h"
+
+#include <cstdint>
+#include <string>
+#include <thread>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief A single log entry as it is passed from the logging threads to the writer thread in async mode
+	*/
+	struct LogRecord
+	{
+		/**
+		 * @brief The severity of the log
+		*/
+		LogSeverity Severity = LogSeverity::INFO;
+		/**
+		 * @brief The creation time of the log in microseconds since the Unix epoch (see Clock). It is formatted by the writer thread
+		*/
+		std::int64_t Timestamp = 0;
+		/**
+		 * @brief The ID of the thread which made the log
+		*/
+		std::thread::id ThreadId;
+		/**
+		 * @brief The descriptor of the call site if the formatting of this log is deferred to the writer thread, otherwise nullptr
+		*/
+		const CallSite* Site = nullptr;
+		/**
+		 * @brief The raw message of the log without the prefixes. If Site is set, it holds the encoded arguments of the call site instead
+		*/
+		std::string Message;
+		/**
+		 * @brief The fields of a structured log encoded by encodeField(). Empty if the log has no fields
+		*/
+		std::string Fields;
+		/**
+		 * @brief The name of the source file where the log originates. Empty if the log has no source details or Site is set
+		*/
+		std::string Source;
+		/**
+		 * @brief The line number where the log originates
+		*/
+		int Line = 0;
+	};
+}
\ No newline at end of file
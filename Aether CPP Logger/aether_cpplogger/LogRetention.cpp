@@ -0,0 +1,241 @@
+#include "LogRetention.h"
+#include "BinaryLogFormat.h"
+#include "LogCompressor.h"
+#include "Platform.h"
+
+#include <filesystem>
+
+namespace
+{
+	/**
+	 * @brief Returns the number of days since 1970-01-01 of the given civil date
+	*/
+	std::int64_t daysFromCivil(int year, const int month, const int day)
+	{
+		year -= month <= 2;
+		const std::int64_t era = (year >= 0 ? year : year - 399) / 400;
+		const std::int64_t yearOfEra = year - era * 400;
+		const std::int64_t dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+		const std::int64_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+		return era * 146097 + dayOfEra - 719468;
+	}
+
+	bool parseDigits(std::string_view text, int& value)
+	{
+		if (text.empty())
+		{
+			return false;
+		}
+
+		value = 0;
+		for (const char character : text)
+		{
+			if (character < '0' || character > '9')
+			{
+				return false;
+			}
+			value = value * 10 + (character - '0');
+		}
+		return true;
+	}
+
+	bool endsWith(std::string_view text, std::string_view suffix)
+	{
+		return text.size() >= suffix.size() && text.substr(text.size() - suffix.size()) == suffix;
+	}
+
+	/**
+	 * @brief Removes the file and ignores the error if it does not exist
+	*/
+	void removeFile(const std::string& path)
+	{
+		std::error_code error;
+		std::filesystem::remove(path, error);
+	}
+}
+
+namespace aether_cpplogger
+{
+	LogRetention::LogRetention(const RetentionPolicy& policy) :
+		m_policy(policy)
+	{
+	}
+
+	bool LogRetention::parseName(std::string_view filename, SegmentKey& key)
+	{
+		if (endsWith(filename, COMPRESSED_EXTENSION))
+		{
+			filename.remove_suffix(COMPRESSED_EXTENSION.size());
+		}
+		key.Name = filename;
+
+		//The extension of the text or the binary log files
+		const auto extension = filename.rfind(".log");
+		if (extension == std::string_view::npos || (filename.substr(extension) != ".log" && filename.substr(extension) != ".logb"))
+		{
+			return false;
+		}
+		filename = filename.substr(0, extension);
+
+		//The date in YYYY-MM-DD form
+		int year = 0;
+		int month = 0;
+		int day = 0;
+		if (filename.size() < 10 || filename[4] != '-' || filename[7] != '-' ||
+			!parseDigits(filename.substr(0, 4), year) ||
+			!parseDigits(filename.substr(5, 2), month) ||
+			!parseDigits(filename.substr(8, 2), day))
+		{
+			return false;
+		}
+		key.Date = year * 10000 + month * 100 + day;
+
+		//The index suffix is only present from the second file of a date
+		key.Index = 1;
+		filename.remove_prefix(10);
+		if (!filename.empty())
+		{
+			return filename[0] == '_' && parseDigits(filename.substr(1), key.Index);
+		}
+
+		return true;
+	}
+
+	std::uintmax_t LogRetention::segmentSize(const std::string& path)
+	{
+		std::uintmax_t size = 0;
+		for (const auto& filePath : { path, path + std::string(COMPRESSED_EXTENSION), path + std::string(binary_log::INDEX_EXTENSION) })
+		{
+			std::error_code error;
+			const auto fileSize = std::filesystem::file_size(filePath, error);
+			if (!error)
+			{
+				size += fileSize;
+			}
+		}
+		return size;
+	}
+
+	void LogRetention::scan(const std::string& logPath, const std::string& activePath)
+	{
+		m_segments.clear();
+		m_totalSize = 0;
+		m_logPath = logPath;
+
+		SegmentKey activeKey;
+		parseName(std::filesystem::path(activePath).filename().string(), activeKey);
+
+		std::error_code error;
+		for (const auto& entry : std::filesystem::directory_iterator(logPath, error))
+		{
+			SegmentKey key;
+			if (!entry.is_regular_file(error) || !parseName(entry.path().filename().string(), key) || key.Name == activeKey.Name)
+			{
+				continue;
+			}
+
+			//A file and its compressed file are one entry, the path is built like the paths of the Logger
+			if (m_segments.find(key) == m_segments.end())
+			{
+				const std::string path = logPath + PATH_SEPARATOR + key.Name;
+				const auto size = segmentSize(path);
+				m_segments.emplace(std::move(key), Segment{ path, size });
+				m_totalSize += size;
+			}
+		}
+	}
+
+	void LogRetention::updateSegment(const std::string& path)
+	{
+		SegmentKey key;
+		const std::string filename = std::filesystem::path(path).filename().string();
+		if (!parseName(filename, key))
+		{
+			return;
+		}
+
+		//The entry is stored without the compressed extension
+		auto& segment = m_segments[key];
+		m_totalSize -= segment.Size;
+		segment.Path = path.substr(0, path.size() - filename.size()) + key.Name;
+		segment.Size = segmentSize(segment.Path);
+		m_totalSize += segment.Size;
+	}
+
+	void LogRetention::updateCompressedSegments()
+	{
+		//The compressor removes the original file when the compressed file is complete
+		for (auto it = m_pendingCompression.begin(); it != m_pendingCompression.end();)
+		{
+			if (std::filesystem::exists(*it))
+			{
+				++it;
+				continue;
+			}
+
+			updateSegment(*it);
+			it = m_pendingCompression.erase(it);
+		}
+	}
+
+	bool LogRetention::isExpired(const int date, const DateTime& dateTime) const
+	{
+		if (m_policy.MaxAge.count() <= 0)
+		{
+			return false;
+		}
+
+		//The last log of a date is made at the end of the day
+		constexpr std::int64_t secondsPerDay = 86400;
+		const std::int64_t dateEnd = (daysFromCivil(date / 10000, date / 100 % 100, date % 100) + 1) * secondsPerDay;
+		const std::int64_t now = daysFromCivil(dateTime.Year, dateTime.Month, dateTime.Day) * secondsPerDay +
+			dateTime.Hours * 3600 + dateTime.Minutes * 60 + dateTime.Seconds;
+
+		return now - dateEnd >= std::chrono::duration_cast<std::chrono::seconds>(m_policy.MaxAge).count();
+	}
+
+	void LogRetention::addPendingCompression(const std::string& path)
+	{
+		m_pendingCompression.insert(path);
+	}
+
+	void LogRetention::apply(const std::string& logPath, const std::string& activePath, const DateTime& dateTime)
+	{
+		//The previously open file is completed, unless it is continued
+		if (m_logPath != logPath)
+		{
+			scan(logPath, activePath);
+		}
+		else if (!m_activePath.empty() && m_activePath != activePath)
+		{
+			updateSegment(m_activePath);
+		}
+		m_activePath = activePath;
+		updateCompressedSegments();
+
+		//The index is ordered from the oldest file, the deletion stops at the first file which can be kept
+		for (auto it = m_segments.begin(); it != m_segments.end();)
+		{
+			const bool isOverSize = m_policy.MaxTotalSize > 0 && m_totalSize > m_policy.MaxTotalSize;
+			const bool isOverCount = m_policy.MaxFileCount > 0 && m_segments.size() > m_policy.MaxFileCount;
+			if (!isOverSize && !isOverCount && !isExpired(it->first.Date, dateTime))
+			{
+				break;
+			}
+
+			//A file being compressed is deleted by a later call
+			if (m_pendingCompression.count(it->second.Path) > 0)
+			{
+				++it;
+				continue;
+			}
+
+			removeFile(it->second.Path);
+			removeFile(it->second.Path + std::string(COMPRESSED_EXTENSION));
+			removeFile(it->second.Path + std::string(binary_log::INDEX_EXTENSION));
+
+			m_totalSize -= it->second.Size;
+			it = m_segments.erase(it);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,127 @@
+#pragma once
+#include "DateTime.h"
+#include "RetentionPolicy.h"
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <unordered_set>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief Enforces the RetentionPolicy on the log directory.
+	 *
+	 * The directory is scanned once, after that the completed log files are kept in an in-memory index ordered by their date and index.
+	 * The owner reports every opened log file, so enforcing the limits only touches the new and the deleted files.
+	 * A file and its compressed and index files form one entry. Files waiting for compression are not deleted until they are compressed.
+	 * It is not thread safe, the owner must serialize the calls
+	*/
+	class LogRetention
+	{
+	private:
+		/**
+		 * @brief Orders the log files by date, index and name. The name is the file name without the compressed extension
+		*/
+		struct SegmentKey
+		{
+			int Date = 0;
+			int Index = 0;
+			std::string Name;
+
+			bool operator<(const SegmentKey& other) const
+			{
+				return std::tie(Date, Index, Name) < std::tie(other.Date, other.Index, other.Name);
+			}
+		};
+
+		/**
+		 * @brief A completed log file of the index
+		*/
+		struct Segment
+		{
+			/**
+			 * @brief The full path of the file without the compressed extension
+			*/
+			std::string Path;
+			/**
+			 * @brief The size of the files of the entry in bytes
+			*/
+			std::uintmax_t Size = 0;
+		};
+
+		const RetentionPolicy m_policy;
+
+		/**
+		 * @brief The log path the index belongs to. It is empty until the directory is scanned
+		*/
+		std::string m_logPath;
+		/**
+		 * @brief The full path of the open log file of the last call. It is added to the index when another file is opened
+		*/
+		std::string m_activePath;
+		std::map<SegmentKey, Segment> m_segments;
+		std::uintmax_t m_totalSize = 0;
+		/**
+		 * @brief The full paths of the files handed over to the compressor which are not yet known to be compressed
+		*/
+		std::unordered_set<std::string> m_pendingCompression;
+
+		/**
+		 * @brief Parses the date and the index from a log file name e.g.: 2022-03-22_2.log.gz
+		 *
+		 * @param filename The file name without its directory
+		 * @param key Set to the key of the file
+		 *
+		 * @return True if the name is the name of a log file
+		*/
+		static bool parseName(std::string_view filename, SegmentKey& key);
+		/**
+		 * @brief Returns the total size of the files which belong to the given path
+		*/
+		static std::uintmax_t segmentSize(const std::string& path);
+		/**
+		 * @brief Rebuilds the index from the files of the log path. The open log file is left out
+		*/
+		void scan(const std::string& logPath, const std::string& activePath);
+		/**
+		 * @brief Adds the file to the index or updates its size
+		*/
+		void updateSegment(const std::string& path);
+		/**
+		 * @brief Updates the entries of the files which got compressed since the last call
+		*/
+		void updateCompressedSegments();
+		/**
+		 * @brief Checks whether every log of the date is older than the maximal age
+		 *
+		 * @param date The date of a log file in YYYYMMDD form
+		 * @param dateTime The current DateTime
+		*/
+		bool isExpired(const int date, const DateTime& dateTime) const;
+
+	public:
+		/**
+		 * @param policy The limits to be enforced
+		*/
+		explicit LogRetention(const RetentionPolicy& policy);
+
+		/**
+		 * @brief Marks the file as handed over to the compressor, so it is not deleted before it is compressed
+		 *
+		 * @param path The full path of the log file
+		*/
+		void addPendingCompression(const std::string& path);
+		/**
+		 * @brief Adds the previously open log file to the index and deletes the oldest completed log files until every limit
+			of the policy is met. The directory is scanned on the first call and whenever the log path changes
+		 *
+		 * @param logPath The directory of the log files
+		 * @param activePath The full path of the open log file. It is never deleted
+		 * @param dateTime The current DateTime, the age of the log files is measured from it
+		*/
+		void apply(const std::string& logPath, const std::string& activePath, const DateTime& dateTime);
+	};
+}
\ No newline at end of file
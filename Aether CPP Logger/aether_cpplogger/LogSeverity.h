@@ -0,0 +1,63 @@
+#pragma once
+#include <string_view>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief Severity enum class for the Logger.
+		Each log made by the Logger has a severity value.
+		The behaviour of the Logger can be changed according to the selected severity level
+	*/
+	enum class LogSeverity
+	{
+		INFO,
+		WARNING,
+		ERROR,
+		DEBUG,
+		TRACE
+	};
+
+	/**
+	 * @brief Returns the severity prefix of the log message without creating a string
+	*/
+	constexpr std::string_view severityPrefix(const LogSeverity severity)
+	{
+		switch (severity)
+		{
+		case LogSeverity::INFO:
+			return "[INFO]\t\t";
+		case LogSeverity::WARNING:
+			return "[WARNING]\t";
+		case LogSeverity::ERROR:
+			return "[ERROR]\t\t";
+		case LogSeverity::DEBUG:
+			return "[DEBUG]\t\t";
+		case LogSeverity::TRACE:
+			return "[TRACE]\t\t";
+		}
+
+		return std::string_view();
+	}
+
+	/**
+	 * @brief Returns the name of the severity as it appears in structured log lines e.g.: WARNING
+	*/
+	constexpr std::string_view severityName(const LogSeverity severity)
+	{
+		switch (severity)
+		{
+		case LogSeverity::INFO:
+			return "INFO";
+		case LogSeverity::WARNING:
+			return "WARNING";
+		case LogSeverity::ERROR:
+			return "ERROR";
+		case LogSeverity::DEBUG:
+			return "DEBUG";
+		case LogSeverity::TRACE:
+			return "TRACE";
+		}
+
+		return std::string_view();
+	}
+}
\ No newline at end of file
@@ -1,330 +1,266 @@
 #include "Logger.h"
-#include "LoggerException.h"
-
-#include <iostream>
-#include <algorithm>
-
-#include <filesystem>
-#include <fstream>
-
-/**
- * @brief 1MB default log file size limit
-*/
-constexpr int DEFAULT_SIZE_LIMIT = 1048576;
+#include "TimestampCache.h"
 
 namespace aether_cpplogger
 {
-	bool Logger::s_isInitialized = false;
-	std::string Logger::s_logPath = std::string();
-	bool Logger::s_printLog = false;
-	LogSeverity Logger::s_severityLimit = LogSeverity::ERROR;
-	int Logger::s_sizeLimit = DEFAULT_SIZE_LIMIT;
-	std::vector<Receiver*> Logger::s_receivers = std::vector<Receiver*>();
+	LoggerInstance Logger::s_defaultLogger{ std::string_view() };
 
 	void Logger::log(const std::string& message, const LogSeverity severity)
 	{
-		//Check the Logger initialization state
-		if (!s_isInitialized)
-		{
-			throw LoggerException("Logger is not initialized");
-		}
+		s_defaultLogger.log(message, severity);
+	}
 
-		//Check whether the severity of this log exceeds the severity limit
-		if (severity > s_severityLimit)
-		{
-			return;
-		}
+	std::string Logger::createAppDataPath(std::string_view application, std::string_view domain)
+	{
+		return LoggerInstance::createAppDataPath(application, domain);
+	}
 
-		//Get the current DateTime and format the log message
-		const auto& dateTime = currentDateTime();
-		std::string fullMessage = createMessageSeverityPrefix(severity) + createMessageTimePrefix(dateTime) + message;
+	std::string Logger::createMessageSeverityPrefix(const LogSeverity severity)
+	{
+		return LoggerInstance::createMessageSeverityPrefix(severity);
+	}
 
-		writeLogToConsole(fullMessage);
-		writeLogToFile(fullMessage, dateTime);
+	std::string Logger::createMessageTimePrefix(const DateTime& dateTime)
+	{
+		return s_defaultLogger.createMessageTimePrefix(dateTime);
+	}
 
-		notifyReceivers(message);
+	std::string Logger::createDetailedMessage(const std::string& message, std::string_view source, const int line)
+	{
+		return LoggerInstance::createDetailedMessage(message, source, line);
 	}
 
-	std::string Logger::createAppDataPath(std::string_view application, std::string_view domain)
+	void Logger::writeLogToConsole(std::string_view message)
 	{
-		//Get the Roaming AppData folder
-		char* appdataFolder = nullptr;
-		_dupenv_s(&appdataFolder, nullptr, "APPDATA");
+		s_defaultLogger.writeLogToConsole(message);
+	}
 
-		if (appdataFolder)
-		{
-			//If domain was given add it to the log path
-			std::string specifiedApplicationFolder;
-			if (!domain.empty())
-			{
-				specifiedApplicationFolder += "\\";
-				specifiedApplicationFolder += domain;
-			}
+	void Logger::writeLogToFile(std::string_view message, const DateTime& dateTime, const LogSeverity severity)
+	{
+		s_defaultLogger.writeLogToFile(message, dateTime, severity);
+	}
 
-			//Add the application name to the log path
-			specifiedApplicationFolder += "\\";
-			specifiedApplicationFolder += application;
+	void Logger::notifyReceivers(std::string_view message)
+	{
+		RecordView record;
+		record.Timestamp = Clock::now();
+		record.ThreadId = std::this_thread::get_id();
+		record.Message = message;
+		s_defaultLogger.notifyReceivers(record);
+	}
 
-			const std::string& appdataFolderPath = std::string(appdataFolder) + specifiedApplicationFolder + "\\logs";
-			delete appdataFolder;
+	Logger::DateTime Logger::currentDateTime()
+	{
+		return LoggerInstance::currentDateTime();
+	}
 
-			return appdataFolderPath;
-		}
-		else
-		{
-			//Throw exception if the AppData Roaming folder could not be retrieved
-			throw LoggerException("Logger could not be initialized");
-		}
+	void Logger::checkLogPath()
+	{
+		s_defaultLogger.checkLogPath();
 	}
 
-	std::string Logger::createMessageSeverityPrefix(const LogSeverity severity)
+	std::string Logger::checkLogFile(const DateTime& dateTime)
 	{
-		std::string severityPrefix;
-		if (severity == LogSeverity::INFO)
-		{
-			severityPrefix = "[INFO]\t\t";
-		}
-		else if (severity == LogSeverity::WARNING)
-		{
-			severityPrefix = "[WARNING]\t";
-		}
-		else if (severity == LogSeverity::ERROR)
-		{
-			severityPrefix = "[ERROR]\t\t";
-		}
-		else if (severity == LogSeverity::DEBUG)
-		{
-			severityPrefix = "[DEBUG]\t\t";
-		}
-		else if (severity == LogSeverity::TRACE)
-		{
-			severityPrefix = "[TRACE]\t\t";
-		}
+		return s_defaultLogger.checkLogFile(dateTime);
+	}
 
-		return severityPrefix;
+	void Logger::uninitializeLogger()
+	{
+		s_defaultLogger.uninitialize();
 	}
 
-	std::string aether_cpplogger::Logger::createMessageTimePrefix(const DateTime& dateTime)
+	void Logger::init(std::string_view logPath)
 	{
-		return dateTime.currentTimeString() + "\t\t";
+		s_defaultLogger.init(logPath);
 	}
 
-	std::string Logger::createDetailedMessage(const std::string& message, std::string_view source, const int line)
+	void Logger::init(std::string_view logPath, const bool printLog, const LogSeverity severityLimit, const int sizeLimit)
 	{
-		std::string detailedMessage = message;
+		s_defaultLogger.init(logPath, printLog, severityLimit, sizeLimit);
+	}
 
-		//Add the source file to the message
-		detailedMessage += "\t\tSOURCE: ";
-		detailedMessage += source;
+	void Logger::init(const std::string& application, const std::string& domain)
+	{
+		s_defaultLogger.init(application, domain);
+	}
 
-		//Add the source line to the message
-		detailedMessage += "\t\tLINE: ";
-		detailedMessage += std::to_string(line);
+	void Logger::init(const std::string& application, const std::string& domain, const bool printLog, const LogSeverity severityLimit, const int sizeLimit)
+	{
+		s_defaultLogger.init(application, domain, printLog, severityLimit, sizeLimit);
+	}
 
-		return detailedMessage;
+	void Logger::enableAsync()
+	{
+		s_defaultLogger.enableAsync();
 	}
 
-	void Logger::writeLogToConsole(std::string_view message)
+	void Logger::enableAsync(const std::size_t capacity, const OverflowPolicy overflowPolicy)
 	{
-		if (s_printLog)
-		{
-			std::cout << message << std::endl;
-		}
-	}
-
-	void Logger::writeLogToFile(std::string_view message, const DateTime& dateTime)
-	{
-		try
-		{
-			checkLogPath();
-			const auto& currentLogFileName = checkLogFile(dateTime);
-
-			std::ofstream outLogFile;
-			outLogFile.open(s_logPath + "\\" + currentLogFileName, std::ios::app | std::ios::out);
-			if (outLogFile.is_open())
-			{
-				outLogFile << message << std::endl;
-				outLogFile.close();
-			}
-			else
-			{
-				std::cerr << "Log file could not be opened" << std::endl;
-			}
-		}
-		catch (const std::filesystem::filesystem_error& ex)
-		{
-			const std::string exceptionMessage = "!!!Filesystem error!!!" + std::string(ex.what());
-			throw LoggerException(exceptionMessage);
-		}
-		catch (const std::ofstream::failure& ex) {
-			const std::string exceptionMessage = "!!!Log file writing error!!!" + std::string(ex.what());
-			throw LoggerException(exceptionMessage);
-		}
+		s_defaultLogger.enableAsync(capacity, overflowPolicy);
 	}
 
-	void Logger::notifyReceivers(std::string_view message)
+	void Logger::enableAsync(const std::size_t capacity, const OverflowPolicy overflowPolicy, const AsyncQueueMode queueMode)
 	{
-		for (const auto reciever : s_receivers)
-		{
-			reciever->onReceive(message);
-		}
+		s_defaultLogger.enableAsync(capacity, overflowPolicy, queueMode);
 	}
 
-	Logger::DateTime Logger::currentDateTime()
+	void Logger::flush()
 	{
-		const time_t now = time(nullptr);
-		tm ltm;
-		localtime_s(&ltm, &now);
+		s_defaultLogger.flush();
+	}
 
-		DateTime dt;
-		dt.Year = 1900 + ltm.tm_year;
-		dt.Month = 1 + ltm.tm_mon;
-		dt.Day = ltm.tm_mday;
-		dt.Hours = ltm.tm_hour;
-		dt.Minutes = ltm.tm_min;
-		dt.Seconds = ltm.tm_sec;
+	void Logger::setFlushPolicy(const FlushPolicy& flushPolicy)
+	{
+		s_defaultLogger.setFlushPolicy(flushPolicy);
+	}
 
-		return dt;
+	void Logger::setLogFileMode(const LogFileMode logFileMode)
+	{
+		s_defaultLogger.setLogFileMode(logFileMode);
 	}
 
-	void Logger::checkLogPath()
+	void Logger::setCompressionPolicy(const CompressionPolicy& compressionPolicy)
 	{
-		//Check the existence of the log path
-		//and create it if it doe not exist
-		if (!std::filesystem::exists(s_logPath))
-		{
-			std::filesystem::create_directories(s_logPath);
-		}
+		s_defaultLogger.setCompressionPolicy(compressionPolicy);
 	}
 
-	std::string Logger::checkLogFile(const DateTime& dateTime)
+	void Logger::setRetentionPolicy(const RetentionPolicy& retentionPolicy)
 	{
-		std::string filename;
-		const auto& nameBase = dateTime.currentDateString();
-		int logFileIndex = 1;
+		s_defaultLogger.setRetentionPolicy(retentionPolicy);
+	}
 
-		//Check and retrieve the exact name of the log file
-		while (checkLogFileIndexing(nameBase, logFileIndex, filename));
+	void Logger::setRateLimitPolicy(const RateLimitPolicy& rateLimitPolicy)
+	{
+		s_defaultLogger.setRateLimitPolicy(rateLimitPolicy);
+	}
 
-		return filename;
+	void Logger::setSamplingPolicy(const LogSeverity severity, const SamplingPolicy& samplingPolicy)
+	{
+		s_defaultLogger.setSamplingPolicy(severity, samplingPolicy);
 	}
 
-	bool Logger::checkLogFileIndexing(std::string_view nameBase, int& index, std::string& filename)
+	void Logger::setDuplicateSuppression(const bool isSuppressed)
 	{
-		//Index check attempt counter is used to avoid infinite loop
-		//Throw LoggerException if the counter reaches the limit
-		if (const int maxAttempt = 99999; index > maxAttempt)
-		{
-			throw LoggerException("Log file index checking exceeded limit");
-		}
+		s_defaultLogger.setDuplicateSuppression(isSuppressed);
+	}
 
-		//Use the given name base as base of the log file name and modify it according to the current index
-		filename = nameBase;
-		if (index > 1)
-		{
-			filename += "_" + std::to_string(index);
-		}
-		filename += ".log";
+	void Logger::setFlightRecorderPolicy(const FlightRecorderPolicy& flightRecorderPolicy)
+	{
+		s_defaultLogger.setFlightRecorderPolicy(flightRecorderPolicy);
+	}
 
-		//Check the existence of the currently checked log file
-		//If it does not exist than no further size check is needed and return
-		if (!std::filesystem::exists(s_logPath + "\\" + filename))
-		{
-			return false;
-		}
+	void Logger::dumpFlightRecorder()
+	{
+		s_defaultLogger.dumpFlightRecorder();
+	}
 
-		//Check the size of the log file
-		if (const auto fileSize = std::filesystem::file_size(s_logPath + "\\" + filename);
-			fileSize < s_sizeLimit)
-		{
-			return false;
-		}
+	void Logger::shutdown()
+	{
+		s_defaultLogger.shutdown();
+	}
 
-		index += 1;
+	std::uint64_t Logger::droppedRecords()
+	{
+		return s_defaultLogger.droppedRecords();
+	}
 
-		//Return true to countinue the loop
-		return true;
+	std::vector<ThreadDropCount> Logger::droppedRecordsPerThread()
+	{
+		return s_defaultLogger.droppedRecordsPerThread();
 	}
 
-	void Logger::uninitializeLogger()
+	std::uint64_t Logger::rateLimitedRecords()
 	{
-		s_isInitialized = false;
+		return s_defaultLogger.rateLimitedRecords();
 	}
 
-	void Logger::init(std::string_view logPath)
+	std::uint64_t Logger::suppressedDuplicates()
 	{
-		s_isInitialized = true;
-		s_logPath = logPath;
+		return s_defaultLogger.suppressedDuplicates();
 	}
 
-	void Logger::init(std::string_view logPath, const bool printLog, const LogSeverity severityLimit, const int sizeLimit)
+	void Logger::setStatsPolicy(const StatsPolicy& statsPolicy)
 	{
-		s_isInitialized = true;
-		s_logPath = logPath;
-		s_printLog = printLog;
-		s_severityLimit = severityLimit;
-		s_sizeLimit = sizeLimit;
+		s_defaultLogger.setStatsPolicy(statsPolicy);
 	}
 
-	void Logger::init(const std::string& application, const std::string& domain)
+	LoggerStats Logger::stats()
 	{
-		s_logPath = createAppDataPath(application, domain);
+		return s_defaultLogger.stats();
+	}
 
-		s_isInitialized = true;
+	void Logger::setDeferredFormatting(const bool isDeferred)
+	{
+		s_defaultLogger.setDeferredFormatting(isDeferred);
 	}
 
-	void Logger::init(const std::string& application, const std::string& domain, const bool printLog, const LogSeverity severityLimit, const int sizeLimit)
+	bool Logger::isDeferredFormatting()
 	{
-		s_logPath = createAppDataPath(application, domain);
+		return s_defaultLogger.isDeferredFormatting();
+	}
 
-		s_printLog = printLog;
-		s_severityLimit = severityLimit;
-		s_sizeLimit = sizeLimit;
+	void Logger::setTimestampPrecision(const TimestampPrecision timestampPrecision)
+	{
+		s_defaultLogger.setTimestampPrecision(timestampPrecision);
+	}
 
-		s_isInitialized = true;
+	void Logger::setLineFormat(const LogLineFormat lineFormat)
+	{
+		s_defaultLogger.setLineFormat(lineFormat);
 	}
 
 	void Logger::addReceiver(Receiver* receiver)
 	{
-		s_receivers.push_back(receiver);
+		s_defaultLogger.addReceiver(receiver);
+	}
+
+	void Logger::addReceiver(Receiver* receiver, const ReceiverPolicy& receiverPolicy)
+	{
+		s_defaultLogger.addReceiver(receiver, receiverPolicy);
 	}
 
 	void Logger::removeReceiver(Receiver* receiver)
 	{
-		s_receivers.erase(std::find(s_receivers.begin(), s_receivers.end(), receiver));
+		s_defaultLogger.removeReceiver(receiver);
 	}
 
 	void Logger::clearReceivers()
 	{
-		s_receivers.clear();
+		s_defaultLogger.clearReceivers();
+	}
+
+	ReceiverStats Logger::receiverStats(Receiver* receiver)
+	{
+		return s_defaultLogger.receiverStats(receiver);
 	}
 
 	void Logger::logInfo(const std::string& message)
 	{
-		log(message, LogSeverity::INFO);
+		s_defaultLogger.logInfo(message);
 	}
 
 	void Logger::logWarning(const std::string& message)
 	{
-		log(message, LogSeverity::WARNING);
+		s_defaultLogger.logWarning(message);
 	}
 
 	void Logger::logError(const std::string& message)
 	{
-		log(message, LogSeverity::ERROR);
+		s_defaultLogger.logError(message);
 	}
 
 	void Logger::logDebug(const std::string& message, std::string_view source, const int line)
 	{
-		const auto& detailedMessage = createDetailedMessage(message, source, line);
-
-		log(detailedMessage, LogSeverity::DEBUG);
+		s_defaultLogger.logDebug(message, source, line);
 	}
 
 	void Logger::logTrace(const std::string& message, std::string_view source, const int line)
 	{
-		const auto& detailedMessage = createDetailedMessage(message, source, line);
+		s_defaultLogger.logTrace(message, source, line);
+	}
 
-		log(detailedMessage, LogSeverity::TRACE);
+	void Logger::logStructured(const LogSeverity severity, std::string_view message, std::initializer_list<LogField> fields)
+	{
+		s_defaultLogger.logStructured(severity, message, fields);
 	}
 }
\ No newline at end of file
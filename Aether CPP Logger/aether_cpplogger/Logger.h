@@ -1,9 +1,11 @@
 #pragma once
-#include "Receiver.h"
+#include "Export.h"
+#include "LoggerInstance.h"
+#include "LoggerRegistry.h"
 
 #include <string>
+#include <cstdint>
 #include <vector>
-#include <ctime>
 
 #define AETHER_LOG_INIT_1(logPath) aether_cpplogger::Logger::init(logPath)
 #define AETHER_LOG_INIT_1A(logPath, printLog, severityLimit, sizeLimit) aether_cpplogger::Logger::init(logPath, printLog, severityLimit, sizeLimit)
@@ -11,117 +13,148 @@
 #define AETHER_LOG_INIT_2(application, domain) aether_cpplogger::Logger::init(application, domain)
 #define AETHER_LOG_INIT_2A(application, domain, printLog, severityLimit, sizeLimit) aether_cpplogger::Logger::init(application, domain, printLog, severityLimit, sizeLimit)
 
-#define AETHER_LOG_INFO(message) aether_cpplogger::Logger::logInfo(message)
-#define AETHER_LOG_WARNING(message) aether_cpplogger::Logger::logWarning(message)
-#define AETHER_LOG_ERROR(message) aether_cpplogger::Logger::logError(message)
-#define AETHER_LOG_DEBUG(message) aether_cpplogger::Logger::logDebug(message, __FILE__, __LINE__)
-#define AETHER_LOG_TRACE(message) aether_cpplogger::Logger::logTrace(message, __FILE__, __LINE__)
+#define AETHER_LOG_ENABLE_ASYNC() aether_cpplogger::Logger::enableAsync()
+#define AETHER_LOG_ENABLE_ASYNC_A(capacity, overflowPolicy) aether_cpplogger::Logger::enableAsync(capacity, overflowPolicy)
+#define AETHER_LOG_ENABLE_ASYNC_Q(capacity, overflowPolicy, queueMode) aether_cpplogger::Logger::enableAsync(capacity, overflowPolicy, queueMode)
+#define AETHER_LOG_FLUSH() aether_cpplogger::Logger::flush()
+#define AETHER_LOG_FLUSH_POLICY(flushPolicy) aether_cpplogger::Logger::setFlushPolicy(flushPolicy)
+#define AETHER_LOG_FILE_MODE(logFileMode) aether_cpplogger::Logger::setLogFileMode(logFileMode)
+#define AETHER_LOG_COMPRESSION_POLICY(compressionPolicy) aether_cpplogger::Logger::setCompressionPolicy(compressionPolicy)
+#define AETHER_LOG_RETENTION_POLICY(retentionPolicy) aether_cpplogger::Logger::setRetentionPolicy(retentionPolicy)
+#define AETHER_LOG_RATE_LIMIT_POLICY(rateLimitPolicy) aether_cpplogger::Logger::setRateLimitPolicy(rateLimitPolicy)
+#define AETHER_LOG_SAMPLING_POLICY(severity, samplingPolicy) aether_cpplogger::Logger::setSamplingPolicy(severity, samplingPolicy)
+#define AETHER_LOG_DUPLICATE_SUPPRESSION(isSuppressed) aether_cpplogger::Logger::setDuplicateSuppression(isSuppressed)
+#define AETHER_LOG_FLIGHT_RECORDER_POLICY(flightRecorderPolicy) aether_cpplogger::Logger::setFlightRecorderPolicy(flightRecorderPolicy)
+#define AETHER_LOG_DUMP_FLIGHT_RECORDER() aether_cpplogger::Logger::dumpFlightRecorder()
+#define AETHER_LOG_STATS_POLICY(statsPolicy) aether_cpplogger::Logger::setStatsPolicy(statsPolicy)
+#define AETHER_LOG_DEFERRED_FORMATTING(isDeferred) aether_cpplogger::Logger::setDeferredFormatting(isDeferred)
+#define AETHER_LOG_LINE_FORMAT(lineFormat) aether_cpplogger::Logger::setLineFormat(lineFormat)
+#define AETHER_LOG_SHUTDOWN() aether_cpplogger::Logger::shutdown()
+
+//The most verbose severity compiled into the AETHER_LOG_* macros. The macros of the severities over it expand to nothing
+//It can be set before including this header or as a preprocessor definition, e.g. AETHER_LOG_ACTIVE_LEVEL=AETHER_LOG_LEVEL_ERROR
+#define AETHER_LOG_LEVEL_INFO 0
+#define AETHER_LOG_LEVEL_WARNING 1
+#define AETHER_LOG_LEVEL_ERROR 2
+#define AETHER_LOG_LEVEL_DEBUG 3
+#define AETHER_LOG_LEVEL_TRACE 4
+
+#ifndef AETHER_LOG_ACTIVE_LEVEL
+#define AETHER_LOG_ACTIVE_LEVEL AETHER_LOG_LEVEL_TRACE
+#endif
+
+//A single argument is logged as it is, more arguments are formatted: AETHER_LOG_INFO("user {} took {}us", id, duration)
+//The format must be a string literal. Its placeholders are checked against the number of arguments at compile time
+//The arguments are only evaluated if the severity is enabled at runtime
+//The _TO forms log with the given LoggerInstance, e.g. AETHER_LOG_INFO_TO(*networkLogger, "connected to {}", host)
+#define AETHER_LOG_INFO(...) AETHER_LOG_INFO_TO(aether_cpplogger::Logger::defaultLogger(), __VA_ARGS__)
+#define AETHER_LOG_WARNING(...) AETHER_LOG_WARNING_TO(aether_cpplogger::Logger::defaultLogger(), __VA_ARGS__)
+#define AETHER_LOG_ERROR(...) AETHER_LOG_ERROR_TO(aether_cpplogger::Logger::defaultLogger(), __VA_ARGS__)
+#define AETHER_LOG_DEBUG(...) AETHER_LOG_DEBUG_TO(aether_cpplogger::Logger::defaultLogger(), __VA_ARGS__)
+#define AETHER_LOG_TRACE(...) AETHER_LOG_TRACE_TO(aether_cpplogger::Logger::defaultLogger(), __VA_ARGS__)
+
+//Structured logs take a message and typed fields: AETHER_LOG_INFO_FIELDS("request handled", { "user_id", id }, { "latency_us", 1.7 })
+//The fields are only evaluated if the severity is enabled at runtime
+#define AETHER_LOG_INFO_FIELDS(message, ...) AETHER_LOG_INFO_FIELDS_TO(aether_cpplogger::Logger::defaultLogger(), message, __VA_ARGS__)
+#define AETHER_LOG_WARNING_FIELDS(message, ...) AETHER_LOG_WARNING_FIELDS_TO(aether_cpplogger::Logger::defaultLogger(), message, __VA_ARGS__)
+#define AETHER_LOG_ERROR_FIELDS(message, ...) AETHER_LOG_ERROR_FIELDS_TO(aether_cpplogger::Logger::defaultLogger(), message, __VA_ARGS__)
+#define AETHER_LOG_DEBUG_FIELDS(message, ...) AETHER_LOG_DEBUG_FIELDS_TO(aether_cpplogger::Logger::defaultLogger(), message, __VA_ARGS__)
+#define AETHER_LOG_TRACE_FIELDS(message, ...) AETHER_LOG_TRACE_FIELDS_TO(aether_cpplogger::Logger::defaultLogger(), message, __VA_ARGS__)
+
+#if AETHER_LOG_ACTIVE_LEVEL >= AETHER_LOG_LEVEL_INFO
+#define AETHER_LOG_INFO_TO(logger, ...) AETHER_LOG_TO(logger, aether_cpplogger::LogSeverity::INFO, "", 0, __VA_ARGS__)
+#define AETHER_LOG_INFO_FIELDS_TO(logger, message, ...) AETHER_LOG_FIELDS_TO(logger, aether_cpplogger::LogSeverity::INFO, "", 0, message, __VA_ARGS__)
+#else
+#define AETHER_LOG_INFO_TO(logger, ...) ((void)0)
+#define AETHER_LOG_INFO_FIELDS_TO(logger, message, ...) ((void)0)
+#endif
+
+#if AETHER_LOG_ACTIVE_LEVEL >= AETHER_LOG_LEVEL_WARNING
+#define AETHER_LOG_WARNING_TO(logger, ...) AETHER_LOG_TO(logger, aether_cpplogger::LogSeverity::WARNING, "", 0, __VA_ARGS__)
+#define AETHER_LOG_WARNING_FIELDS_TO(logger, message, ...) AETHER_LOG_FIELDS_TO(logger, aether_cpplogger::LogSeverity::WARNING, "", 0, message, __VA_ARGS__)
+#else
+#define AETHER_LOG_WARNING_TO(logger, ...) ((void)0)
+#define AETHER_LOG_WARNING_FIELDS_TO(logger, message, ...) ((void)0)
+#endif
+
+#if AETHER_LOG_ACTIVE_LEVEL >= AETHER_LOG_LEVEL_ERROR
+#define AETHER_LOG_ERROR_TO(logger, ...) AETHER_LOG_TO(logger, aether_cpplogger::LogSeverity::ERROR, "", 0, __VA_ARGS__)
+#define AETHER_LOG_ERROR_FIELDS_TO(logger, message, ...) AETHER_LOG_FIELDS_TO(logger, aether_cpplogger::LogSeverity::ERROR, "", 0, message, __VA_ARGS__)
+#else
+#define AETHER_LOG_ERROR_TO(logger, ...) ((void)0)
+#define AETHER_LOG_ERROR_FIELDS_TO(logger, message, ...) ((void)0)
+#endif
+
+#if AETHER_LOG_ACTIVE_LEVEL >= AETHER_LOG_LEVEL_DEBUG
+#define AETHER_LOG_DEBUG_TO(logger, ...) AETHER_LOG_TO(logger, aether_cpplogger::LogSeverity::DEBUG, __FILE__, __LINE__, __VA_ARGS__)
+#define AETHER_LOG_DEBUG_FIELDS_TO(logger, message, ...) AETHER_LOG_FIELDS_TO(logger, aether_cpplogger::LogSeverity::DEBUG, __FILE__, __LINE__, message, __VA_ARGS__)
+#else
+#define AETHER_LOG_DEBUG_TO(logger, ...) ((void)0)
+#define AETHER_LOG_DEBUG_FIELDS_TO(logger, message, ...) ((void)0)
+#endif
+
+#if AETHER_LOG_ACTIVE_LEVEL >= AETHER_LOG_LEVEL_TRACE
+#define AETHER_LOG_TRACE_TO(logger, ...) AETHER_LOG_TO(logger, aether_cpplogger::LogSeverity::TRACE, __FILE__, __LINE__, __VA_ARGS__)
+#define AETHER_LOG_TRACE_FIELDS_TO(logger, message, ...) AETHER_LOG_FIELDS_TO(logger, aether_cpplogger::LogSeverity::TRACE, __FILE__, __LINE__, message, __VA_ARGS__)
+#else
+#define AETHER_LOG_TRACE_TO(logger, ...) ((void)0)
+#define AETHER_LOG_TRACE_FIELDS_TO(logger, message, ...) ((void)0)
+#endif
+
+//The runtime severity check and the call site check (sampling and rate limit) are a relaxed atomic load each while nothing is limited
+//They run before the arguments are evaluated
+#define AETHER_LOG_TO(logger, severity, source, line, ...) ((logger).isSeverityEnabled(severity) && (logger).isCallSiteAllowed(severity, AETHER_LOG_CALL_SITE_STATE()) ? \
+	AETHER_LOG_EXPAND(AETHER_LOG_CHOOSE(AETHER_LOG_MESSAGE, AETHER_LOG_FORMAT, __VA_ARGS__)(logger, severity, source, line, __VA_ARGS__)) : (void)0)
+
+#define AETHER_LOG_MESSAGE(logger, severity, source, line, message) (logger).logMessage(severity, source, line, message)
+
+#define AETHER_LOG_FIELDS_TO(logger, severity, source, line, message, ...) ((logger).isSeverityEnabled(severity) && (logger).isCallSiteAllowed(severity, AETHER_LOG_CALL_SITE_STATE()) ? \
+	(logger).logStructured(severity, source, line, message, { __VA_ARGS__ }) : (void)0)
+
+//Each call site gets its own static token bucket and sample counter. They are constant initialized, so no initialization guard is checked
+#define AETHER_LOG_CALL_SITE_STATE() ([]() -> aether_cpplogger::CallSiteState& { static aether_cpplogger::CallSiteState callSiteState; return callSiteState; }())
+
+//Each formatted call site gets its own static CallSite descriptor
+#define AETHER_LOG_FORMAT(logger, severity, source, line, format, ...) \
+	[&]() \
+	{ \
+		static_assert(aether_cpplogger::countPlaceholders(format) == decltype(aether_cpplogger::countArguments(__VA_ARGS__))::value, \
+			"The log format is invalid or its {} placeholders do not match the number of arguments"); \
+		using Codec = decltype(aether_cpplogger::argumentCodec(__VA_ARGS__)); \
+		static constexpr aether_cpplogger::CallSite callSite{ severity, format, source, line, &Codec::decode, Codec::TYPES }; \
+		(logger).logFormatted(callSite, __VA_ARGS__); \
+	}()
+
+//Selects the message form for a single argument and the format form for 2 to 16 arguments
+//The extra expansion is needed by the MSVC preprocessor to split __VA_ARGS__ into separate arguments
+#define AETHER_LOG_EXPAND(x) x
+#define AETHER_LOG_SELECT(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, NAME, ...) NAME
+#define AETHER_LOG_CHOOSE(message, format, ...) AETHER_LOG_EXPAND(AETHER_LOG_SELECT(__VA_ARGS__, \
+	format, format, format, format, format, format, format, format, format, format, format, format, format, format, format, message, ))
 
 namespace aether_cpplogger
 {
-	/**
-	 * @brief Severity enum class for the Logger.
-		Each log made by the Logger has a severity value.
-		The behaviour of the Logger can be changed according to the selected severity level
-	*/
-	enum class LogSeverity
-	{
-		INFO,
-		WARNING,
-		ERROR,
-		DEBUG,
-		TRACE
-	};
-
 	/**
 	 * @brief A simple Logger class brought by Aether Projects.
 	 * 
 	 * Easy initialization and usage.
 	 * Information is logged into files and (optionally) the console.
-	 * Logged information is also forwarded to the attached receivers
+	 * Logged information is also forwarded to the attached receivers.
+	 * The static interface works with the default LoggerInstance, further named loggers are available through the LoggerRegistry
 	*/
-	class __declspec(dllexport) Logger
+	class AETHER_CPPLOGGER_API Logger
 	{
 	public:
 		/**
-		 * @brief A structure to handle date and time data
+		 * @brief A structure to handle date and time data. See aether_cpplogger::DateTime
 		*/
-		struct DateTime
-		{
-			/**
-			 * @brief The year this DateTime reflects
-			*/
-			int Year;
-			/**
-			 * @brief The month this DateTime reflects
-			*/
-			int Month;
-			/**
-			 * @brief The day this DateTime reflects
-			*/
-			int Day;
-			/**
-			 * @brief The hours this DateTime reflects
-			*/
-			int Hours;
-			/**
-			 * @brief The minutes this DateTime reflects
-			*/
-			int Minutes;
-			/**
-			 * @brief The seconds this DateTime reflects
-			*/
-			int Seconds;
-
-			/**
-			 * @brief Formats the date related variables into a string
-			 * @return The formatted date related variables as a string e.: 1900-10-13
-			*/
-			std::string currentDateString() const
-			{
-				return std::to_string(Year) + "-" +
-					std::to_string(Month) + "-" +
-					std::to_string(Day);
-			}
-
-			/**
-			 * @brief Formats the time related variables into a string
-			 * @return The formatted time related variables as a string e.: 21:32:18
-			*/
-			std::string currentTimeString() const
-			{
-				return std::to_string(Hours) + ":" +
-					std::to_string(Minutes) + ":" +
-					std::to_string(Seconds);
-			}
-		};
+		using DateTime = aether_cpplogger::DateTime;
 
 	private:
 		/**
-		 * @brief static flag indicating the initialization state of the Logger
+		 * @brief static object of the default logger which is used by the static interface
 		*/
-		static bool s_isInitialized;
-		/**
-		 * @brief static string which holds the path to the log destination folder
-		*/
-		static std::string s_logPath;
-		/**
-		 * @brief static flag which indicates whether the logged information should be printed on the console
-		*/
-		static bool s_printLog;
-		/**
-		 * @brief static enum type variable which indicates the log severity limit. Logs with severity over the limit are discarded
-		*/
-		static LogSeverity s_severityLimit;
-		/**
-		 * @brief static integer which defines the maximum size of a log file
-		*/
-		static int s_sizeLimit;
-
-		/**
-		 * @brief static vector of Receiver type pointers. These stored objects are notified upon each log made
-		*/
-		static std::vector<Receiver*> s_receivers;
+		static LoggerInstance s_defaultLogger;
 
 	protected:
 		/**
@@ -138,6 +171,7 @@ namespace aether_cpplogger
 		 * @param domain (optional)The domain of the application this log is made for. The domain of the application is used in the folder structure.
 		 * 
 		 * @return The path to the log folder in the AppData. e.g.: %APPDATA%\\@p domain (optional)\\@p application\\logs
+			On the other platforms the folder is $XDG_DATA_HOME or ~/.local/share, e.g.: ~/.local/share/@p domain (optional)/@p application/logs
 		*/
 		static std::string createAppDataPath(std::string_view, std::string_view domain);
 		/**
@@ -149,7 +183,7 @@ namespace aether_cpplogger
 		*/
 		static std::string createMessageSeverityPrefix(const LogSeverity severity);
 		/**
-		 * @brief Creates a formatted time prefix for the log message according to the given DateTime
+		 * @brief Creates a formatted time prefix for the log message according to the given DateTime and the timestamp precision
 		 * 
 		 * @param dateTime The DateTime when the log is created at
 		 * 
@@ -177,8 +211,9 @@ namespace aether_cpplogger
 		 * 
 		 * @param message The raw log message which will be prepended with the prefixes
 		 * @param dateTime The creation DateTime of the log. It determines the name of the log file and the time message prefix
+		 * @param severity The severity of the log. It is used by the flush policy
 		*/
-		static void writeLogToFile(std::string_view message, const DateTime& dateTime);
+		static void writeLogToFile(std::string_view message, const DateTime& dateTime, const LogSeverity severity = LogSeverity::INFO);
 		/**
 		 * @brief Notifies the attached receivers by forwarding them the log message
 		 * 
@@ -203,16 +238,6 @@ namespace aether_cpplogger
 		 * @return The calculated name of the log file
 		*/
 		static std::string checkLogFile(const DateTime& dateTime);
-		/**
-		 * @brief Checks the indexing of the log file according to the log file size limitation
-		 * 
-		 * @param nameBase The base name which needs indexing (if needed due to the size limitation)
-		 * @param index The currently checked index
-		 * @param filename The indexed (if needed) log file name
-		 * 
-		 * @return The check status. True if the log file name check was unsuccessful
-		*/
-		static bool checkLogFileIndexing(std::string_view nameBase, int& index, std::string& filename);
 
 		/**
 		 * @brief Sets the initialization flag to false. This is used for testing purposes only
@@ -220,6 +245,14 @@ namespace aether_cpplogger
 		static void uninitializeLogger();
 
 	public:
+		/**
+		 * @brief Returns the default logger which is used by the static interface and the AETHER_LOG_* macros
+		*/
+		static LoggerInstance& defaultLogger()
+		{
+			return s_defaultLogger;
+		}
+
 		/**
 		 * @brief Simple initialization of the Logger. Default value is applied for each optional variable
 		 * 
@@ -254,14 +287,212 @@ namespace aether_cpplogger
 		*/
 		static void init(const std::string& application, const std::string& domain, const bool printLog, const LogSeverity severityLimit, const int sizeLimit);
 
+		/**
+		 * @brief Switches the Logger to async mode with default queue settings.
+			The logs are queued and written to the console, the log file and the receivers by a background thread.
+			The Logger must not be used by other threads while its mode changes
+		*/
+		static void enableAsync();
+		/**
+		 * @brief Switches the Logger to async mode. See enableAsync()
+		 *
+		 * @param capacity The number of logs the queue can hold
+		 * @param overflowPolicy The behaviour when the queue is full
+		*/
+		static void enableAsync(const std::size_t capacity, const OverflowPolicy overflowPolicy);
+		/**
+		 * @brief Switches the Logger to async mode. See enableAsync().
+			In PER_THREAD mode every logging thread pushes into its own queue of the given capacity, which is created on its first log,
+			so the logging threads do not contend on the queue. The writer thread merges the queues by the log timestamps,
+			the logs which are queued at the same time are written in time order. The queue of an exited thread is removed once it is written
+		 *
+		 * @param capacity The number of logs a queue can hold
+		 * @param overflowPolicy The behaviour when a queue is full
+		 * @param queueMode Whether the logging threads share a queue or each of them gets its own
+		*/
+		static void enableAsync(const std::size_t capacity, const OverflowPolicy overflowPolicy, const AsyncQueueMode queueMode);
+		/**
+		 * @brief Blocks until every log queued before this call is written and handed to the isolated receivers,
+			then writes the buffered logs to the log file
+		*/
+		static void flush();
+		/**
+		 * @brief Sets when the buffered logs are written to the log file. By default every log is written immediately
+		 *
+		 * @param flushPolicy The new flush policy
+		*/
+		static void setFlushPolicy(const FlushPolicy& flushPolicy);
+		/**
+		 * @brief Sets how the logs are written to the log file. By default the lines are buffered according to the FlushPolicy.
+			In MAPPED mode each log file is preallocated to the size limit and mapped into memory,
+			the logging threads copy their lines into it without a lock or a system call. The FlushPolicy does not apply to this mode.
+			The unused tail of the file is truncated when the file is rotated or closed. If a log file cannot be preallocated
+			the logger falls back to the BUFFERED mode.
+			In BINARY mode the logs are written to .logb files as the ID of their call site and their encoded arguments,
+			they are converted back to text by BinaryLogReader or the aether_logdecode tool.
+			In COMPRESSED mode the lines are compressed into <name>.log.gz files while they are written. The file is made of
+			frames which are ended according to the CompressionPolicy, every completed frame can be read with gzip tools
+			even if the application crashes. The size limit applies to the uncompressed size
+		 *
+		 * @param logFileMode The new log file mode
+		*/
+		static void setLogFileMode(const LogFileMode logFileMode);
+		/**
+		 * @brief Sets whether and how the completed log files are compressed. By default they are kept as they are.
+			When the Logger moves on to the next log file because of the size limit or the date, the completed file is handed
+			to background threads, compressed to <name>.log.gz and removed. Full log files left by earlier runs are compressed as well.
+			The compressed files keep their index, so the numbering of the log files continues. Binary log files are not compressed
+		 *
+		 * @param compressionPolicy The new compression policy
+		*/
+		static void setCompressionPolicy(const CompressionPolicy& compressionPolicy);
+		/**
+		 * @brief Sets which completed log files are kept in the log directory. By default every log file is kept.
+			The directory is scanned when the first log file is opened, after that the completed files are tracked in memory.
+			Each time the Logger opens a log file the oldest completed files are deleted until the total size, the age and
+			the file count are within the limits. Files waiting for compression are deleted after they are compressed
+		 *
+		 * @param retentionPolicy The new retention policy
+		*/
+		static void setRetentionPolicy(const RetentionPolicy& retentionPolicy);
+		/**
+		 * @brief Sets how many logs each call site of the AETHER_LOG_* macros may make. By default the call sites are not limited.
+			Each call site has a token bucket of its own, which is found without a lookup. When its tokens are used up,
+			its logs are skipped before their arguments are evaluated. The next allowed log of the call site is preceded by a log
+			with the number of skipped logs. The direct log functions are not limited
+		 *
+		 * @param rateLimitPolicy The new rate limit policy
+		*/
+		static void setRateLimitPolicy(const RateLimitPolicy& rateLimitPolicy);
+		/**
+		 * @brief Sets which part of the logs of the severity is kept. By default every log is kept.
+			The logs of the AETHER_LOG_* macros are sampled by a per-thread random number and by a counter of their call site,
+			before their arguments are evaluated. Sampling runs before the rate limit, so the logs which are not kept use no tokens.
+			The direct log functions are not sampled
+		 *
+		 * @param severity The severity to be sampled
+		 * @param samplingPolicy The new sampling policy of the severity
+		*/
+		static void setSamplingPolicy(const LogSeverity severity, const SamplingPolicy& samplingPolicy);
+		/**
+		 * @brief Sets whether the repeats of the previous log are collapsed. By default every log is written.
+			A log with the same severity, message and fields as the previous log of the Logger is skipped and counted.
+			The count is written as "Last message repeated N times" before the next different log, on flush() and on shutdown()
+		 *
+		 * @param isSuppressed The flag which indicates whether repeated logs are skipped
+		*/
+		static void setDuplicateSuppression(const bool isSuppressed);
+		/**
+		 * @brief Sets whether and how the latest logs of each thread are kept in memory. By default nothing is recorded.
+			The flight recorder keeps the logs up to its own severity in a ring of each thread, even the logs which the severity limit
+			discards. The rings are appended to the dump file when an ERROR log is made, when the process receives SIGSEGV, SIGABRT,
+			SIGFPE or SIGILL and on dumpFlightRecorder(). Every dump only contains the records made since the previous dump.
+			The signal handler passes the signal on to the previously installed handler after the dump.
+			The policy may be changed while other threads log, it waits until they no longer use the previous recorder
+		 *
+		 * @param flightRecorderPolicy The new flight recorder policy
+		*/
+		static void setFlightRecorderPolicy(const FlightRecorderPolicy& flightRecorderPolicy);
+		/**
+		 * @brief Appends the records of the flight recorder which were not dumped yet to its dump file.
+			Nothing happens if the flight recorder is disabled or another thread is dumping it
+		*/
+		static void dumpFlightRecorder();
+		/**
+		 * @brief Drains the async queue, stops the background thread and switches the Logger back to sync mode.
+			The log file is closed as well, it is reopened by the next log. It waits until the completed log files are compressed
+		*/
+		static void shutdown();
+		/**
+		 * @brief Returns the number of logs lost because the async queue was full
+		 *
+		 * @return The number of dropped logs since async mode was enabled
+		*/
+		static std::uint64_t droppedRecords();
+		/**
+		 * @brief Returns the number of logs each logging thread lost because its async queue was full.
+			It lists the threads whose queue is in use, the shared queue is listed with a default thread ID
+		 *
+		 * @return The dropped logs of every thread with a queue
+		*/
+		static std::vector<ThreadDropCount> droppedRecordsPerThread();
+		/**
+		 * @brief Returns the number of logs skipped by the rate limit
+		 *
+		 * @return The number of rate limited logs since the Logger was created
+		*/
+		static std::uint64_t rateLimitedRecords();
+		/**
+		 * @brief Returns the number of logs skipped as repeats of the previous log
+		 *
+		 * @return The number of suppressed duplicates since the Logger was created
+		*/
+		static std::uint64_t suppressedDuplicates();
+		/**
+		 * @brief Sets whether the Logger measures its own latencies and how often the receivers get its counters.
+			The counters of the logs, bytes, rotations and errors are always kept in per-thread shards, so counting adds no contention
+			to the logging threads. The reports are made by the writer thread in async mode and by the next log after the interval in sync mode
+		 *
+		 * @param statsPolicy The new stats policy
+		*/
+		static void setStatsPolicy(const StatsPolicy& statsPolicy);
+		/**
+		 * @brief Returns a snapshot of the Logger's own counters: the logs of each severity, the written bytes, the rotations,
+			the errors, the skipped and dropped logs and the latency histograms of the enqueue, the log file writes and the flushes
+		 *
+		 * @return The sum of the counters of every thread
+		*/
+		static LoggerStats stats();
+
+		/**
+		 * @brief Sets whether formatted logs are formatted by the writer thread in async mode.
+			The logging thread then only copies the call site and the raw bytes of the arguments into the queue.
+			It has no effect in sync mode. By default the logging thread formats the logs
+		 *
+		 * @param isDeferred The flag which indicates whether the formatting is deferred to the writer thread
+		*/
+		static void setDeferredFormatting(const bool isDeferred);
+		/**
+		 * @brief Checks whether formatted logs are currently formatted by the writer thread
+		 *
+		 * @return True if the deferred formatting is set and the Logger works in async mode
+		*/
+		static bool isDeferredFormatting();
+
+		/**
+		 * @brief Sets the fractional second digits of the log time prefix. By default only seconds are logged
+		 *
+		 * @param timestampPrecision The new timestamp precision
+		*/
+		static void setTimestampPrecision(const TimestampPrecision timestampPrecision);
+		/**
+		 * @brief Sets the layout of the lines written to the text log file and the console. By default the lines are TEXT.
+			JSON writes one object per line, LOGFMT one line of key=value pairs, both with the time, severity, message
+			and the fields of structured logs, so the lines can be shipped without parsing the text layout.
+			The source details of DEBUG and TRACE logs become the source and line fields. The binary log files are not affected
+		 *
+		 * @param lineFormat The new line format
+		*/
+		static void setLineFormat(const LogLineFormat lineFormat);
+
 		/**
 		 * @brief Adds the given Receiver object to the Logger. The Logger does not take the Receiver object's ownership!
 		 * 
 		 * @param receiver The Receiver object to be added to the Logger
 		*/
 		static void addReceiver(Receiver* receiver);
+		/**
+		 * @brief Adds the given Receiver object to the Logger with the given policy. The Logger does not take the Receiver object's ownership!
+			An isolated receiver is notified on a dispatcher thread of its own, so a slow receiver does not delay the logging threads.
+			It must be removed before it is destroyed, because its queued logs are still delivered
+		 *
+		 * @param receiver The Receiver object to be added to the Logger
+		 * @param receiverPolicy Whether the receiver is notified directly or on a dispatcher thread of its own
+		*/
+		static void addReceiver(Receiver* receiver, const ReceiverPolicy& receiverPolicy);
 		/**
 		 * @brief Removes the given Receiver object from the Logger. The removed object is not deleted!
+			The object can be destroyed after the call. Nothing happens if the receiver is not attached
 		 * 
 		 * @param receiver The Receiver object to be removed from the Logger
 		*/
@@ -270,6 +501,14 @@ namespace aether_cpplogger
 		 * @brief Removes every attached Receiver from the Logger. The removed objects are not deleted!
 		*/
 		static void clearReceivers();
+		/**
+		 * @brief Returns the counters of the given isolated receiver: its lag, its dropped logs and the time it spent in its notifications
+		 *
+		 * @param receiver The attached receiver
+		 *
+		 * @return The counters of the receiver. They are all zero if the receiver is not isolated or not attached
+		*/
+		static ReceiverStats receiverStats(Receiver* receiver);
 
 		/**
 		 * @brief Creates a log with INFO severity
@@ -301,5 +540,37 @@ namespace aether_cpplogger
 		 * @param message The message to be logged
 		*/
 		static void logTrace(const std::string& message, std::string_view source, const int line);
+		/**
+		 * @brief Creates a structured log with the given severity. See LoggerInstance::logStructured()
+		 *
+		 * @param severity The severity of this log
+		 * @param message The message to be logged
+		 * @param fields The typed fields of the log e.g.: { { "user_id", 42 }, { "latency_us", 1.7 } }
+		*/
+		static void logStructured(const LogSeverity severity, std::string_view message, std::initializer_list<LogField> fields);
+
+		/**
+		 * @brief Checks whether a log of the given severity would be made. See LoggerInstance::isSeverityEnabled()
+		 *
+		 * @param severity The severity to be checked
+		 *
+		 * @return False if the severity exceeds the severity limit
+		*/
+		static bool isSeverityEnabled(const LogSeverity severity)
+		{
+			return s_defaultLogger.isSeverityEnabled(severity);
+		}
+
+		/**
+		 * @brief Creates a log from the format of the call site and the given arguments. See LoggerInstance::logFormatted()
+		 *
+		 * @param callSite The static descriptor of the call site
+		 * @param args The arguments to be formatted
+		*/
+		template<typename... Args>
+		static void logFormatted(const CallSite& callSite, const Args&... args)
+		{
+			s_defaultLogger.logFormatted(callSite, args...);
+		}
 	};
 }
\ No newline at end of file
@@ -2,7 +2,7 @@
 
 namespace aether_cpplogger
 {
-	LoggerException::LoggerException(const std::string& message) : std::exception(message.c_str())
+	LoggerException::LoggerException(const std::string& message) : std::runtime_error(message)
 	{
 	}
 }
\ No newline at end of file
@@ -1,5 +1,5 @@
 #pragma once
-#include <exception>
+#include <stdexcept>
 #include <string>
 
 namespace aether_cpplogger
@@ -7,7 +7,7 @@ namespace aether_cpplogger
 	/**
 	 * @brief Custom exception class to handle Logger related errors
 	*/
-	class LoggerException : public std::exception
+	class LoggerException : public std::runtime_error
 	{
 	public:
 		explicit LoggerException(const std::string& message);
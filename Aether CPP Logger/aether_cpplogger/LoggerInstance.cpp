@@ -0,0 +1,1428 @@
+#include "LoggerInstance.h"
+#include "FieldFormat.h"
+#include "LoggerException.h"
+#include "Platform.h"
+#include "TimestampCache.h"
+
+#include <iostream>
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <thread>
+
+/**
+ * @brief 1MB default log file size limit
+*/
+constexpr int DEFAULT_SIZE_LIMIT = 1048576;
+/**
+ * @brief Default number of logs the async queue can hold
+*/
+constexpr std::size_t DEFAULT_ASYNC_CAPACITY = 8192;
+
+namespace
+{
+	/**
+	 * @brief The logger whose writer thread is the calling thread. Its receivers get the logs of this thread in batches
+	*/
+	thread_local const aether_cpplogger::LoggerInstance* t_batchingLogger = nullptr;
+}
+
+namespace aether_cpplogger
+{
+	LoggerInstance::LoggerInstance(std::string_view name) :
+		m_name(name),
+		m_sizeLimit(DEFAULT_SIZE_LIMIT)
+	{
+		m_logFile.setStatsCollector(&m_stats);
+		m_binaryLogFile.setStatsCollector(&m_stats);
+		m_compressedLogFile.setStatsCollector(&m_stats);
+	}
+
+	LoggerInstance::~LoggerInstance()
+	{
+		shutdown();
+		delete m_flightRecorder.load();
+	}
+
+	const std::string& LoggerInstance::name() const
+	{
+		return m_name;
+	}
+
+	void LoggerInstance::log(std::string_view message, const LogSeverity severity, std::string_view fields, std::string_view source, const int line)
+	{
+		//Check the logger initialization state
+		if (!m_isInitialized.load(std::memory_order_relaxed))
+		{
+			throw LoggerException("Logger is not initialized");
+		}
+
+		//The flight recorder keeps the log even if the severity limit discards it
+		if (m_flightRecorder.load(std::memory_order_relaxed))
+		{
+			GracePeriod::ReadGuard guard(m_flightRecorderReaders);
+			auto* flightRecorder = m_flightRecorder.load();
+			if (flightRecorder && severity <= flightRecorder->severity())
+			{
+				recordFlight(*flightRecorder, message, severity, fields);
+			}
+		}
+
+		//Check whether the severity of this log exceeds the severity limit
+		if (severity > m_severityLimit.load(std::memory_order_relaxed))
+		{
+			return;
+		}
+
+		if (m_isDuplicateSuppressed.load(std::memory_order_relaxed) &&
+			isRepeatedLog(DuplicateFilter::hash(fields, DuplicateFilter::hash(message)), severity))
+		{
+			return;
+		}
+
+		submitLog(message, severity, fields, source, line);
+		dumpFlightRecorderOnError(severity);
+
+		//In async mode the writer thread reports the counters
+		if (!m_asyncWriter)
+		{
+			reportStatsIfDue();
+		}
+	}
+
+	void LoggerInstance::recordFlight(FlightRecorder& flightRecorder, std::string_view message, const LogSeverity severity, std::string_view fields)
+	{
+		if (fields.empty())
+		{
+			flightRecorder.record(severity, Clock::now(), message);
+			return;
+		}
+
+		FormatBuffer buffer;
+		auto& text = buffer.get();
+		text += message;
+		text += "\t\t";
+		appendLogfmtFields(text, fields);
+		flightRecorder.record(severity, Clock::now(), text);
+	}
+
+	void LoggerInstance::dumpFlightRecorderOnError(const LogSeverity severity)
+	{
+		if (severity != LogSeverity::ERROR || !m_flightRecorder.load(std::memory_order_relaxed))
+		{
+			return;
+		}
+
+		GracePeriod::ReadGuard guard(m_flightRecorderReaders);
+		auto* flightRecorder = m_flightRecorder.load();
+		if (flightRecorder && flightRecorder->isDumpedOnError())
+		{
+			flightRecorder->dump("ERROR");
+		}
+	}
+
+	void LoggerInstance::submitLog(std::string_view message, const LogSeverity severity, std::string_view fields, std::string_view source, const int line)
+	{
+		m_stats.countRecord(severity);
+		LatencyTimer timer(&m_stats, LatencyKind::ENQUEUE);
+
+		//In async mode only queue the log, the writer thread does the rest
+		const auto timestamp = Clock::now();
+		if (m_asyncWriter)
+		{
+			const auto droppedRecords = m_asyncWriter->push(severity, timestamp, message, nullptr, fields, source, line);
+			if (droppedRecords > 0)
+			{
+				m_stats.countDroppedRecords(droppedRecords);
+			}
+			return;
+		}
+
+		RecordView record;
+		record.Severity = severity;
+		record.Timestamp = timestamp;
+		record.ThreadId = std::this_thread::get_id();
+		record.Source = source;
+		record.Line = line;
+		record.Message = message;
+		dispatchLog(record, fields);
+	}
+
+	bool LoggerInstance::isRepeatedLog(const std::uint64_t key, const LogSeverity severity)
+	{
+		std::uint64_t repeatCount = 0;
+		LogSeverity repeatSeverity = severity;
+		if (m_duplicateFilter.isRepeated(key, severity, repeatCount, repeatSeverity))
+		{
+			return true;
+		}
+
+		if (repeatCount > 0)
+		{
+			submitLog("Last message repeated " + std::to_string(repeatCount) + " times", repeatSeverity);
+		}
+		return false;
+	}
+
+	void LoggerInstance::logPendingRepeats()
+	{
+		std::uint64_t repeatCount = 0;
+		LogSeverity repeatSeverity = LogSeverity::INFO;
+		if (m_isDuplicateSuppressed.load(std::memory_order_relaxed) && m_isInitialized.load(std::memory_order_relaxed) &&
+			m_duplicateFilter.takeRepeats(repeatCount, repeatSeverity))
+		{
+			submitLog("Last message repeated " + std::to_string(repeatCount) + " times", repeatSeverity);
+		}
+	}
+
+	bool LoggerInstance::checkCallSite(const LogSeverity severity, CallSiteState& callSite)
+	{
+		//Sampling comes first, so the logs which are not kept do not use up the tokens
+		const auto checks = m_callSiteChecks.load(std::memory_order_relaxed);
+		if ((checks & samplingCheck(severity)) != 0 && !isSampled(severity, callSite))
+		{
+			m_stats.countSampledOutRecord();
+			return false;
+		}
+		if ((checks & RATE_LIMIT_CHECK) == 0)
+		{
+			return true;
+		}
+
+		if (!callSite.tryAcquire(Clock::now(), m_rateLimitInterval.load(std::memory_order_relaxed), m_rateLimitBurst.load(std::memory_order_relaxed)))
+		{
+			m_stats.countRateLimitedRecord();
+			return false;
+		}
+
+		//The skipped logs are reported before the log of the call site, an uninitialized logger reports the missing initialization instead
+		const auto suppressedRecords = callSite.takeSuppressedRecords();
+		if (suppressedRecords > 0 && m_isInitialized.load(std::memory_order_relaxed) && severity <= m_severityLimit.load(std::memory_order_relaxed))
+		{
+			submitLog("Rate limit skipped " + std::to_string(suppressedRecords) + " logs of the next call site", severity);
+		}
+		return true;
+	}
+
+	bool LoggerInstance::isSampled(const LogSeverity severity, CallSiteState& callSite) const
+	{
+		const auto interval = m_sampling[static_cast<std::size_t>(severity)].Interval.load(std::memory_order_relaxed);
+		return interval <= 1 || callSite.isSampled(interval);
+	}
+
+	std::atomic<std::uint64_t>& LoggerInstance::sampledOutCounter()
+	{
+		return m_stats.sampledOutCounter();
+	}
+
+	void LoggerInstance::logDeferred(const CallSite& callSite, std::string_view arguments)
+	{
+		if (!m_isInitialized.load(std::memory_order_relaxed))
+		{
+			throw LoggerException("Logger is not initialized");
+		}
+
+		//The flight recorder keeps the formatted message even if the severity limit discards the log
+		if (m_flightRecorder.load(std::memory_order_relaxed))
+		{
+			GracePeriod::ReadGuard guard(m_flightRecorderReaders);
+			auto* flightRecorder = m_flightRecorder.load();
+			if (flightRecorder && callSite.Severity <= flightRecorder->severity())
+			{
+				FormatBuffer buffer;
+				auto& message = buffer.get();
+				callSite.Decode(message, callSite.Format, arguments.data());
+				recordFlight(*flightRecorder, message, callSite.Severity);
+			}
+		}
+
+		if (callSite.Severity > m_severityLimit.load(std::memory_order_relaxed))
+		{
+			return;
+		}
+
+		//The call site and the encoded arguments identify the formatted message
+		if (m_isDuplicateSuppressed.load(std::memory_order_relaxed))
+		{
+			const auto* site = &callSite;
+			const auto siteKey = DuplicateFilter::hash(std::string_view(reinterpret_cast<const char*>(&site), sizeof(site)));
+			if (isRepeatedLog(DuplicateFilter::hash(arguments, siteKey), callSite.Severity))
+			{
+				return;
+			}
+		}
+
+		m_stats.countRecord(callSite.Severity);
+		{
+			LatencyTimer timer(&m_stats, LatencyKind::ENQUEUE);
+			const auto timestamp = Clock::now();
+			if (m_asyncWriter)
+			{
+				const auto droppedRecords = m_asyncWriter->push(callSite.Severity, timestamp, arguments, &callSite);
+				if (droppedRecords > 0)
+				{
+					m_stats.countDroppedRecords(droppedRecords);
+				}
+			}
+			else
+			{
+				//Without a writer thread the log is formatted right away
+				dispatchEncodedLog(callSite, arguments, timestamp, std::this_thread::get_id());
+			}
+		}
+		dumpFlightRecorderOnError(callSite.Severity);
+
+		if (!m_asyncWriter)
+		{
+			reportStatsIfDue();
+		}
+	}
+
+	void LoggerInstance::formatEncodedMessage(std::string& message, std::string& fields, const CallSite& callSite, const char* arguments) const
+	{
+		callSite.Decode(message, callSite.Format, arguments);
+
+		if (!callSite.Source.empty())
+		{
+			addSourceDetails(message, fields, callSite.Source, callSite.Line);
+		}
+	}
+
+	bool LoggerInstance::hasSourceFields() const
+	{
+		return m_lineFormat.load(std::memory_order_relaxed) != LogLineFormat::TEXT &&
+			m_logFileMode.load(std::memory_order_relaxed) != LogFileMode::BINARY;
+	}
+
+	void LoggerInstance::addSourceDetails(std::string& message, std::string& fields, std::string_view source, const int line) const
+	{
+		if (hasSourceFields())
+		{
+			encodeField(fields, LogField("source", source));
+			encodeField(fields, LogField("line", line));
+		}
+		else
+		{
+			appendSourceDetails(message, source, line);
+		}
+	}
+
+	void LoggerInstance::dispatchLog(const RecordView& record, std::string_view fields)
+	{
+		const bool isBinary = m_logFileMode.load(std::memory_order_relaxed) == LogFileMode::BINARY;
+		if (isBinary)
+		{
+			if (fields.empty())
+			{
+				writeLogToBinaryFile(nullptr, record.Message, record.Severity, record.Timestamp);
+			}
+			else
+			{
+				//Binary log files are decoded to TEXT lines, so the fields are stored after the message in the same form
+				FormatBuffer buffer;
+				auto& text = buffer.get();
+				text += record.Message;
+				text += "\t\t";
+				appendLogfmtFields(text, fields);
+				writeLogToBinaryFile(nullptr, text, record.Severity, record.Timestamp);
+			}
+		}
+
+		writeLogOutputs(record, fields, !isBinary);
+	}
+
+	void LoggerInstance::dispatchEncodedLog(const CallSite& callSite, std::string_view arguments, const std::int64_t timestamp, const std::thread::id threadId)
+	{
+		const bool isBinary = m_logFileMode.load(std::memory_order_relaxed) == LogFileMode::BINARY;
+		if (isBinary)
+		{
+			writeLogToBinaryFile(&callSite, arguments, callSite.Severity, timestamp);
+
+			//The message is only formatted if someone reads it
+			if (!m_printLog.load(std::memory_order_relaxed) && m_receivers.empty())
+			{
+				return;
+			}
+		}
+
+		FormatBuffer buffer;
+		FormatBuffer fieldBuffer;
+		formatEncodedMessage(buffer.get(), fieldBuffer.get(), callSite, arguments.data());
+
+		RecordView record;
+		record.Severity = callSite.Severity;
+		record.Timestamp = timestamp;
+		record.ThreadId = threadId;
+		record.Source = callSite.Source;
+		record.Line = callSite.Line;
+		record.Message = buffer.get();
+		writeLogOutputs(record, fieldBuffer.get(), !isBinary);
+	}
+
+	void LoggerInstance::writeLogOutputs(const RecordView& record, std::string_view fields, const bool isTextFileWritten)
+	{
+		//The line is only needed by the console and the text log file
+		if (isTextFileWritten || m_printLog.load(std::memory_order_relaxed))
+		{
+			const auto& message = record.Message;
+			const auto severity = record.Severity;
+
+			//Each thread keeps its own cache so the local time is only broken down when the second changes
+			thread_local TimestampCache timestampCache;
+			timestampCache.update(record.Timestamp);
+			const auto& time = timestampCache.timeString(m_timestampPrecision.load(std::memory_order_relaxed));
+
+			//Format the log line in a reused per-thread buffer
+			FormatBuffer buffer;
+			auto& fullMessage = buffer.get();
+			switch (m_lineFormat.load(std::memory_order_relaxed))
+			{
+			case LogLineFormat::JSON:
+				appendJsonLine(fullMessage, timestampCache.dateString(), time, severity, message, fields);
+				break;
+			case LogLineFormat::LOGFMT:
+				appendLogfmtLine(fullMessage, timestampCache.dateString(), time, severity, message, fields);
+				break;
+			default:
+				fullMessage += severityPrefix(severity);
+				fullMessage += time;
+				fullMessage += "\t\t";
+				fullMessage += message;
+				if (!fields.empty())
+				{
+					fullMessage += "\t\t";
+					appendLogfmtFields(fullMessage, fields);
+				}
+				break;
+			}
+
+			writeLogToConsole(fullMessage);
+			if (isTextFileWritten)
+			{
+				writeLogToFile(fullMessage, timestampCache.dateTime(), severity);
+			}
+		}
+
+		notifyReceivers(record);
+	}
+
+	void LoggerInstance::writeAsyncRecord(const LogRecord& record)
+	{
+		t_batchingLogger = this;
+
+		//Deferred logs carry the encoded arguments of their call site instead of the message
+		if (record.Site)
+		{
+			dispatchEncodedLog(*record.Site, record.Message, record.Timestamp, record.ThreadId);
+			return;
+		}
+
+		RecordView view;
+		view.Severity = record.Severity;
+		view.Timestamp = record.Timestamp;
+		view.ThreadId = record.ThreadId;
+		view.Source = record.Source;
+		view.Line = record.Line;
+		view.Message = record.Message;
+		dispatchLog(view, record.Fields);
+	}
+
+	std::string LoggerInstance::createAppDataPath(std::string_view application, std::string_view domain)
+	{
+		//Get the Roaming AppData folder (the user data folder on the other platforms)
+		const auto& appdataFolder = userDataFolder();
+
+		if (!appdataFolder.empty())
+		{
+			//If domain was given add it to the log path
+			std::string specifiedApplicationFolder;
+			if (!domain.empty())
+			{
+				specifiedApplicationFolder += PATH_SEPARATOR;
+				specifiedApplicationFolder += domain;
+			}
+
+			//Add the application name to the log path
+			specifiedApplicationFolder += PATH_SEPARATOR;
+			specifiedApplicationFolder += application;
+
+			return appdataFolder + specifiedApplicationFolder + PATH_SEPARATOR + "logs";
+		}
+		else
+		{
+			//Throw exception if the AppData Roaming folder could not be retrieved
+			throw LoggerException("Logger could not be initialized");
+		}
+	}
+
+	std::string LoggerInstance::createMessageSeverityPrefix(const LogSeverity severity)
+	{
+		return std::string(severityPrefix(severity));
+	}
+
+	std::string LoggerInstance::createMessageTimePrefix(const DateTime& dateTime) const
+	{
+		return dateTime.currentTimeString(m_timestampPrecision.load(std::memory_order_relaxed)) + "\t\t";
+	}
+
+	void LoggerInstance::appendSourceDetails(std::string& message, std::string_view source, const int line)
+	{
+		//Add the source file to the message
+		message += "\t\tSOURCE: ";
+		message += source;
+
+		//Add the source line to the message
+		char lineBuffer[16];
+		const auto result = std::to_chars(lineBuffer, lineBuffer + sizeof(lineBuffer), line);
+		message += "\t\tLINE: ";
+		message.append(lineBuffer, result.ptr);
+	}
+
+	std::string LoggerInstance::createDetailedMessage(const std::string& message, std::string_view source, const int line)
+	{
+		std::string detailedMessage = message;
+		appendSourceDetails(detailedMessage, source, line);
+
+		return detailedMessage;
+	}
+
+	void LoggerInstance::writeLogToConsole(std::string_view message) const
+	{
+		if (m_printLog.load(std::memory_order_relaxed))
+		{
+			std::cout << message << std::endl;
+		}
+	}
+
+	void LoggerInstance::writeLogToFile(std::string_view message, const DateTime& dateTime, const LogSeverity severity)
+	{
+		LatencyTimer timer(&m_stats, LatencyKind::WRITE);
+
+		//Mapped lines are copied without the lock, it is only taken to rotate the file
+		if (m_logFileMode.load(std::memory_order_relaxed) == LogFileMode::MAPPED && m_mappedLogFile.writeLine(message, dateTime))
+		{
+			m_stats.countBytes(message.size() + LINE_ENDING.size());
+			return;
+		}
+
+		try
+		{
+			std::lock_guard lock(m_logFileMutex);
+
+			if (m_logFileMode.load(std::memory_order_relaxed) == LogFileMode::MAPPED && writeLogToMappedFile(message, dateTime))
+			{
+				return;
+			}
+
+			if (m_logFileMode.load(std::memory_order_relaxed) == LogFileMode::COMPRESSED)
+			{
+				if (!m_compressedLogFile.isOpen() ||
+					m_compressedLogFile.size() >= static_cast<std::uintmax_t>(m_sizeLimit.load(std::memory_order_relaxed)) ||
+					!m_compressedLogFile.isSameDate(dateTime))
+				{
+					openCompressedLogFile(dateTime);
+				}
+
+				if (m_compressedLogFile.isOpen())
+				{
+					m_compressedLogFile.writeLine(message);
+					m_stats.countBytes(message.size() + LINE_ENDING.size());
+				}
+				else
+				{
+					std::cerr << "Log file could not be opened" << std::endl;
+				}
+				return;
+			}
+
+			//Look up the log file only if there is no open one, the date changed or the open one is full
+			if (!m_logFile.isOpen() ||
+				m_logFile.size() >= static_cast<std::uintmax_t>(m_sizeLimit.load(std::memory_order_relaxed)) ||
+				!m_logFile.isSameDate(dateTime))
+			{
+				openLogFile(dateTime);
+			}
+
+			if (m_logFile.isOpen())
+			{
+				m_logFile.writeLine(message, severity);
+				m_stats.countBytes(message.size() + LINE_ENDING.size());
+			}
+			else
+			{
+				std::cerr << "Log file could not be opened" << std::endl;
+			}
+		}
+		catch (const std::filesystem::filesystem_error& ex)
+		{
+			m_stats.countException();
+			const std::string exceptionMessage = "!!!Filesystem error!!!" + std::string(ex.what());
+			throw LoggerException(exceptionMessage);
+		}
+		catch (const std::ofstream::failure& ex) {
+			m_stats.countException();
+			const std::string exceptionMessage = "!!!Log file writing error!!!" + std::string(ex.what());
+			throw LoggerException(exceptionMessage);
+		}
+	}
+
+	void LoggerInstance::writeLogToBinaryFile(const CallSite* callSite, std::string_view data, const LogSeverity severity, const std::int64_t timestamp)
+	{
+		LatencyTimer timer(&m_stats, LatencyKind::WRITE);
+
+		//The date is only needed to pick the log file
+		thread_local TimestampCache timestampCache;
+		timestampCache.update(timestamp);
+		const auto& dateTime = timestampCache.dateTime();
+
+		try
+		{
+			std::lock_guard lock(m_logFileMutex);
+
+			if (!m_binaryLogFile.isOpen() ||
+				m_binaryLogFile.size() >= static_cast<std::uintmax_t>(m_sizeLimit.load(std::memory_order_relaxed)) ||
+				!m_binaryLogFile.isSameDate(dateTime))
+			{
+				openBinaryLogFile(dateTime);
+			}
+
+			if (!m_binaryLogFile.isOpen())
+			{
+				std::cerr << "Log file could not be opened" << std::endl;
+				return;
+			}
+
+			//The record is encoded by the file, its size is the growth of the file
+			const auto previousSize = m_binaryLogFile.size();
+			if (callSite)
+			{
+				m_binaryLogFile.writeFormatted(*callSite, data, timestamp);
+			}
+			else
+			{
+				m_binaryLogFile.writeMessage(data, severity, timestamp);
+			}
+			m_stats.countBytes(m_binaryLogFile.size() - previousSize);
+		}
+		catch (const std::filesystem::filesystem_error& ex)
+		{
+			m_stats.countException();
+			const std::string exceptionMessage = "!!!Filesystem error!!!" + std::string(ex.what());
+			throw LoggerException(exceptionMessage);
+		}
+	}
+
+	void LoggerInstance::notifyReceivers(const RecordView& record)
+	{
+		//The writer thread collects its logs, the receivers get them when the batch ends
+		if (t_batchingLogger == this)
+		{
+			if (!m_receivers.empty())
+			{
+				m_receiverBatch.add(record);
+			}
+			return;
+		}
+
+		m_receivers.notify(record);
+	}
+
+	void LoggerInstance::notifyReceiverBatch()
+	{
+		if (m_receiverBatch.size() == 0)
+		{
+			return;
+		}
+
+		//A receiver which logs while the writer thread is stopping is notified directly, so the batch is not changed during the call
+		t_batchingLogger = nullptr;
+		m_receivers.notifyBatch(m_receiverBatch.views(), m_receiverBatch.size());
+		m_receiverBatch.clear();
+		t_batchingLogger = this;
+	}
+
+	void LoggerInstance::reportStatsIfDue()
+	{
+		const auto interval = m_statsReportInterval.load(std::memory_order_relaxed);
+		if (interval == 0)
+		{
+			return;
+		}
+
+		//The thread which moves the time of the next report forward makes the report
+		const auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+		auto nextReport = m_nextStatsReport.load(std::memory_order_relaxed);
+		if (now < nextReport || !m_nextStatsReport.compare_exchange_strong(nextReport, now + interval, std::memory_order_relaxed))
+		{
+			return;
+		}
+
+		m_receivers.notifyStats(stats());
+	}
+
+	LoggerInstance::DateTime LoggerInstance::currentDateTime()
+	{
+		return Clock::toDateTime(Clock::now());
+	}
+
+	void LoggerInstance::checkLogPath() const
+	{
+		//Check the existence of the log path
+		//and create it if it doe not exist
+		if (!std::filesystem::exists(m_logPath))
+		{
+			std::filesystem::create_directories(m_logPath);
+		}
+	}
+
+	std::string LoggerInstance::checkLogFile(const DateTime& dateTime) const
+	{
+		int logFileIndex = 1;
+		return checkLogFile(dateTime, logFileIndex);
+	}
+
+	std::string LoggerInstance::checkLogFile(const DateTime& dateTime, int& index) const
+	{
+		std::string filename;
+		const auto& nameBase = dateTime.currentDateString();
+
+		//A new lookup starts at the highest existing index instead of probing every index from the first one
+		if (index == 1)
+		{
+			index = findLastLogFileIndex(nameBase);
+		}
+
+		//Check and retrieve the exact name of the log file
+		while (checkLogFileIndexing(nameBase, index, filename));
+
+		return filename;
+	}
+
+	bool LoggerInstance::checkLogFileIndexing(std::string_view nameBase, int& index, std::string& filename) const
+	{
+		//The lookup starts at the highest existing index, so it only steps over the files of the day and needs no attempt limit.
+		//Retention deletes the old files but keeps the numbering, so only the range of the index is checked
+		if (index == std::numeric_limits<int>::max())
+		{
+			throw LoggerException("Log file index exceeded the largest index");
+		}
+
+		//Use the given name base as base of the log file name and modify it according to the current index
+		filename = nameBase;
+		if (index > 1)
+		{
+			filename += "_" + std::to_string(index);
+		}
+		filename += logFileExtension();
+
+		//A single stat tells whether the log file exists and how large it is
+		const std::string path = m_logPath + PATH_SEPARATOR + filename;
+		std::error_code error;
+		const auto fileSize = std::filesystem::file_size(path, error);
+		if (error)
+		{
+			//A compressed log file is always completed, its index is taken
+			if (!std::filesystem::exists(path + std::string(COMPRESSED_EXTENSION)))
+			{
+				return false;
+			}
+
+			index += 1;
+			return true;
+		}
+
+		//Check the size of the log file
+		//The COMPRESSED mode creates a new file, so the plain file of the index is not continued
+		const auto logFileMode = m_logFileMode.load(std::memory_order_relaxed);
+		const bool isFull = fileSize >= static_cast<std::uintmax_t>(m_sizeLimit.load(std::memory_order_relaxed));
+		if (!isFull && logFileMode != LogFileMode::COMPRESSED)
+		{
+			return false;
+		}
+
+		//A full text log file left by an earlier run is completed as well
+		if (isFull && logFileMode != LogFileMode::BINARY)
+		{
+			compressLogFile(path);
+		}
+
+		index += 1;
+
+		//Return true to countinue the loop
+		return true;
+	}
+
+	int LoggerInstance::findLastLogFileIndex(std::string_view nameBase) const
+	{
+		const auto extension = logFileExtension();
+		const bool isBinary = m_logFileMode.load(std::memory_order_relaxed) == LogFileMode::BINARY;
+
+		int lastIndex = 1;
+		std::vector<std::pair<int, std::string>> plainFiles;
+
+		std::error_code error;
+		for (const auto& entry : std::filesystem::directory_iterator(m_logPath, error))
+		{
+			//The name is the name base, the optional _<index> suffix, the extension and the optional compressed extension
+			const std::string filename = entry.path().filename().string();
+			std::string_view name = filename;
+			if (name.substr(0, nameBase.size()) != nameBase)
+			{
+				continue;
+			}
+			name.remove_prefix(nameBase.size());
+
+			const bool isCompressed = !isBinary && name.size() > COMPRESSED_EXTENSION.size() &&
+				name.substr(name.size() - COMPRESSED_EXTENSION.size()) == COMPRESSED_EXTENSION;
+			if (isCompressed)
+			{
+				name.remove_suffix(COMPRESSED_EXTENSION.size());
+			}
+			if (name.size() < extension.size() || name.substr(name.size() - extension.size()) != extension)
+			{
+				continue;
+			}
+			name.remove_suffix(extension.size());
+
+			int index = 1;
+			if (!name.empty())
+			{
+				if (name.size() < 2 || name[0] != '_' ||
+					std::from_chars(name.data() + 1, name.data() + name.size(), index).ptr != name.data() + name.size())
+				{
+					continue;
+				}
+			}
+
+			lastIndex = std::max(lastIndex, index);
+			if (!isCompressed)
+			{
+				plainFiles.emplace_back(index, filename);
+			}
+		}
+
+		//The plain files before the last one are completed, they are compressed without checking their size
+		if (m_logCompressor && !isBinary)
+		{
+			for (const auto& [index, filename] : plainFiles)
+			{
+				if (index < lastIndex)
+				{
+					compressLogFile(m_logPath + PATH_SEPARATOR + filename);
+				}
+			}
+		}
+
+		return lastIndex;
+	}
+
+	void LoggerInstance::openLogFile(const DateTime& dateTime)
+	{
+		//A full log file of the same date is continued with the next index, otherwise the indexing starts over
+		//The open file is completed, it is either full or belongs to an earlier date
+		int logFileIndex = 1;
+		std::string completedPath;
+		if (m_logFile.isOpen())
+		{
+			m_stats.countRotation();
+			completedPath = m_logFile.path();
+			if (m_logFile.isSameDate(dateTime))
+			{
+				logFileIndex = m_logFile.index() + 1;
+			}
+		}
+		m_logFile.close();
+		compressLogFile(completedPath);
+
+		checkLogPath();
+		const auto& logFileName = checkLogFile(dateTime, logFileIndex);
+
+		m_logFile.open(m_logPath + PATH_SEPARATOR + logFileName, dateTime, logFileIndex);
+		applyRetention(m_logFile.path(), dateTime);
+	}
+
+	bool LoggerInstance::writeLogToMappedFile(std::string_view message, const DateTime& dateTime)
+	{
+		//Another thread may have rotated the file while this one waited for the lock, so the line is tried again first
+		while (!m_mappedLogFile.writeLine(message, dateTime))
+		{
+			if (!openMappedLogFile(dateTime, message.size() + LINE_ENDING.size()))
+			{
+				//A file which cannot be preallocated is written through the stream instead of risking SIGBUS
+				std::cerr << "Log file could not be mapped, falling back to the BUFFERED log file mode" << std::endl;
+				m_logFileMode.store(LogFileMode::BUFFERED, std::memory_order_relaxed);
+				return false;
+			}
+		}
+		m_stats.countBytes(message.size() + LINE_ENDING.size());
+
+		return true;
+	}
+
+	bool LoggerInstance::openMappedLogFile(const DateTime& dateTime, const std::size_t lineSize)
+	{
+		//The open file of the same date is full, otherwise the indexing starts over
+		int logFileIndex = 1;
+		std::string completedPath;
+		if (m_mappedLogFile.isOpen())
+		{
+			m_stats.countRotation();
+			completedPath = m_mappedLogFile.path();
+			if (m_mappedLogFile.isSameDate(dateTime))
+			{
+				logFileIndex = m_mappedLogFile.index() + 1;
+			}
+		}
+		//Closing truncates the unused tail, so the completed file can be compressed
+		m_mappedLogFile.close();
+		compressLogFile(completedPath);
+
+		checkLogPath();
+		const auto& logFileName = checkLogFile(dateTime, logFileIndex);
+
+		const auto sizeLimit = static_cast<std::size_t>(m_sizeLimit.load(std::memory_order_relaxed));
+		const bool isOpen = m_mappedLogFile.open(m_logPath + PATH_SEPARATOR + logFileName, dateTime, logFileIndex, std::max(sizeLimit, lineSize));
+		applyRetention(m_mappedLogFile.path(), dateTime);
+
+		return isOpen;
+	}
+
+	void LoggerInstance::openBinaryLogFile(const DateTime& dateTime)
+	{
+		int logFileIndex = 1;
+		if (m_binaryLogFile.isOpen())
+		{
+			m_stats.countRotation();
+			if (m_binaryLogFile.isSameDate(dateTime))
+			{
+				logFileIndex = m_binaryLogFile.index() + 1;
+			}
+		}
+		m_binaryLogFile.close();
+
+		checkLogPath();
+		const auto& logFileName = checkLogFile(dateTime, logFileIndex);
+
+		m_binaryLogFile.open(m_logPath + PATH_SEPARATOR + logFileName, dateTime, logFileIndex);
+		applyRetention(m_binaryLogFile.path(), dateTime);
+	}
+
+	void LoggerInstance::openCompressedLogFile(const DateTime& dateTime)
+	{
+		int logFileIndex = 1;
+		if (m_compressedLogFile.isOpen())
+		{
+			m_stats.countRotation();
+			if (m_compressedLogFile.isSameDate(dateTime))
+			{
+				logFileIndex = m_compressedLogFile.index() + 1;
+			}
+		}
+		m_compressedLogFile.close();
+
+		checkLogPath();
+		const auto& logFileName = checkLogFile(dateTime, logFileIndex);
+
+		//The index check skips every index with a compressed file, so an earlier file is never overwritten
+		m_compressedLogFile.open(m_logPath + PATH_SEPARATOR + logFileName + std::string(COMPRESSED_EXTENSION), dateTime, logFileIndex);
+		applyRetention(m_compressedLogFile.path(), dateTime);
+	}
+
+	std::string_view LoggerInstance::logFileExtension() const
+	{
+		return m_logFileMode.load(std::memory_order_relaxed) == LogFileMode::BINARY ? ".logb" : ".log";
+	}
+
+	void LoggerInstance::compressLogFile(const std::string& path) const
+	{
+		if (m_logCompressor && !path.empty())
+		{
+			m_logCompressor->enqueue(path);
+			if (m_logRetention)
+			{
+				m_logRetention->addPendingCompression(path);
+			}
+		}
+	}
+
+	void LoggerInstance::waitForLogCompression()
+	{
+		std::lock_guard lock(m_logFileMutex);
+		if (m_logCompressor)
+		{
+			m_logCompressor->wait();
+		}
+	}
+
+	void LoggerInstance::applyRetention(const std::string& activePath, const DateTime& dateTime)
+	{
+		if (m_logRetention)
+		{
+			m_logRetention->apply(m_logPath, activePath, dateTime);
+		}
+	}
+
+	void LoggerInstance::closeLogFile()
+	{
+		std::lock_guard lock(m_logFileMutex);
+		m_logFile.close();
+		m_mappedLogFile.close();
+		m_binaryLogFile.close();
+		m_compressedLogFile.close();
+	}
+
+	void LoggerInstance::flushLogFile()
+	{
+		std::lock_guard lock(m_logFileMutex);
+		m_logFile.flush();
+		m_mappedLogFile.flush();
+		m_binaryLogFile.flush();
+		m_compressedLogFile.flush();
+	}
+
+	void LoggerInstance::flushLogFileIfDue()
+	{
+		std::lock_guard lock(m_logFileMutex);
+		m_logFile.flushIfDue();
+		m_binaryLogFile.flushIfDue();
+		m_compressedLogFile.flushIfDue();
+	}
+
+	void LoggerInstance::applyInit(std::string_view logPath, const bool printLog, const LogSeverity severityLimit, const int sizeLimit)
+	{
+		{
+			//The next log looks up its log file with the new settings
+			std::lock_guard lock(m_logFileMutex);
+			m_logFile.close();
+			m_mappedLogFile.close();
+			m_binaryLogFile.close();
+			m_compressedLogFile.close();
+			m_logPath = logPath;
+			m_sizeLimit.store(sizeLimit, std::memory_order_relaxed);
+			//The recorder is only replaced under the log file mutex
+			if (auto* flightRecorder = m_flightRecorder.load())
+			{
+				updateFlightRecorderDumpPath(*flightRecorder);
+			}
+		}
+
+		m_printLog.store(printLog, std::memory_order_relaxed);
+		m_severityLimit.store(severityLimit, std::memory_order_relaxed);
+
+		m_isInitialized.store(true);
+		updateActiveSeverityLimit();
+	}
+
+	void LoggerInstance::uninitialize()
+	{
+		m_isInitialized.store(false);
+		updateActiveSeverityLimit();
+	}
+
+	void LoggerInstance::updateActiveSeverityLimit()
+	{
+		auto activeSeverityLimit = LogSeverity::TRACE;
+		if (m_isInitialized.load())
+		{
+			activeSeverityLimit = m_severityLimit.load(std::memory_order_relaxed);
+
+			GracePeriod::ReadGuard guard(m_flightRecorderReaders);
+			if (auto* flightRecorder = m_flightRecorder.load())
+			{
+				activeSeverityLimit = std::max(activeSeverityLimit, flightRecorder->severity());
+			}
+		}
+		m_activeSeverityLimit.store(activeSeverityLimit, std::memory_order_relaxed);
+	}
+
+	void LoggerInstance::updateFlightRecorderDumpPath(FlightRecorder& flightRecorder)
+	{
+		flightRecorder.setDumpPath(m_flightRecorderDumpPath.empty() ? m_logPath + PATH_SEPARATOR + "flight_recorder.log" : m_flightRecorderDumpPath);
+	}
+
+	void LoggerInstance::init(std::string_view logPath)
+	{
+		applyInit(logPath, m_printLog.load(), m_severityLimit.load(), m_sizeLimit.load());
+	}
+
+	void LoggerInstance::init(std::string_view logPath, const bool printLog, const LogSeverity severityLimit, const int sizeLimit)
+	{
+		applyInit(logPath, printLog, severityLimit, sizeLimit);
+	}
+
+	void LoggerInstance::init(const std::string& application, const std::string& domain)
+	{
+		applyInit(createAppDataPath(application, domain), m_printLog.load(), m_severityLimit.load(), m_sizeLimit.load());
+	}
+
+	void LoggerInstance::init(const std::string& application, const std::string& domain, const bool printLog, const LogSeverity severityLimit, const int sizeLimit)
+	{
+		applyInit(createAppDataPath(application, domain), printLog, severityLimit, sizeLimit);
+	}
+
+	void LoggerInstance::enableAsync()
+	{
+		enableAsync(DEFAULT_ASYNC_CAPACITY, OverflowPolicy::BLOCK);
+	}
+
+	void LoggerInstance::enableAsync(const std::size_t capacity, const OverflowPolicy overflowPolicy)
+	{
+		enableAsync(capacity, overflowPolicy, AsyncQueueMode::SHARED);
+	}
+
+	void LoggerInstance::enableAsync(const std::size_t capacity, const OverflowPolicy overflowPolicy, const AsyncQueueMode queueMode)
+	{
+		//Drain the previous queue before replacing it
+		shutdown();
+
+		m_asyncWriter = std::make_unique<AsyncWriter>(capacity, overflowPolicy, queueMode,
+			[this](const LogRecord& record) { writeAsyncRecord(record); },
+			[this]() { notifyReceiverBatch(); },
+			[this]()
+			{
+				flushLogFileIfDue();
+				reportStatsIfDue();
+			});
+	}
+
+	void LoggerInstance::flush()
+	{
+		logPendingRepeats();
+
+		if (m_asyncWriter)
+		{
+			m_asyncWriter->flush();
+		}
+		m_receivers.flush();
+
+		flushLogFile();
+	}
+
+	void LoggerInstance::setFlushPolicy(const FlushPolicy& flushPolicy)
+	{
+		{
+			std::lock_guard lock(m_logFileMutex);
+			m_logFile.setFlushPolicy(flushPolicy);
+			m_binaryLogFile.setFlushPolicy(flushPolicy);
+		}
+
+		//The previous flusher is stopped without holding the log file mutex, because its thread may be waiting for it
+		std::unique_ptr<IntervalFlusher> previousFlusher;
+		std::lock_guard lock(m_intervalFlusherMutex);
+		const auto interval = std::max(flushPolicy.Interval, std::chrono::milliseconds(0));
+		if (m_intervalFlusher ? m_intervalFlusher->interval() == interval : interval.count() == 0)
+		{
+			return;
+		}
+		previousFlusher = std::move(m_intervalFlusher);
+		if (interval.count() > 0)
+		{
+			m_intervalFlusher = std::make_unique<IntervalFlusher>(interval, [this]() { flushLogFileIfDue(); });
+		}
+	}
+
+	void LoggerInstance::setLogFileMode(const LogFileMode logFileMode)
+	{
+		//The next log opens the log file of the new mode
+		std::lock_guard lock(m_logFileMutex);
+		m_logFile.close();
+		m_mappedLogFile.close();
+		m_binaryLogFile.close();
+		m_compressedLogFile.close();
+		m_logFileMode.store(logFileMode, std::memory_order_relaxed);
+	}
+
+	void LoggerInstance::setCompressionPolicy(const CompressionPolicy& compressionPolicy)
+	{
+		std::unique_ptr<LogCompressor> previousCompressor;
+		{
+			std::lock_guard lock(m_logFileMutex);
+			m_compressedLogFile.setCompressionPolicy(compressionPolicy);
+			previousCompressor = std::move(m_logCompressor);
+			if (compressionPolicy.IsEnabled)
+			{
+				m_logCompressor = std::make_unique<LogCompressor>(compressionPolicy);
+			}
+		}
+
+		//The previous compressor finishes its queued files without holding the lock
+		previousCompressor.reset();
+	}
+
+	void LoggerInstance::setRetentionPolicy(const RetentionPolicy& retentionPolicy)
+	{
+		//The directory is scanned again when the next log file is opened
+		std::lock_guard lock(m_logFileMutex);
+		m_logRetention.reset();
+		if (retentionPolicy.IsEnabled)
+		{
+			m_logRetention = std::make_unique<LogRetention>(retentionPolicy);
+		}
+	}
+
+	void LoggerInstance::shutdown()
+	{
+		logPendingRepeats();
+
+		m_asyncWriter.reset();
+		closeLogFile();
+		waitForLogCompression();
+	}
+
+	std::uint64_t LoggerInstance::droppedRecords() const
+	{
+		return m_asyncWriter ? m_asyncWriter->droppedRecords() : 0;
+	}
+
+	std::vector<ThreadDropCount> LoggerInstance::droppedRecordsPerThread() const
+	{
+		return m_asyncWriter ? m_asyncWriter->droppedRecordsPerThread() : std::vector<ThreadDropCount>();
+	}
+
+	void LoggerInstance::setRateLimitPolicy(const RateLimitPolicy& rateLimitPolicy)
+	{
+		//The interval is kept between a microsecond and about 12 days and the burst under 2^62 microseconds, so the bucket arithmetic cannot overflow
+		constexpr std::int64_t maxInterval = 1000000000000;
+		const auto interval = rateLimitPolicy.LogsPerSecond > 1000000.0 / maxInterval ?
+			std::max<std::int64_t>(static_cast<std::int64_t>(1000000.0 / rateLimitPolicy.LogsPerSecond), 1) : maxInterval;
+		m_rateLimitInterval.store(interval, std::memory_order_relaxed);
+		m_rateLimitBurst.store(std::clamp<std::int64_t>(rateLimitPolicy.Burst, 1, (std::int64_t(1) << 62) / interval), std::memory_order_relaxed);
+		if (rateLimitPolicy.IsEnabled)
+		{
+			m_callSiteChecks.fetch_or(RATE_LIMIT_CHECK, std::memory_order_relaxed);
+		}
+		else
+		{
+			m_callSiteChecks.fetch_and(~RATE_LIMIT_CHECK, std::memory_order_relaxed);
+		}
+	}
+
+	void LoggerInstance::setSamplingPolicy(const LogSeverity severity, const SamplingPolicy& samplingPolicy)
+	{
+		//The probability is mapped to the range of the random numbers, 1 keeps every log without drawing a number.
+		//A probability which is not a number keeps every log as well
+		const double probability = std::isnan(samplingPolicy.Probability) ? 1.0 : std::clamp(samplingPolicy.Probability, 0.0, 1.0);
+		std::uint64_t threshold = UINT64_MAX;
+		if (probability < 1.0)
+		{
+			constexpr double randomRange = 18446744073709551616.0;
+			threshold = static_cast<std::uint64_t>(probability * randomRange);
+		}
+
+		auto& sampling = m_sampling[static_cast<std::size_t>(severity)];
+		sampling.Threshold.store(threshold, std::memory_order_relaxed);
+		sampling.Interval.store(std::max<std::uint32_t>(samplingPolicy.Interval, 1), std::memory_order_relaxed);
+		if (samplingPolicy.IsEnabled)
+		{
+			m_callSiteChecks.fetch_or(samplingCheck(severity), std::memory_order_relaxed);
+		}
+		else
+		{
+			m_callSiteChecks.fetch_and(~samplingCheck(severity), std::memory_order_relaxed);
+		}
+	}
+
+	void LoggerInstance::setDuplicateSuppression(const bool isSuppressed)
+	{
+		m_duplicateFilter.reset();
+		m_isDuplicateSuppressed.store(isSuppressed, std::memory_order_relaxed);
+	}
+
+	void LoggerInstance::setFlightRecorderPolicy(const FlightRecorderPolicy& flightRecorderPolicy)
+	{
+		std::unique_ptr<FlightRecorder> flightRecorder;
+		if (flightRecorderPolicy.IsEnabled)
+		{
+			flightRecorder = std::make_unique<FlightRecorder>(flightRecorderPolicy.Severity, flightRecorderPolicy.RecordsPerThread,
+				flightRecorderPolicy.MaxRecordSize, flightRecorderPolicy.IsDumpedOnError, flightRecorderPolicy.IsDumpedOnSignal);
+		}
+
+		//The new recorder gets its dump file before it is published, so no dump sees it without one
+		std::unique_ptr<FlightRecorder> retiredFlightRecorder;
+		{
+			std::lock_guard lock(m_logFileMutex);
+			if (flightRecorder)
+			{
+				m_flightRecorderDumpPath = flightRecorderPolicy.DumpPath;
+				updateFlightRecorderDumpPath(*flightRecorder);
+			}
+			retiredFlightRecorder.reset(m_flightRecorder.exchange(flightRecorder.release()));
+		}
+		updateActiveSeverityLimit();
+
+		//The logs which may still use the replaced recorder finish before it is destroyed
+		if (retiredFlightRecorder)
+		{
+			m_flightRecorderReaders.synchronize();
+		}
+	}
+
+	void LoggerInstance::dumpFlightRecorder()
+	{
+		GracePeriod::ReadGuard guard(m_flightRecorderReaders);
+		if (auto* flightRecorder = m_flightRecorder.load())
+		{
+			flightRecorder->dump("request");
+		}
+	}
+
+	std::uint64_t LoggerInstance::rateLimitedRecords() const
+	{
+		return m_stats.rateLimitedRecords();
+	}
+
+	std::uint64_t LoggerInstance::suppressedDuplicates() const
+	{
+		return m_duplicateFilter.suppressedRecords();
+	}
+
+	void LoggerInstance::setStatsPolicy(const StatsPolicy& statsPolicy)
+	{
+		m_stats.setLatencyTracked(statsPolicy.IsLatencyTracked);
+
+		//The first report is made one interval after the policy is set
+		const auto interval = std::max<std::int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(statsPolicy.ReportInterval).count(), 0);
+		const auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+		m_nextStatsReport.store(now + interval, std::memory_order_relaxed);
+		m_statsReportInterval.store(interval, std::memory_order_relaxed);
+	}
+
+	LoggerStats LoggerInstance::stats() const
+	{
+		LoggerStats stats;
+		m_stats.collect(stats);
+		stats.SuppressedDuplicates = suppressedDuplicates();
+
+		return stats;
+	}
+
+	void LoggerInstance::setDeferredFormatting(const bool isDeferred)
+	{
+		m_isDeferredFormatting.store(isDeferred, std::memory_order_relaxed);
+	}
+
+	bool LoggerInstance::isDeferredFormatting() const
+	{
+		return m_asyncWriter && m_isDeferredFormatting.load(std::memory_order_relaxed);
+	}
+
+	void LoggerInstance::setTimestampPrecision(const TimestampPrecision timestampPrecision)
+	{
+		m_timestampPrecision.store(timestampPrecision, std::memory_order_relaxed);
+	}
+
+	void LoggerInstance::setLineFormat(const LogLineFormat lineFormat)
+	{
+		m_lineFormat.store(lineFormat, std::memory_order_relaxed);
+	}
+
+	void LoggerInstance::addReceiver(Receiver* receiver)
+	{
+		m_receivers.add(receiver);
+	}
+
+	void LoggerInstance::addReceiver(Receiver* receiver, const ReceiverPolicy& receiverPolicy)
+	{
+		m_receivers.add(receiver, receiverPolicy);
+	}
+
+	void LoggerInstance::removeReceiver(Receiver* receiver)
+	{
+		m_receivers.remove(receiver);
+	}
+
+	void LoggerInstance::clearReceivers()
+	{
+		m_receivers.clear();
+	}
+
+	ReceiverStats LoggerInstance::receiverStats(Receiver* receiver) const
+	{
+		return m_receivers.stats(receiver);
+	}
+
+	void LoggerInstance::logInfo(const std::string& message)
+	{
+		log(message, LogSeverity::INFO);
+	}
+
+	void LoggerInstance::logWarning(const std::string& message)
+	{
+		log(message, LogSeverity::WARNING);
+	}
+
+	void LoggerInstance::logError(const std::string& message)
+	{
+		log(message, LogSeverity::ERROR);
+	}
+
+	void LoggerInstance::logDebug(const std::string& message, std::string_view source, const int line)
+	{
+		logMessage(LogSeverity::DEBUG, source, line, message);
+	}
+
+	void LoggerInstance::logTrace(const std::string& message, std::string_view source, const int line)
+	{
+		logMessage(LogSeverity::TRACE, source, line, message);
+	}
+
+	void LoggerInstance::logMessage(const LogSeverity severity, std::string_view source, const int line, const std::string& message)
+	{
+		if (source.empty())
+		{
+			log(message, severity);
+			return;
+		}
+
+		//Skip building the detailed message if it would be discarded anyway
+		if (!isSeverityEnabled(severity))
+		{
+			return;
+		}
+
+		FormatBuffer buffer;
+		FormatBuffer fieldBuffer;
+		auto& detailedMessage = buffer.get();
+		detailedMessage += message;
+		addSourceDetails(detailedMessage, fieldBuffer.get(), source, line);
+
+		log(detailedMessage, severity, fieldBuffer.get(), source, line);
+	}
+
+	void LoggerInstance::logStructured(const LogSeverity severity, std::string_view message, std::initializer_list<LogField> fields)
+	{
+		logStructured(severity, std::string_view(), 0, message, fields);
+	}
+
+	void LoggerInstance::logStructured(const LogSeverity severity, std::string_view source, const int line, std::string_view message, std::initializer_list<LogField> fields)
+	{
+		//Skip encoding the fields if the log would be discarded anyway
+		if (!isSeverityEnabled(severity))
+		{
+			return;
+		}
+
+		FormatBuffer buffer;
+		FormatBuffer fieldBuffer;
+		auto& fullMessage = buffer.get();
+		auto& encodedFields = fieldBuffer.get();
+		fullMessage += message;
+
+		//The fields are copied, so the log does not refer to the caller's memory in async mode
+		for (const auto& field : fields)
+		{
+			encodeField(encodedFields, field);
+		}
+
+		if (!source.empty())
+		{
+			addSourceDetails(fullMessage, encodedFields, source, line);
+		}
+
+		log(fullMessage, severity, encodedFields, source, line);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,977 @@
+#pragma once
+#include "AsyncWriter.h"
+#include "BinaryLogFile.h"
+#include "CallSite.h"
+#include "CallSiteState.h"
+#include "CompressedLogFile.h"
+#include "DateTime.h"
+#include "DuplicateFilter.h"
+#include "Export.h"
+#include "FlightRecorder.h"
+#include "FlightRecorderPolicy.h"
+#include "GracePeriod.h"
+#include "IntervalFlusher.h"
+#include "LogField.h"
+#include "LogFile.h"
+#include "LogFileMode.h"
+#include "LogLineFormat.h"
+#include "LogCompressor.h"
+#include "LogRetention.h"
+#include "LogSeverity.h"
+#include "LoggerStats.h"
+#include "MappedLogFile.h"
+#include "MessageFormat.h"
+#include "RateLimitPolicy.h"
+#include "Receiver.h"
+#include "ReceiverList.h"
+#include "ReceiverPolicy.h"
+#include "ReceiverStats.h"
+#include "RecordBatch.h"
+#include "SamplingPolicy.h"
+#include "StatsCollector.h"
+#include "ThreadRandom.h"
+#include "StatsPolicy.h"
+
+#include <array>
+#include <string>
+#include <vector>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <cstdint>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief A named logger with its own log file, severity limit, receivers and async writer.
+	 *
+	 * Instances are created through the LoggerRegistry, the static Logger is a facade over the default instance.
+	 * Logging, initialization and receiver changes are safe to call from multiple threads.
+	 * Switching between sync and async mode must not overlap with logs of other threads
+	*/
+	class AETHER_CPPLOGGER_API LoggerInstance
+	{
+		friend class Logger;
+		friend class BinaryLogReader;
+
+	public:
+		/**
+		 * @brief A structure to handle date and time data. See aether_cpplogger::DateTime
+		*/
+		using DateTime = aether_cpplogger::DateTime;
+
+	private:
+		/**
+		 * @brief The bit of m_callSiteChecks which enables the rate limit
+		*/
+		static constexpr unsigned RATE_LIMIT_CHECK = 1;
+
+		/**
+		 * @brief The sampling settings of a severity, see SamplingPolicy
+		*/
+		struct SamplingState
+		{
+			/**
+			 * @brief A log is kept if a random number is below it. The maximum keeps every log
+			*/
+			std::atomic<std::uint64_t> Threshold{ UINT64_MAX };
+			std::atomic<std::uint32_t> Interval{ 1 };
+		};
+
+		/**
+		 * @brief Returns the bit of m_callSiteChecks which enables the sampling of the severity
+		*/
+		static constexpr unsigned samplingCheck(const LogSeverity severity)
+		{
+			return 2u << static_cast<unsigned>(severity);
+		}
+
+		/**
+		 * @brief The name of this logger in the LoggerRegistry. The default logger has an empty name
+		*/
+		const std::string m_name;
+
+		/**
+		 * @brief Flag indicating the initialization state of the logger
+		*/
+		std::atomic<bool> m_isInitialized{ false };
+		/**
+		 * @brief The path to the log destination folder. It is guarded by the log file mutex
+		*/
+		std::string m_logPath;
+		/**
+		 * @brief Flag which indicates whether the logged information should be printed on the console
+		*/
+		std::atomic<bool> m_printLog{ false };
+		/**
+		 * @brief The configured log severity limit. Logs with severity over the limit are discarded
+		*/
+		std::atomic<LogSeverity> m_severityLimit{ LogSeverity::ERROR };
+		/**
+		 * @brief The severity limit which is checked by the AETHER_LOG_* macros before anything else.
+			It is TRACE while the logger is not initialized, so the log itself can report the missing initialization.
+			It includes the severity of the flight recorder, which keeps logs over the severity limit
+		*/
+		std::atomic<LogSeverity> m_activeSeverityLimit{ LogSeverity::TRACE };
+		/**
+		 * @brief The maximum size of a log file
+		*/
+		std::atomic<int> m_sizeLimit;
+		/**
+		 * @brief The fractional second digits of the log time prefix
+		*/
+		std::atomic<TimestampPrecision> m_timestampPrecision{ TimestampPrecision::SECONDS };
+		/**
+		 * @brief Flag which indicates whether formatted logs are formatted by the writer thread in async mode
+		*/
+		std::atomic<bool> m_isDeferredFormatting{ false };
+		/**
+		 * @brief The layout of the lines written to the text log file and the console
+		*/
+		std::atomic<LogLineFormat> m_lineFormat{ LogLineFormat::TEXT };
+
+		/**
+		 * @brief The enabled checks of the call sites of the AETHER_LOG_* macros: the rate limit and the sampling of each severity.
+			The macros skip the checks with a single load while it is 0
+		*/
+		std::atomic<unsigned> m_callSiteChecks{ 0 };
+		/**
+		 * @brief The sampling settings indexed by the severity
+		*/
+		std::array<SamplingState, 5> m_sampling;
+		/**
+		 * @brief The time in microseconds in which a call site gets a new token, see RateLimitPolicy
+		*/
+		std::atomic<std::int64_t> m_rateLimitInterval{ 0 };
+		/**
+		 * @brief The number of tokens of a call site, see RateLimitPolicy
+		*/
+		std::atomic<std::int64_t> m_rateLimitBurst{ 0 };
+		/**
+		 * @brief The counters of the logger about itself. Declared before the log files, whose flushes it measures
+		*/
+		StatsCollector m_stats;
+		/**
+		 * @brief The interval of the stats reports in nanoseconds, zero if the receivers get no reports
+		*/
+		std::atomic<std::int64_t> m_statsReportInterval{ 0 };
+		/**
+		 * @brief The steady clock time of the next stats report in nanoseconds
+		*/
+		std::atomic<std::int64_t> m_nextStatsReport{ 0 };
+		/**
+		 * @brief Flag which indicates whether the repeats of the previous log are collapsed
+		*/
+		std::atomic<bool> m_isDuplicateSuppressed{ false };
+		DuplicateFilter m_duplicateFilter;
+		/**
+		 * @brief The in-memory recorder of the latest logs of each thread, nullptr while the flight recorder is disabled.
+			It is owned by the logger and only replaced under the log file mutex. The logs read it within m_flightRecorderReaders,
+			so a replaced recorder is destroyed after their grace period
+		*/
+		std::atomic<FlightRecorder*> m_flightRecorder{ nullptr };
+		GracePeriod m_flightRecorderReaders;
+		/**
+		 * @brief The dump file of the flight recorder policy. It is guarded by the log file mutex
+		*/
+		std::string m_flightRecorderDumpPath;
+
+		/**
+		 * @brief The attached Receiver objects. These stored objects are notified upon each log made.
+			Notifying them does not take a lock, so a receiver can log with the same logger
+		*/
+		ReceiverList m_receivers;
+		/**
+		 * @brief The logs of the current batch of the writer thread. They are handed to the receivers together when the batch ends.
+			Only the writer thread uses it
+		*/
+		RecordBatch m_receiverBatch;
+
+		/**
+		 * @brief The currently open log file. It is kept open between the logs
+		*/
+		LogFile m_logFile;
+		/**
+		 * @brief The log file of the MAPPED log file mode. Lines are written into it without the log file mutex,
+			the mutex is only held to open, rotate and close it
+		*/
+		MappedLogFile m_mappedLogFile;
+		/**
+		 * @brief The log file of the BINARY log file mode. It is guarded by the log file mutex
+		*/
+		BinaryLogFile m_binaryLogFile;
+		/**
+		 * @brief The log file of the COMPRESSED log file mode. It is guarded by the log file mutex
+		*/
+		CompressedLogFile m_compressedLogFile;
+		/**
+		 * @brief Defines which of the log files is written. It is only changed while the log file mutex is held
+		*/
+		std::atomic<LogFileMode> m_logFileMode{ LogFileMode::BUFFERED };
+		/**
+		 * @brief The background compressor of the completed text log files. It is only set while compression is enabled
+			and guarded by the log file mutex
+		*/
+		std::unique_ptr<LogCompressor> m_logCompressor;
+		/**
+		 * @brief The index of the completed log files which deletes the old ones. It is only set while retention is enabled
+			and guarded by the log file mutex
+		*/
+		std::unique_ptr<LogRetention> m_logRetention;
+		/**
+		 * @brief Mutex which guards the log file and the log path against concurrent access
+		*/
+		std::mutex m_logFileMutex;
+		/**
+		 * @brief Mutex which guards the replacement of the interval flusher
+		*/
+		std::mutex m_intervalFlusherMutex;
+		/**
+		 * @brief The thread which writes the buffered lines after FlushPolicy::Interval. It is only set while the interval is set.
+			Declared after the log files so it is stopped before they are destroyed
+		*/
+		std::unique_ptr<IntervalFlusher> m_intervalFlusher;
+
+		/**
+		 * @brief The background writer. The logger works in async mode while it is set.
+			Declared last so it is destroyed first and the writer thread can still use the other members while draining
+		*/
+		std::unique_ptr<AsyncWriter> m_asyncWriter;
+
+	protected:
+		/**
+		 * @brief Creates a log according to the given severity
+		 *
+		 * @param message The message to be logged
+		 * @param severity The severity of this log
+		 * @param fields The encoded fields of a structured log
+		 * @param source The name of the source file where the log originates. Empty if the log has no source details
+		 * @param line The line number where the log originates
+		*/
+		void log(std::string_view message, const LogSeverity severity = LogSeverity::INFO, std::string_view fields = std::string_view(),
+			std::string_view source = std::string_view(), const int line = 0);
+		/**
+		 * @brief Queues a formatted log with its arguments still encoded. The writer thread formats it (see setDeferredFormatting())
+		 *
+		 * @param callSite The descriptor of the call site. It must outlive the logger's async mode
+		 * @param arguments The arguments encoded by the ArgumentCodec of the call site
+		*/
+		void logDeferred(const CallSite& callSite, std::string_view arguments);
+		/**
+		 * @brief Forwards the log to the console, the log file of the current log file mode and the receivers
+		 *
+		 * @param record The details of the log with its raw message without the prefixes
+		 * @param fields The encoded fields of a structured log
+		*/
+		void dispatchLog(const RecordView& record, std::string_view fields = std::string_view());
+		/**
+		 * @brief Takes the timestamp of a checked log and queues it in async mode or dispatches it right away
+		 *
+		 * @param message The raw message of the log without the prefixes
+		 * @param severity The severity of this log
+		 * @param fields The encoded fields of a structured log
+		 * @param source The name of the source file where the log originates. Empty if the log has no source details
+		 * @param line The line number where the log originates
+		*/
+		void submitLog(std::string_view message, const LogSeverity severity, std::string_view fields = std::string_view(),
+			std::string_view source = std::string_view(), const int line = 0);
+		/**
+		 * @brief Copies the log into the flight recorder with its fields in logfmt form
+		 *
+		 * @param flightRecorder The current flight recorder, read within its grace period
+		 * @param message The raw message of the log without the prefixes
+		 * @param severity The severity of this log
+		 * @param fields The encoded fields of a structured log
+		*/
+		void recordFlight(FlightRecorder& flightRecorder, std::string_view message, const LogSeverity severity, std::string_view fields = std::string_view());
+		/**
+		 * @brief Dumps the flight recorder if it is enabled and the severity of the log triggers a dump
+		 *
+		 * @param severity The severity of the made log
+		*/
+		void dumpFlightRecorderOnError(const LogSeverity severity);
+		/**
+		 * @brief Sets the severity limit checked by the macros: TRACE while the logger is not initialized, otherwise the more verbose
+			of the severity limit and the severity of the flight recorder
+		*/
+		void updateActiveSeverityLimit();
+		/**
+		 * @brief Points the flight recorder to the dump file of its policy or to the default one in the log path.
+			The log file mutex must be held by the caller
+		 *
+		 * @param flightRecorder The current flight recorder or the one about to be published
+		*/
+		void updateFlightRecorderDumpPath(FlightRecorder& flightRecorder);
+		/**
+		 * @brief Checks whether the log repeats the previous log. Otherwise the skipped repeats of the previous log are reported first
+		 *
+		 * @param key The hash of the log content
+		 * @param severity The severity of this log
+		 *
+		 * @return True if the log is to be skipped
+		*/
+		bool isRepeatedLog(const std::uint64_t key, const LogSeverity severity);
+		/**
+		 * @brief Reports the skipped repeats of the previous log, e.g. before a flush
+		*/
+		void logPendingRepeats();
+		/**
+		 * @brief Samples the log and takes a token of the call site according to the enabled checks.
+			The first allowed log after logs skipped by the rate limit reports their number
+		 *
+		 * @param severity The severity of the log
+		 * @param callSite The state of the call site
+		 *
+		 * @return True if the log is allowed
+		*/
+		bool checkCallSite(const LogSeverity severity, CallSiteState& callSite);
+		/**
+		 * @brief Decides whether the log is kept by the interval sampling of its severity. The probability is decided by isCallSiteAllowed()
+		 *
+		 * @param severity The severity of the log
+		 * @param callSite The state of the call site
+		 *
+		 * @return True if the log is kept
+		*/
+		bool isSampled(const LogSeverity severity, CallSiteState& callSite) const;
+		/**
+		 * @brief Returns the counter of the logs skipped by the sampling in the calling thread's stats shard
+		*/
+		std::atomic<std::uint64_t>& sampledOutCounter();
+		/**
+		 * @brief Forwards a log with encoded arguments. Binary log files store the arguments as they are,
+			otherwise and for the console and the receivers the message is formatted first
+		 *
+		 * @param callSite The descriptor of the call site
+		 * @param arguments The arguments encoded by the ArgumentCodec of the call site
+		 * @param timestamp The creation time of the log in microseconds since the Unix epoch
+		 * @param threadId The ID of the thread which made the log
+		*/
+		void dispatchEncodedLog(const CallSite& callSite, std::string_view arguments, const std::int64_t timestamp, const std::thread::id threadId);
+		/**
+		 * @brief Builds the line of the log according to the line format and writes it to the console, optionally to the text log file,
+			and notifies the receivers with the log
+		 *
+		 * @param record The details of the log with its raw message without the prefixes
+		 * @param fields The encoded fields of a structured log
+		 * @param isTextFileWritten Flag which indicates whether the log is written to the text log file
+		*/
+		void writeLogOutputs(const RecordView& record, std::string_view fields, const bool isTextFileWritten);
+		/**
+		 * @brief Processes a record drained from the async queue. It is called on the writer thread
+		 *
+		 * @param record The record to be written
+		*/
+		void writeAsyncRecord(const LogRecord& record);
+		/**
+		 * @brief Checks whether the source details are written as fields. They are appended to the message in the TEXT line format
+			and in BINARY log file mode
+		*/
+		bool hasSourceFields() const;
+		/**
+		 * @brief Adds the source file and line information of a log either to its message or to its fields. See hasSourceFields()
+		 *
+		 * @param message The message of the log. It is modified in place
+		 * @param fields The encoded fields of the log. It is modified in place
+		 * @param source The name of the source file where the log originates
+		 * @param line The line number where the log originates
+		*/
+		void addSourceDetails(std::string& message, std::string& fields, std::string_view source, const int line) const;
+		/**
+		 * @brief Builds the message of a deferred log from its encoded arguments
+		 *
+		 * @param message The string to be appended
+		 * @param fields The string the source details are appended to if they are written as fields
+		 * @param callSite The descriptor of the call site
+		 * @param arguments The arguments encoded by the ArgumentCodec of the call site
+		*/
+		void formatEncodedMessage(std::string& message, std::string& fields, const CallSite& callSite, const char* arguments) const;
+		/**
+		 * @brief Creates a formatted time prefix for the log message according to the given DateTime and the timestamp precision
+		 *
+		 * @param dateTime The DateTime when the log is created at
+		 *
+		 * @return The time prefix for the log message
+		*/
+		std::string createMessageTimePrefix(const DateTime& dateTime) const;
+		/**
+		 * @brief Writes the log message to the console if the corresponding flag is set
+		 *
+		 * @param message The message of the log with the prefixes
+		*/
+		void writeLogToConsole(std::string_view message) const;
+		/**
+		 * @brief Writes the log message with the severity and time prefixes prepended to the log file
+		 *
+		 * @param message The raw log message which will be prepended with the prefixes
+		 * @param dateTime The creation DateTime of the log. It determines the name of the log file and the time message prefix
+		 * @param severity The severity of the log. It is used by the flush policy
+		*/
+		void writeLogToFile(std::string_view message, const DateTime& dateTime, const LogSeverity severity = LogSeverity::INFO);
+		/**
+		 * @brief Writes the log to the binary log file
+		 *
+		 * @param callSite The call site of a formatted log or nullptr if the data is a ready message
+		 * @param data The encoded arguments of the call site or the raw message
+		 * @param severity The severity of the log
+		 * @param timestamp The creation time of the log in microseconds since the Unix epoch
+		*/
+		void writeLogToBinaryFile(const CallSite* callSite, std::string_view data, const LogSeverity severity, const std::int64_t timestamp);
+		/**
+		 * @brief Notifies the attached receivers by forwarding them the log. On the writer thread the log is added to the current batch instead
+		 *
+		 * @param record The details of the log with its raw message without the prefixes
+		*/
+		void notifyReceivers(const RecordView& record);
+		/**
+		 * @brief Hands the logs of the finished batch of the writer thread to the receivers in a single call. It is called on the writer thread
+		*/
+		void notifyReceiverBatch();
+		/**
+		 * @brief Hands a snapshot of the counters to the receivers if the report interval has elapsed.
+			Only a single thread reports each interval
+		*/
+		void reportStatsIfDue();
+		/**
+		 * @brief Checks whether the defined log path exists and creates it if needed. The log file mutex must be held by the caller
+		*/
+		void checkLogPath() const;
+		/**
+		 * @brief Checks the name of the log file according to the given DateTime and file size limit
+		 *
+		 * @param dateTime The DateTime of the log creation. Its date properties are used to define the name of the log file
+		 *
+		 * @return The calculated name of the log file
+		*/
+		std::string checkLogFile(const DateTime& dateTime) const;
+		/**
+		 * @brief Checks the name of the log file according to the given DateTime and file size limit starting from the given index
+		 *
+		 * @param dateTime The DateTime of the log creation. Its date properties are used to define the name of the log file
+		 * @param index The first index to be checked. 1 starts at the highest existing index of the date.
+			It is set to the index of the calculated log file
+		 *
+		 * @return The calculated name of the log file
+		*/
+		std::string checkLogFile(const DateTime& dateTime, int& index) const;
+		/**
+		 * @brief Checks the indexing of the log file according to the log file size limitation
+		 *
+		 * @param nameBase The base name which needs indexing (if needed due to the size limitation)
+		 * @param index The currently checked index
+		 * @param filename The indexed (if needed) log file name
+		 *
+		 * @return The check status. True if the log file name check was unsuccessful
+		*/
+		bool checkLogFileIndexing(std::string_view nameBase, int& index, std::string& filename) const;
+		/**
+		 * @brief Finds the highest index of the log files of the name base with a single pass over the log directory.
+			The plain text log files before it are handed over to the compressor if compression is enabled
+		 *
+		 * @param nameBase The date part of the log file names
+		 *
+		 * @return The highest index of the existing log files. It is 1 if there is none
+		*/
+		int findLastLogFileIndex(std::string_view nameBase) const;
+		/**
+		 * @brief Looks up and opens the log file for the given DateTime. The log file mutex must be held by the caller
+		 *
+		 * @param dateTime The DateTime of the log creation
+		*/
+		void openLogFile(const DateTime& dateTime);
+		/**
+		 * @brief Writes the line to the mapped log file and rotates the file until the line fits. The log file mutex must be held by the caller
+		 *
+		 * @param message The message of the log with the prefixes
+		 * @param dateTime The DateTime of the log creation
+		 *
+		 * @return True if the line was written. False if no file could be mapped, the log file mode is switched to BUFFERED then
+		*/
+		bool writeLogToMappedFile(std::string_view message, const DateTime& dateTime);
+		/**
+		 * @brief Looks up, preallocates and maps the log file for the given DateTime. The log file mutex must be held by the caller
+		 *
+		 * @param dateTime The DateTime of the log creation
+		 * @param lineSize The size of the line to be written. A line over the size limit gets a file of its own size
+		 *
+		 * @return True if the file could be opened
+		*/
+		bool openMappedLogFile(const DateTime& dateTime, const std::size_t lineSize);
+		/**
+		 * @brief Looks up and opens the binary log file for the given DateTime. The log file mutex must be held by the caller
+		 *
+		 * @param dateTime The DateTime of the log creation
+		*/
+		void openBinaryLogFile(const DateTime& dateTime);
+		/**
+		 * @brief Looks up and creates the compressed log file for the given DateTime. The log file mutex must be held by the caller
+		 *
+		 * @param dateTime The DateTime of the log creation
+		*/
+		void openCompressedLogFile(const DateTime& dateTime);
+		/**
+		 * @brief Returns the extension of the log files of the current log file mode
+		*/
+		std::string_view logFileExtension() const;
+		/**
+		 * @brief Hands the completed log file over to the background compressor if compression is enabled.
+			The log file mutex must be held by the caller
+		 *
+		 * @param path The full path of the completed log file. Nothing happens if it is empty
+		*/
+		void compressLogFile(const std::string& path) const;
+		/**
+		 * @brief Blocks until the background compressor has compressed every completed log file handed over to it
+		*/
+		void waitForLogCompression();
+		/**
+		 * @brief Deletes the old log files if retention is enabled. It is called after a log file is opened.
+			The log file mutex must be held by the caller
+		 *
+		 * @param activePath The full path of the opened log file
+		 * @param dateTime The DateTime of the log creation
+		*/
+		void applyRetention(const std::string& activePath, const DateTime& dateTime);
+		/**
+		 * @brief Closes the currently open log file. The next log looks up its log file again
+		*/
+		void closeLogFile();
+		/**
+		 * @brief Writes the buffered logs to the currently open log file
+		*/
+		void flushLogFile();
+		/**
+		 * @brief Writes the buffered logs to the log file if the flush interval has elapsed. It is called by the idle writer thread
+		*/
+		void flushLogFileIfDue();
+		/**
+		 * @brief Marks the logger as initialized with the given log path and settings
+		 *
+		 * @param logPath The path to the folder where the log files have to be created
+		 * @param printLog The flag which indicates whether the log message should be printed on the console
+		 * @param severityLimit The maximum allowed severity of the logs
+		 * @param sizeLimit The maximum allowed size of the log files in bytes
+		*/
+		void applyInit(std::string_view logPath, const bool printLog, const LogSeverity severityLimit, const int sizeLimit);
+
+		/**
+		 * @brief Sets the initialization flag to false. This is used for testing purposes only
+		*/
+		void uninitialize();
+
+		/**
+		 * @brief Creates a string which points to the AppData folder with the addition of the user given domain and application values
+		 *
+		 * @param application The name of the appliation this log is made for. The name of the application is used in the folder structure.
+		 * @param domain (optional)The domain of the application this log is made for. The domain of the application is used in the folder structure.
+		 *
+		 * @return The path to the log folder in the AppData. e.g.: %APPDATA%\\@p domain (optional)\\@p application\\logs
+			On the other platforms the folder is $XDG_DATA_HOME or ~/.local/share, e.g.: ~/.local/share/@p domain (optional)/@p application/logs
+		*/
+		static std::string createAppDataPath(std::string_view application, std::string_view domain);
+		/**
+		 * @brief Creates a formatted severity prefix for the log message according to the given severity
+		 *
+		 * @param severity The severity of the given log
+		 *
+		 * @return The severity prefix for the log message
+		*/
+		static std::string createMessageSeverityPrefix(const LogSeverity severity);
+		/**
+		 * @brief Appends source file and line information to the message (DEBUG and TRACE severity only)
+		 *
+		 * @param message The message to be completed. It is modified in place
+		 * @param source The name of the source file where the log originates
+		 * @param line The line number where the log originates
+		*/
+		static void appendSourceDetails(std::string& message, std::string_view source, const int line);
+		/**
+		 * @brief Adds source file and line information to the original message (DEBUG and TRACE severity only)
+		 *
+		 * @param message The original message which has to be completed
+		 * @param source The name of the source file where the log originates
+		 * @param line The line number where the log originates
+		 *
+		 * @return The original message completed with the source file and line information
+		*/
+		static std::string createDetailedMessage(const std::string& message, std::string_view source, const int line);
+		/**
+		 * @brief Calculates the current DateTime
+		 *
+		 * @return Returns the current DateTime
+		*/
+		static DateTime currentDateTime();
+
+	public:
+		/**
+		 * @brief Creates an uninitialized logger
+		 *
+		 * @param name The name of the logger
+		*/
+		explicit LoggerInstance(std::string_view name);
+		/**
+		 * @brief Drains the async queue and closes the log file
+		*/
+		~LoggerInstance();
+
+		LoggerInstance(const LoggerInstance&) = delete;
+		LoggerInstance& operator=(const LoggerInstance&) = delete;
+
+		/**
+		 * @brief Returns the name of this logger
+		*/
+		const std::string& name() const;
+
+		/**
+		 * @brief Simple initialization of the logger. Default value is applied for each optional variable
+		 *
+		 * @param logPath The path to the folder where the log files have to be created
+		*/
+		void init(std::string_view logPath);
+		/**
+		 * @brief Advanced initialization of the logger. Optional variables are set through the parameters
+		 *
+		 * @param logPath The path to the folder where the log files have to be created
+		 * @param printLog The flag which indicates whether the log message should be printed on the console
+		 * @param severityLimit The maximum allowed severity of the logs
+		 * @param sizeLimit The maximum allowed size of the log files in bytes
+		*/
+		void init(std::string_view logPath, const bool printLog, const LogSeverity severityLimit, const int sizeLimit);
+		/**
+		 * @brief Simple initialization of the logger to save logs in the AppData. Default value is applied for each optional variable
+		 *
+		 * @param application The name of the application the log is created for
+		 * @param domain The name of the domain this application belongs to
+		*/
+		void init(const std::string& application, const std::string& domain);
+		/**
+		 * @brief Advanced initialization of the logger to save logs in the AppData. Optional variables are set through the parameters
+		 *
+		 * @param application The name of the application the log is created for
+		 * @param domain The name of the domain this application belongs to
+		 * @param printLog The flag which indicates whether the log message should be printed on the console
+		 * @param severityLimit The maximum allowed severity of the logs
+		 * @param sizeLimit The maximum allowed size of the log files in bytes
+		*/
+		void init(const std::string& application, const std::string& domain, const bool printLog, const LogSeverity severityLimit, const int sizeLimit);
+
+		/**
+		 * @brief Switches the logger to async mode with default queue settings. See Logger::enableAsync()
+		*/
+		void enableAsync();
+		/**
+		 * @brief Switches the logger to async mode. See Logger::enableAsync()
+		 *
+		 * @param capacity The number of logs the queue can hold
+		 * @param overflowPolicy The behaviour when the queue is full
+		*/
+		void enableAsync(const std::size_t capacity, const OverflowPolicy overflowPolicy);
+		/**
+		 * @brief Switches the logger to async mode. See Logger::enableAsync()
+		 *
+		 * @param capacity The number of logs a queue can hold
+		 * @param overflowPolicy The behaviour when a queue is full
+		 * @param queueMode Whether the logging threads share a queue or each of them gets its own
+		*/
+		void enableAsync(const std::size_t capacity, const OverflowPolicy overflowPolicy, const AsyncQueueMode queueMode);
+		/**
+		 * @brief Blocks until every log queued before this call is written and handed to the isolated receivers,
+			then writes the buffered logs to the log file
+		*/
+		void flush();
+		/**
+		 * @brief Sets when the buffered logs are written to the log file. By default every log is written immediately
+		 *
+		 * @param flushPolicy The new flush policy
+		*/
+		void setFlushPolicy(const FlushPolicy& flushPolicy);
+		/**
+		 * @brief Sets how the logs are written to the log file. See Logger::setLogFileMode()
+		 *
+		 * @param logFileMode The new log file mode
+		*/
+		void setLogFileMode(const LogFileMode logFileMode);
+		/**
+		 * @brief Sets whether and how the completed log files are compressed. See Logger::setCompressionPolicy()
+		 *
+		 * @param compressionPolicy The new compression policy
+		*/
+		void setCompressionPolicy(const CompressionPolicy& compressionPolicy);
+		/**
+		 * @brief Sets which completed log files are kept. See Logger::setRetentionPolicy()
+		 *
+		 * @param retentionPolicy The new retention policy
+		*/
+		void setRetentionPolicy(const RetentionPolicy& retentionPolicy);
+		/**
+		 * @brief Drains the async queue, stops the background thread and switches the logger back to sync mode.
+			The log file is closed as well, it is reopened by the next log. It waits until the completed log files are compressed
+		*/
+		void shutdown();
+		/**
+		 * @brief Returns the number of logs lost because the async queue was full
+		 *
+		 * @return The number of dropped logs since async mode was enabled
+		*/
+		std::uint64_t droppedRecords() const;
+		/**
+		 * @brief Returns the number of logs each logging thread lost because its async queue was full. See Logger::droppedRecordsPerThread()
+		 *
+		 * @return The dropped logs of every thread with a queue
+		*/
+		std::vector<ThreadDropCount> droppedRecordsPerThread() const;
+		/**
+		 * @brief Sets how many logs each call site of the AETHER_LOG_* macros may make. See Logger::setRateLimitPolicy()
+		 *
+		 * @param rateLimitPolicy The new rate limit policy
+		*/
+		void setRateLimitPolicy(const RateLimitPolicy& rateLimitPolicy);
+		/**
+		 * @brief Sets which part of the logs of the severity is kept. See Logger::setSamplingPolicy()
+		 *
+		 * @param severity The severity to be sampled
+		 * @param samplingPolicy The new sampling policy of the severity
+		*/
+		void setSamplingPolicy(const LogSeverity severity, const SamplingPolicy& samplingPolicy);
+		/**
+		 * @brief Sets whether the repeats of the previous log are collapsed. See Logger::setDuplicateSuppression()
+		 *
+		 * @param isSuppressed The flag which indicates whether repeated logs are skipped
+		*/
+		void setDuplicateSuppression(const bool isSuppressed);
+		/**
+		 * @brief Sets whether and how the latest logs are kept in memory for a dump. See Logger::setFlightRecorderPolicy()
+		 *
+		 * @param flightRecorderPolicy The new flight recorder policy
+		*/
+		void setFlightRecorderPolicy(const FlightRecorderPolicy& flightRecorderPolicy);
+		/**
+		 * @brief Appends the records of the flight recorder which were not dumped yet to its dump file. See Logger::dumpFlightRecorder()
+		*/
+		void dumpFlightRecorder();
+		/**
+		 * @brief Returns the number of logs skipped by the rate limit
+		*/
+		std::uint64_t rateLimitedRecords() const;
+		/**
+		 * @brief Returns the number of logs skipped as repeats of the previous log
+		*/
+		std::uint64_t suppressedDuplicates() const;
+		/**
+		 * @brief Sets whether the latencies are measured and how often the receivers get the counters. See Logger::setStatsPolicy()
+		 *
+		 * @param statsPolicy The new stats policy
+		*/
+		void setStatsPolicy(const StatsPolicy& statsPolicy);
+		/**
+		 * @brief Returns a snapshot of the logger's own counters. See Logger::stats()
+		*/
+		LoggerStats stats() const;
+		/**
+		 * @brief Sets whether formatted logs are formatted by the writer thread in async mode. See Logger::setDeferredFormatting()
+		 *
+		 * @param isDeferred The flag which indicates whether the formatting is deferred to the writer thread
+		*/
+		void setDeferredFormatting(const bool isDeferred);
+		/**
+		 * @brief Checks whether formatted logs are currently formatted by the writer thread
+		 *
+		 * @return True if the deferred formatting is set and the logger works in async mode
+		*/
+		bool isDeferredFormatting() const;
+		/**
+		 * @brief Sets the fractional second digits of the log time prefix. By default only seconds are logged
+		 *
+		 * @param timestampPrecision The new timestamp precision
+		*/
+		void setTimestampPrecision(const TimestampPrecision timestampPrecision);
+		/**
+		 * @brief Sets the layout of the lines written to the text log file and the console. See Logger::setLineFormat()
+		 *
+		 * @param lineFormat The new line format
+		*/
+		void setLineFormat(const LogLineFormat lineFormat);
+
+		/**
+		 * @brief Adds the given Receiver object to the logger. The logger does not take the Receiver object's ownership!
+		 *
+		 * @param receiver The Receiver object to be added to the logger
+		*/
+		void addReceiver(Receiver* receiver);
+		/**
+		 * @brief Adds the given Receiver object to the logger with the given policy. See Logger::addReceiver()
+		 *
+		 * @param receiver The Receiver object to be added to the logger
+		 * @param receiverPolicy Whether the receiver is notified directly or on a dispatcher thread of its own
+		*/
+		void addReceiver(Receiver* receiver, const ReceiverPolicy& receiverPolicy);
+		/**
+		 * @brief Removes the given Receiver object from the logger. The removed object is not deleted!
+			It waits until the running notifications of the receiver have finished, so the object can be destroyed after the call.
+			It must not be called from a receiver of this logger. Nothing happens if the receiver is not attached
+		 *
+		 * @param receiver The Receiver object to be removed from the logger
+		*/
+		void removeReceiver(Receiver* receiver);
+		/**
+		 * @brief Removes every attached Receiver from the logger. The removed objects are not deleted!
+			It waits until the running notifications have finished and must not be called from a receiver of this logger
+		*/
+		void clearReceivers();
+		/**
+		 * @brief Returns the counters of the given isolated receiver. See Logger::receiverStats()
+		*/
+		ReceiverStats receiverStats(Receiver* receiver) const;
+
+		/**
+		 * @brief Creates a log with INFO severity
+		 *
+		 * @param message The message to be logged
+		*/
+		void logInfo(const std::string& message);
+		/**
+		 * @brief Creates a log with WARNING severity
+		 *
+		 * @param message The message to be logged
+		*/
+		void logWarning(const std::string& message);
+		/**
+		 * @brief Creates a log with ERROR severity
+		 *
+		 * @param message The message to be logged
+		*/
+		void logError(const std::string& message);
+		/**
+		 * @brief Creates a log with DEBUG severity
+		 *
+		 * @param message The message to be logged
+		*/
+		void logDebug(const std::string& message, std::string_view source, const int line);
+		/**
+		 * @brief Creates a log with TRACE severity
+		 *
+		 * @param message The message to be logged
+		*/
+		void logTrace(const std::string& message, std::string_view source, const int line);
+		/**
+		 * @brief Creates a log with the given severity (see the AETHER_LOG_* macros)
+		 *
+		 * @param severity The severity of this log
+		 * @param source The name of the source file where the log originates. Empty if no source details are needed
+		 * @param line The line number where the log originates
+		 * @param message The message to be logged
+		*/
+		void logMessage(const LogSeverity severity, std::string_view source, const int line, const std::string& message);
+		/**
+		 * @brief Creates a structured log with the given severity. The fields are kept separate from the message,
+			they are written as members or pairs of the JSON and logfmt lines (see setLineFormat()) and after the message in the TEXT lines.
+			Receivers get the message only
+		 *
+		 * @param severity The severity of this log
+		 * @param message The message to be logged
+		 * @param fields The typed fields of the log e.g.: { { "user_id", 42 }, { "latency_us", 1.7 } }
+		*/
+		void logStructured(const LogSeverity severity, std::string_view message, std::initializer_list<LogField> fields);
+		/**
+		 * @brief Creates a structured log with source details (see the AETHER_LOG_*_FIELDS macros)
+		 *
+		 * @param severity The severity of this log
+		 * @param source The name of the source file where the log originates. Empty if no source details are needed
+		 * @param line The line number where the log originates
+		 * @param message The message to be logged
+		 * @param fields The typed fields of the log
+		*/
+		void logStructured(const LogSeverity severity, std::string_view source, const int line, std::string_view message, std::initializer_list<LogField> fields);
+
+		/**
+		 * @brief Checks whether a log of the given severity would be made. An uninitialized logger reports every severity as enabled,
+			so the log itself can report the missing initialization
+		 *
+		 * @param severity The severity to be checked
+		 *
+		 * @return False if the severity exceeds both the severity limit and the severity of the flight recorder
+		*/
+		bool isSeverityEnabled(const LogSeverity severity) const
+		{
+			return severity <= m_activeSeverityLimit.load(std::memory_order_relaxed);
+		}
+		/**
+		 * @brief Checks the sampling and the rate limit of a call site (see the AETHER_LOG_* macros).
+			It is a single relaxed atomic load while neither is enabled for the severity. The probability of the sampling is drawn inline
+			and a skipped log is counted into the cached counter of the thread, so such a log does not call into the library
+		 *
+		 * @param severity The severity of the log
+		 * @param callSite The state of the call site
+		 *
+		 * @return False if the log is to be skipped
+		*/
+		bool isCallSiteAllowed(const LogSeverity severity, CallSiteState& callSite)
+		{
+			const auto checks = m_callSiteChecks.load(std::memory_order_relaxed);
+			if ((checks & (RATE_LIMIT_CHECK | samplingCheck(severity))) == 0)
+			{
+				return true;
+			}
+
+			if ((checks & samplingCheck(severity)) != 0)
+			{
+				const auto threshold = m_sampling[static_cast<std::size_t>(severity)].Threshold.load(std::memory_order_relaxed);
+				if (threshold != UINT64_MAX && threadRandomNumber() >= threshold)
+				{
+					//The counter is only looked up when the thread counts for another logger than last time
+					auto& cache = sampledOutCounterCache();
+					if (cache.CollectorId != m_stats.id())
+					{
+						cache.Counter = &sampledOutCounter();
+						cache.CollectorId = m_stats.id();
+					}
+					cache.Counter->store(cache.Counter->load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+					return false;
+				}
+			}
+			return checkCallSite(severity, callSite);
+		}
+
+		/**
+		 * @brief Creates a log from the format of the call site and the given arguments (see the AETHER_LOG_* macros).
+			The message is built in a reused per-thread buffer, so no memory is allocated in the steady state.
+			With deferred formatting only the raw bytes of the arguments are queued and the writer thread builds the message.
+			Nothing is formatted if the severity exceeds both the severity limit and the severity of the flight recorder
+		 *
+		 * @param callSite The static descriptor of the call site
+		 * @param args The arguments to be formatted. Arithmetic, enum, pointer, character, boolean and string types are supported
+		*/
+		template<typename... Args>
+		void logFormatted(const CallSite& callSite, const Args&... args)
+		{
+			if (!isSeverityEnabled(callSite.Severity))
+			{
+				return;
+			}
+
+			FormatBuffer buffer;
+			auto& message = buffer.get();
+
+			//Binary log files store the encoded arguments instead of the formatted message
+			if (isDeferredFormatting() || m_logFileMode.load(std::memory_order_relaxed) == LogFileMode::BINARY)
+			{
+				decltype(argumentCodec(args...))::encode(message, args...);
+				logDeferred(callSite, message);
+				return;
+			}
+
+			formatMessage(message, callSite.Format, args...);
+
+			if (!callSite.Source.empty())
+			{
+				FormatBuffer fieldBuffer;
+				addSourceDetails(message, fieldBuffer.get(), callSite.Source, callSite.Line);
+				log(message, callSite.Severity, fieldBuffer.get(), callSite.Source, callSite.Line);
+				return;
+			}
+
+			log(message, callSite.Severity);
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,59 @@
+#include "LoggerRegistry.h"
+
+namespace aether_cpplogger
+{
+	std::map<std::string, std::shared_ptr<LoggerInstance>, std::less<>> LoggerRegistry::s_loggers;
+	std::mutex LoggerRegistry::s_loggersMutex;
+
+	std::shared_ptr<LoggerInstance> LoggerRegistry::get(std::string_view name)
+	{
+		std::lock_guard lock(s_loggersMutex);
+
+		if (const auto& it = s_loggers.find(name); it != s_loggers.end())
+		{
+			return it->second;
+		}
+
+		const auto& logger = std::make_shared<LoggerInstance>(name);
+		s_loggers.emplace(std::string(name), logger);
+
+		return logger;
+	}
+
+	std::shared_ptr<LoggerInstance> LoggerRegistry::find(std::string_view name)
+	{
+		std::lock_guard lock(s_loggersMutex);
+
+		const auto& it = s_loggers.find(name);
+		return it != s_loggers.end() ? it->second : nullptr;
+	}
+
+	bool LoggerRegistry::remove(std::string_view name)
+	{
+		std::shared_ptr<LoggerInstance> removedLogger;
+		{
+			std::lock_guard lock(s_loggersMutex);
+
+			const auto& it = s_loggers.find(name);
+			if (it == s_loggers.end())
+			{
+				return false;
+			}
+
+			removedLogger = std::move(it->second);
+			s_loggers.erase(it);
+		}
+
+		//The logger may be shut down here, outside of the registry lock
+		return true;
+	}
+
+	void LoggerRegistry::clear()
+	{
+		std::map<std::string, std::shared_ptr<LoggerInstance>, std::less<>> removedLoggers;
+		{
+			std::lock_guard lock(s_loggersMutex);
+			removedLoggers.swap(s_loggers);
+		}
+	}
+}
\ No newline at end of file
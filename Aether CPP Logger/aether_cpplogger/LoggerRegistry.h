@@ -0,0 +1,62 @@
+#pragma once
+#include "Export.h"
+#include "LoggerInstance.h"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief Thread-safe registry of the named loggers.
+	 *
+	 * Each subsystem can get its own LoggerInstance with its own log file, severity limit and receivers.
+	 * The default logger of the static Logger interface is not part of the registry, see Logger::defaultLogger()
+	*/
+	class AETHER_CPPLOGGER_API LoggerRegistry
+	{
+	private:
+		/**
+		 * @brief static map of the registered loggers by their names
+		*/
+		static std::map<std::string, std::shared_ptr<LoggerInstance>, std::less<>> s_loggers;
+		/**
+		 * @brief static mutex which guards the map of the registered loggers
+		*/
+		static std::mutex s_loggersMutex;
+
+	public:
+		/**
+		 * @brief Returns the logger with the given name. It is created uninitialized if it does not exist yet
+		 *
+		 * @param name The name of the logger
+		 *
+		 * @return The logger with the given name
+		*/
+		static std::shared_ptr<LoggerInstance> get(std::string_view name);
+		/**
+		 * @brief Looks up the logger with the given name
+		 *
+		 * @param name The name of the logger
+		 *
+		 * @return The logger with the given name or nullptr if it does not exist
+		*/
+		static std::shared_ptr<LoggerInstance> find(std::string_view name);
+		/**
+		 * @brief Removes the logger with the given name from the registry.
+			The logger is shut down when the last shared pointer to it is released
+		 *
+		 * @param name The name of the logger
+		 *
+		 * @return True if the logger existed
+		*/
+		static bool remove(std::string_view name);
+		/**
+		 * @brief Removes every logger from the registry
+		*/
+		static void clear();
+	};
+}
\ No newline at end of file
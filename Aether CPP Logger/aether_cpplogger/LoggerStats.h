@@ -0,0 +1,71 @@
+#pragma once
+#include "LatencyHistogram.h"
+#include "LogSeverity.h"
+
+#include <array>
+#include <cstdint>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief A snapshot of the counters a logger keeps about itself. Every counter covers the lifetime of the logger
+	*/
+	struct LoggerStats
+	{
+		/**
+		 * @brief Number of logs passed to the outputs for each severity, indexed by the value of LogSeverity.
+			It includes the logs dropped later by a full async queue
+		*/
+		std::array<std::uint64_t, 5> Records{};
+		/**
+		 * @brief Number of bytes handed to the log files, before the compression of the COMPRESSED mode
+		*/
+		std::uint64_t BytesWritten = 0;
+		/**
+		 * @brief Number of times an open log file was completed and the next one was opened
+		*/
+		std::uint64_t Rotations = 0;
+		/**
+		 * @brief Number of errors of the log file writing which were raised as LoggerException
+		*/
+		std::uint64_t Exceptions = 0;
+		/**
+		 * @brief Number of logs lost because the async queue was full. Unlike Logger::droppedRecords() it is not reset with the async mode
+		*/
+		std::uint64_t DroppedRecords = 0;
+		/**
+		 * @brief Number of logs skipped by the rate limit
+		*/
+		std::uint64_t RateLimitedRecords = 0;
+		/**
+		 * @brief Number of logs which the sampling did not keep
+		*/
+		std::uint64_t SampledOutRecords = 0;
+		/**
+		 * @brief Number of logs skipped as repeats of the previous log
+		*/
+		std::uint64_t SuppressedDuplicates = 0;
+
+		/**
+		 * @brief The time the logging thread spent handing a log over: the queue push in async mode, every output in sync mode.
+			The latencies are only measured if StatsPolicy::IsLatencyTracked is set
+		*/
+		LatencyHistogram EnqueueLatency;
+		/**
+		 * @brief The time of a single write into the log file, including the wait for the log file lock and a flush it triggers
+		*/
+		LatencyHistogram WriteLatency;
+		/**
+		 * @brief The time of a single flush of the buffered lines into the log file
+		*/
+		LatencyHistogram FlushLatency;
+
+		/**
+		 * @brief Returns the number of logs passed to the outputs with the given severity
+		*/
+		std::uint64_t records(const LogSeverity severity) const
+		{
+			return Records[static_cast<std::size_t>(severity)];
+		}
+	};
+}
\ No newline at end of file
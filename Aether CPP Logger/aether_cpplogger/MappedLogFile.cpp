@@ -0,0 +1,268 @@
+#include "MappedLogFile.h"
+#include "LogFile.h"
+
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace aether_cpplogger
+{
+	MappedLogFile::~MappedLogFile()
+	{
+		close();
+	}
+
+	bool MappedLogFile::open(const std::string& path, const DateTime& dateTime, const int index, const std::size_t capacity)
+	{
+		close();
+
+#ifdef _WIN32
+		const HANDLE fileHandle = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+			nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (fileHandle == INVALID_HANDLE_VALUE)
+		{
+			return false;
+		}
+		m_fileHandle = fileHandle;
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(fileHandle, &fileSize))
+		{
+			unmap(0);
+			return false;
+		}
+		const auto size = static_cast<std::size_t>(fileSize.QuadPart);
+#else
+		m_fileDescriptor = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+		if (m_fileDescriptor < 0)
+		{
+			return false;
+		}
+
+		struct stat fileStatus;
+		if (fstat(m_fileDescriptor, &fileStatus) != 0)
+		{
+			unmap(0);
+			return false;
+		}
+		const auto size = static_cast<std::size_t>(fileStatus.st_size);
+#endif
+
+		//The new lines are appended, an existing file over the capacity is kept as it is and rejects every line
+		if (!map(size < capacity ? capacity : size, size))
+		{
+			return false;
+		}
+
+		//A crash leaves the preallocated tail filled with NUL bytes, the new lines continue after the written data
+		//and the tail is truncated when the file is closed
+		const auto dataSize = findDataEnd(size);
+
+		m_year = dateTime.Year;
+		m_month = dateTime.Month;
+		m_day = dateTime.Day;
+		m_index = index;
+		m_path = path;
+		m_offset.store(dataSize);
+		m_dataEnd.store(dataSize);
+
+		//Publishes the members above to the writers
+		m_isOpen.store(true);
+
+		return true;
+	}
+
+	bool MappedLogFile::map(const std::size_t capacity, const std::size_t size)
+	{
+#ifdef _WIN32
+		//Creating the mapping extends the file to its full size
+		const auto mappingSize = static_cast<std::uint64_t>(capacity);
+		m_mappingHandle = CreateFileMappingA(m_fileHandle, nullptr, PAGE_READWRITE,
+			static_cast<DWORD>(mappingSize >> 32), static_cast<DWORD>(mappingSize & 0xFFFFFFFF), nullptr);
+		if (!m_mappingHandle)
+		{
+			unmap(size);
+			return false;
+		}
+
+		m_data = static_cast<char*>(MapViewOfFile(m_mappingHandle, FILE_MAP_WRITE, 0, 0, capacity));
+		if (!m_data)
+		{
+			unmap(size);
+			return false;
+		}
+#else
+		//Allocate the blocks up front so writing into the mapping never runs out of disk space with SIGBUS.
+		//Extending a file which cannot be preallocated would leave it sparse, so the file is not mapped then
+		if (posix_fallocate(m_fileDescriptor, 0, static_cast<off_t>(capacity)) != 0)
+		{
+			unmap(size);
+			return false;
+		}
+
+		void* data = mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, m_fileDescriptor, 0);
+		if (data == MAP_FAILED)
+		{
+			unmap(size);
+			return false;
+		}
+		m_data = static_cast<char*>(data);
+#endif
+
+		m_capacity = capacity;
+
+		return true;
+	}
+
+	std::size_t MappedLogFile::findDataEnd(const std::size_t size) const
+	{
+		std::size_t end = size;
+		while (end > 0 && m_data[end - 1] == '\0')
+		{
+			--end;
+		}
+
+		return end;
+	}
+
+	void MappedLogFile::unmap(const std::size_t size)
+	{
+#ifdef _WIN32
+		if (m_data)
+		{
+			UnmapViewOfFile(m_data);
+		}
+		if (m_mappingHandle)
+		{
+			CloseHandle(m_mappingHandle);
+		}
+		if (m_fileHandle)
+		{
+			//The file can only be truncated after the view and the mapping are closed
+			LARGE_INTEGER fileSize;
+			fileSize.QuadPart = static_cast<LONGLONG>(size);
+			if (SetFilePointerEx(m_fileHandle, fileSize, nullptr, FILE_BEGIN))
+			{
+				SetEndOfFile(m_fileHandle);
+			}
+			CloseHandle(m_fileHandle);
+		}
+		m_mappingHandle = nullptr;
+		m_fileHandle = nullptr;
+#else
+		if (m_data)
+		{
+			munmap(m_data, m_capacity);
+		}
+		if (m_fileDescriptor >= 0)
+		{
+			if (ftruncate(m_fileDescriptor, static_cast<off_t>(size)) != 0)
+			{
+				std::cerr << "Log file could not be truncated" << std::endl;
+			}
+			::close(m_fileDescriptor);
+		}
+		m_fileDescriptor = -1;
+#endif
+		m_data = nullptr;
+		m_capacity = 0;
+	}
+
+	void MappedLogFile::close()
+	{
+		if (!m_isOpen.load())
+		{
+			return;
+		}
+
+		//Writers check the flag after announcing themselves, so after this loop nobody is left in the mapping
+		m_isOpen.store(false);
+		while (m_writers.load() != 0)
+		{
+			std::this_thread::yield();
+		}
+
+		const std::size_t offset = m_offset.load();
+		unmap(offset <= m_capacity ? offset : m_dataEnd.load());
+
+		m_year = 0;
+		m_month = 0;
+		m_day = 0;
+		m_index = 1;
+		m_path.clear();
+	}
+
+	bool MappedLogFile::writeLine(std::string_view message, const DateTime& dateTime)
+	{
+		m_writers.fetch_add(1);
+
+		bool isWritten = false;
+		if (m_isOpen.load() && isSameDate(dateTime))
+		{
+			const std::size_t length = message.size() + LINE_ENDING.size();
+			const std::size_t start = m_offset.fetch_add(length);
+			if (start + length <= m_capacity)
+			{
+				std::memcpy(m_data + start, message.data(), message.size());
+				std::memcpy(m_data + start + message.size(), LINE_ENDING.data(), LINE_ENDING.size());
+				isWritten = true;
+			}
+			else if (start <= m_capacity)
+			{
+				//Only one reservation can cross the capacity, every written line ends before it
+				m_dataEnd.store(start);
+			}
+		}
+
+		m_writers.fetch_sub(1);
+
+		return isWritten;
+	}
+
+	void MappedLogFile::flush()
+	{
+		if (!m_isOpen.load())
+		{
+			return;
+		}
+
+#ifdef _WIN32
+		FlushViewOfFile(m_data, 0);
+#else
+		msync(m_data, m_capacity, MS_ASYNC);
+#endif
+	}
+
+	bool MappedLogFile::isOpen() const
+	{
+		return m_isOpen.load();
+	}
+
+	bool MappedLogFile::isSameDate(const DateTime& dateTime) const
+	{
+		return m_day == dateTime.Day &&
+			m_month == dateTime.Month &&
+			m_year == dateTime.Year;
+	}
+
+	int MappedLogFile::index() const
+	{
+		return m_index;
+	}
+
+	const std::string& MappedLogFile::path() const
+	{
+		return m_path;
+	}
+}
\ No newline at end of file
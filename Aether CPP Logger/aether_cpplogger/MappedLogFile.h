@@ -0,0 +1,152 @@
+#pragma once
+#include "DateTime.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief A log file which is preallocated to its full capacity and mapped into memory.
+	 *
+	 * Logging threads reserve a byte range with an atomic fetch_add and copy the line into the mapping,
+	 * so writing a line neither takes a lock nor makes a system call. A line which does not fit anymore is rejected
+	 * and the owner rotates to the next file. The unused tail is truncated when the file is closed, so the file stays valid text.
+	 * Opening and closing must be serialized by the owner, writing is safe from any thread at any time
+	*/
+	class MappedLogFile
+	{
+	private:
+#ifdef _WIN32
+		void* m_fileHandle = nullptr;
+		void* m_mappingHandle = nullptr;
+#else
+		int m_fileDescriptor = -1;
+#endif
+		char* m_data = nullptr;
+		/**
+		 * @brief The size of the mapping in bytes
+		*/
+		std::size_t m_capacity = 0;
+		/**
+		 * @brief The date of the file. A new file is needed when the date of the log differs
+		*/
+		int m_year = 0;
+		int m_month = 0;
+		int m_day = 0;
+		/**
+		 * @brief The index of the file within its date
+		*/
+		int m_index = 1;
+		/**
+		 * @brief The full path of the open file
+		*/
+		std::string m_path;
+
+		/**
+		 * @brief The end of the last reservation. It can run past the capacity as rejected lines reserve their range too
+		*/
+		std::atomic<std::size_t> m_offset{ 0 };
+		/**
+		 * @brief The end of the written data once a reservation crossed the capacity
+		*/
+		std::atomic<std::size_t> m_dataEnd{ 0 };
+		/**
+		 * @brief Number of threads currently inside writeLine(). Closing waits until it drops to zero
+		*/
+		std::atomic<int> m_writers{ 0 };
+		/**
+		 * @brief Flag which indicates whether the mapping can be written. The other members may only be read by writers while it is set
+		*/
+		std::atomic<bool> m_isOpen{ false };
+
+		/**
+		 * @brief Maps the opened file with the given capacity
+		 *
+		 * @param capacity The size of the mapping in bytes
+		 * @param size The current size of the file in bytes
+		 *
+		 * @return True if the file could be extended and mapped
+		*/
+		bool map(const std::size_t capacity, const std::size_t size);
+		/**
+		 * @brief Finds the end of the written data in the mapped file by skipping the NUL bytes of its preallocated tail
+		 *
+		 * @param size The current size of the file in bytes
+		 *
+		 * @return The size of the written data in bytes
+		*/
+		std::size_t findDataEnd(const std::size_t size) const;
+		/**
+		 * @brief Unmaps the file, truncates it to the given size and closes it
+		 *
+		 * @param size The size of the written data in bytes
+		*/
+		void unmap(const std::size_t size);
+
+	public:
+		MappedLogFile() = default;
+		/**
+		 * @brief Truncates the unused tail and closes the file
+		*/
+		~MappedLogFile();
+
+		MappedLogFile(const MappedLogFile&) = delete;
+		MappedLogFile& operator=(const MappedLogFile&) = delete;
+
+		/**
+		 * @brief Opens the given file, preallocates it to the given capacity and maps it. The new lines are appended after the existing content,
+			the NUL bytes left in the preallocated tail by a crash are skipped. The previously opened file is closed
+		 *
+		 * @param path The full path of the log file
+		 * @param dateTime The date of the log file
+		 * @param index The index of the file within its date
+		 * @param capacity The size of the file in bytes after the preallocation
+		 *
+		 * @return True if the file could be opened and mapped. False if it cannot be preallocated either
+		*/
+		bool open(const std::string& path, const DateTime& dateTime, const int index, const std::size_t capacity);
+		/**
+		 * @brief Waits for the running writes, truncates the unused tail and closes the file if it is open
+		*/
+		void close();
+		/**
+		 * @brief Copies the given message as a new line into the mapping. It does not take a lock
+		 *
+		 * @param message The message to be written
+		 * @param dateTime The DateTime of the log. The line is rejected if it belongs to another date
+		 *
+		 * @return True if the line was written. False if no file is open, the date differs or the line does not fit
+		*/
+		bool writeLine(std::string_view message, const DateTime& dateTime);
+		/**
+		 * @brief Starts writing the modified pages to the disk without waiting for it.
+			The written lines are visible to other processes without flushing
+		*/
+		void flush();
+
+		/**
+		 * @brief Returns whether a file is currently open
+		*/
+		bool isOpen() const;
+		/**
+		 * @brief Checks whether the open file belongs to the date of the given DateTime
+		 *
+		 * @param dateTime The DateTime to be compared
+		 *
+		 * @return True if a file is open and its date matches
+		*/
+		bool isSameDate(const DateTime& dateTime) const;
+		/**
+		 * @brief Returns the index of the open file within its date
+		*/
+		int index() const;
+		/**
+		 * @brief Returns the full path of the open file. It is empty if no file is open
+		*/
+		const std::string& path() const;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,411 @@
+#pragma once
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief Counts the {} placeholders of a log format. {{ and }} are escaped braces
+	 *
+	 * @param format The log format
+	 *
+	 * @return The number of placeholders or -1 if the format contains an unmatched or unsupported brace
+	*/
+	constexpr int countPlaceholders(std::string_view format)
+	{
+		int placeholders = 0;
+		for (std::size_t i = 0; i < format.size(); ++i)
+		{
+			if (format[i] == '{')
+			{
+				if (i + 1 < format.size() && format[i + 1] == '{')
+				{
+					++i;
+				}
+				else if (i + 1 < format.size() && format[i + 1] == '}')
+				{
+					++placeholders;
+					++i;
+				}
+				else
+				{
+					return -1;
+				}
+			}
+			else if (format[i] == '}')
+			{
+				if (i + 1 < format.size() && format[i + 1] == '}')
+				{
+					++i;
+				}
+				else
+				{
+					return -1;
+				}
+			}
+		}
+
+		return placeholders;
+	}
+
+	/**
+	 * @brief Yields the number of the given arguments as a type. It is only used in unevaluated context (decltype)
+	*/
+	template<typename... Args>
+	std::integral_constant<int, static_cast<int>(sizeof...(Args))> countArguments(const Args&...);
+
+	/**
+	 * @brief Appends the literal part of the format up to the next placeholder and removes both from the format
+	 *
+	 * @param destination The string to be appended
+	 * @param format The remaining part of the format
+	 *
+	 * @return True if a placeholder was found
+	*/
+	inline bool appendFormatLiteral(std::string& destination, std::string_view& format)
+	{
+		std::size_t i = 0;
+		while (i < format.size())
+		{
+			const char character = format[i];
+			if ((character == '{' || character == '}') && i + 1 < format.size())
+			{
+				const char next = format[i + 1];
+				if (character == '{' && next == '}')
+				{
+					format.remove_prefix(i + 2);
+					return true;
+				}
+				else if (next == character)
+				{
+					//Escaped brace
+					destination += character;
+					i += 2;
+					continue;
+				}
+			}
+
+			destination += character;
+			++i;
+		}
+
+		format.remove_prefix(i);
+		return false;
+	}
+
+	/**
+	 * @brief Appends a string argument
+	*/
+	inline void appendFormatArgument(std::string& destination, std::string_view value)
+	{
+		destination += value;
+	}
+
+	/**
+	 * @brief Appends a C string argument
+	*/
+	inline void appendFormatArgument(std::string& destination, const char* value)
+	{
+		destination += value ? std::string_view(value) : std::string_view("(null)");
+	}
+
+	/**
+	 * @brief Appends a character argument
+	*/
+	inline void appendFormatArgument(std::string& destination, const char value)
+	{
+		destination += value;
+	}
+
+	/**
+	 * @brief Appends a boolean argument as true or false
+	*/
+	inline void appendFormatArgument(std::string& destination, const bool value)
+	{
+		destination += value ? std::string_view("true") : std::string_view("false");
+	}
+
+	/**
+	 * @brief Appends a pointer argument in hexadecimal form
+	*/
+	inline void appendFormatArgument(std::string& destination, const void* value)
+	{
+		char buffer[2 + 2 * sizeof(std::uintptr_t)] = { '0', 'x' };
+		const auto result = std::to_chars(buffer + 2, buffer + sizeof(buffer), reinterpret_cast<std::uintptr_t>(value), 16);
+		destination.append(buffer, result.ptr);
+	}
+
+	/**
+	 * @brief Appends a string, arithmetic, enum or pointer argument without allocating a temporary string
+	*/
+	template<typename T>
+	void appendFormatArgument(std::string& destination, const T& value)
+	{
+		if constexpr (std::is_same_v<std::decay_t<T>, char*> || std::is_same_v<std::decay_t<T>, const char*>)
+		{
+			appendFormatArgument(destination, static_cast<const char*>(value));
+		}
+		else if constexpr (std::is_convertible_v<const T&, std::string_view>)
+		{
+			appendFormatArgument(destination, std::string_view(value));
+		}
+		else if constexpr (std::is_enum_v<T>)
+		{
+			appendFormatArgument(destination, static_cast<std::underlying_type_t<T>>(value));
+		}
+		else if constexpr (std::is_pointer_v<T>)
+		{
+			appendFormatArgument(destination, static_cast<const void*>(value));
+		}
+		else if constexpr (std::is_arithmetic_v<T>)
+		{
+			//Large enough for any integer and the shortest round-trip form of any floating point value
+			char buffer[64];
+			const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+			destination.append(buffer, result.ptr);
+		}
+		else
+		{
+			static_assert(std::is_arithmetic_v<T>, "The log argument type is not supported by the log format");
+		}
+	}
+
+	/**
+	 * @brief Writes the remaining part of the format when there are no more arguments
+	*/
+	inline void formatMessage(std::string& destination, std::string_view format)
+	{
+		appendFormatLiteral(destination, format);
+	}
+
+	/**
+	 * @brief Appends the format to the destination with each {} placeholder replaced by the next argument
+	 *
+	 * @param destination The string to be appended. Its capacity is reused
+	 * @param format The log format
+	 * @param first The argument of the next placeholder
+	 * @param rest The arguments of the remaining placeholders
+	*/
+	template<typename First, typename... Rest>
+	void formatMessage(std::string& destination, std::string_view format, const First& first, const Rest&... rest)
+	{
+		if (appendFormatLiteral(destination, format))
+		{
+			appendFormatArgument(destination, first);
+		}
+
+		formatMessage(destination, format, rest...);
+	}
+
+	/**
+	 * @brief True if the argument type is formatted as a string
+	*/
+	template<typename T>
+	constexpr bool isStringArgument = std::is_same_v<std::decay_t<T>, char*> ||
+		std::is_same_v<std::decay_t<T>, const char*> ||
+		std::is_convertible_v<const T&, std::string_view>;
+
+	/**
+	 * @brief Returns the type tag of an encoded argument. The tags follow the format characters of Python's struct module
+		('s' is a length-prefixed string), so the binary log files can be decoded without the argument types
+	*/
+	template<typename T>
+	constexpr char argumentType()
+	{
+		if constexpr (isStringArgument<T>)
+		{
+			return 's';
+		}
+		else if constexpr (std::is_enum_v<T>)
+		{
+			return argumentType<std::underlying_type_t<T>>();
+		}
+		else if constexpr (std::is_pointer_v<T>)
+		{
+			return 'P';
+		}
+		else if constexpr (std::is_same_v<T, bool>)
+		{
+			return '?';
+		}
+		else if constexpr (std::is_same_v<T, char>)
+		{
+			return 'c';
+		}
+		else if constexpr (std::is_integral_v<T>)
+		{
+			constexpr char signedTags[] = { 'b', 'h', 'i', 'q' };
+			constexpr char unsignedTags[] = { 'B', 'H', 'I', 'Q' };
+			constexpr int sizeIndex = sizeof(T) == 1 ? 0 : sizeof(T) == 2 ? 1 : sizeof(T) == 4 ? 2 : 3;
+			return std::is_signed_v<T> ? signedTags[sizeIndex] : unsignedTags[sizeIndex];
+		}
+		else if constexpr (std::is_same_v<T, float>)
+		{
+			return 'f';
+		}
+		else if constexpr (std::is_same_v<T, double>)
+		{
+			return 'd';
+		}
+		else
+		{
+			return 'g';
+		}
+	}
+
+	/**
+	 * @brief Encodes log arguments into raw bytes on the logging thread and formats them later on the writer thread.
+	 *
+	 * Trivial arguments (arithmetic, enum, pointer) are copied as they are.
+	 * Strings are copied as their length followed by their characters, so the encoded arguments do not refer to the caller's memory
+	*/
+	template<typename... Args>
+	class ArgumentCodec
+	{
+	private:
+		template<typename T>
+		static void encodeArgument(std::string& destination, const T& value)
+		{
+			if constexpr (isStringArgument<T>)
+			{
+				std::string_view string;
+				if constexpr (std::is_pointer_v<std::decay_t<T>>)
+				{
+					string = value ? std::string_view(value) : std::string_view("(null)");
+				}
+				else
+				{
+					string = std::string_view(value);
+				}
+
+				const std::size_t length = string.size();
+				destination.append(reinterpret_cast<const char*>(&length), sizeof(length));
+				destination += string;
+			}
+			else
+			{
+				static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>, "The log argument type is not supported by the log format");
+				destination.append(reinterpret_cast<const char*>(&value), sizeof(T));
+			}
+		}
+
+		template<typename T>
+		static void decodeArgument(std::string& destination, std::string_view& format, const char*& arguments)
+		{
+			const bool hasPlaceholder = appendFormatLiteral(destination, format);
+
+			if constexpr (isStringArgument<T>)
+			{
+				std::size_t length;
+				std::memcpy(&length, arguments, sizeof(length));
+				arguments += sizeof(length);
+
+				if (hasPlaceholder)
+				{
+					appendFormatArgument(destination, std::string_view(arguments, length));
+				}
+				arguments += length;
+			}
+			else
+			{
+				T value;
+				std::memcpy(&value, arguments, sizeof(T));
+				arguments += sizeof(T);
+
+				if (hasPlaceholder)
+				{
+					appendFormatArgument(destination, value);
+				}
+			}
+		}
+
+	public:
+		/**
+		 * @brief The type tags of the arguments. See argumentType()
+		*/
+		static constexpr char TYPES[] = { argumentType<Args>()..., '\0' };
+
+		/**
+		 * @brief Appends the raw bytes of the arguments to the destination
+		 *
+		 * @param destination The string to be appended. Its capacity is reused
+		 * @param args The arguments to be encoded
+		*/
+		static void encode(std::string& destination, const Args&... args)
+		{
+			(encodeArgument(destination, args), ...);
+		}
+
+		/**
+		 * @brief Appends the format to the destination with each {} placeholder replaced by the next encoded argument. See DecodeFunction
+		*/
+		static void decode(std::string& destination, std::string_view format, const char* arguments)
+		{
+			(decodeArgument<Args>(destination, format, arguments), ...);
+			appendFormatLiteral(destination, format);
+		}
+	};
+
+	/**
+	 * @brief Yields the ArgumentCodec of the given arguments as a type. It is only used in unevaluated context (decltype).
+		The const reference is decayed, so string literals and char arrays are encoded as const char*
+	*/
+	template<typename... Args>
+	ArgumentCodec<std::decay_t<const Args&>...> argumentCodec(const Args&...);
+
+	/**
+	 * @brief Lends a reusable per-thread string for building a log message.
+	 *
+	 * The strings keep their capacity between the logs, so the steady state does not allocate.
+	 * Nested logs on the same thread (e.g. a Receiver which logs) get the next string of the pool
+	*/
+	class FormatBuffer
+	{
+	private:
+		static constexpr int POOL_SIZE = 4;
+
+		std::string* m_buffer;
+		std::string m_fallback;
+
+		static int& depth()
+		{
+			thread_local int t_depth = 0;
+			return t_depth;
+		}
+
+		static std::string* pool()
+		{
+			thread_local std::string t_pool[POOL_SIZE];
+			return t_pool;
+		}
+
+	public:
+		FormatBuffer()
+		{
+			const int index = depth()++;
+			m_buffer = index < POOL_SIZE ? &pool()[index] : &m_fallback;
+			m_buffer->clear();
+		}
+
+		~FormatBuffer()
+		{
+			--depth();
+		}
+
+		FormatBuffer(const FormatBuffer&) = delete;
+		FormatBuffer& operator=(const FormatBuffer&) = delete;
+
+		/**
+		 * @brief Returns the lent string
+		*/
+		std::string& get()
+		{
+			return *m_buffer;
+		}
+	};
+}
\ No newline at end of file
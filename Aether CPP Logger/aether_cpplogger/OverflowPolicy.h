@@ -0,0 +1,14 @@
+#pragma once
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief Defines what happens with a new log when a bounded queue is full
+	*/
+	enum class OverflowPolicy
+	{
+		BLOCK,
+		DROP_NEWEST,
+		DROP_OLDEST
+	};
+}
\ No newline at end of file
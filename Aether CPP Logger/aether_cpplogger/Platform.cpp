@@ -0,0 +1,59 @@
+#include "Platform.h"
+
+#include <cstdlib>
+
+namespace
+{
+	/**
+	 * @brief Returns the value of the given environment variable, or an empty string if it is not set
+	*/
+	std::string environmentVariable(const char* name)
+	{
+#ifdef _WIN32
+		char* value = nullptr;
+		if (_dupenv_s(&value, nullptr, name) != 0 || !value)
+		{
+			return std::string();
+		}
+
+		std::string result(value);
+		std::free(value);
+		return result;
+#else
+		const char* value = std::getenv(name);
+		return value ? std::string(value) : std::string();
+#endif
+	}
+}
+
+namespace aether_cpplogger
+{
+	std::string userDataFolder()
+	{
+#ifdef _WIN32
+		//The Roaming AppData folder
+		return environmentVariable("APPDATA");
+#else
+		//The XDG base directory of the user specific data files
+		const auto& dataHome = environmentVariable("XDG_DATA_HOME");
+		if (!dataHome.empty())
+		{
+			return dataHome;
+		}
+
+		const auto& home = environmentVariable("HOME");
+		return home.empty() ? std::string() : home + "/.local/share";
+#endif
+	}
+
+	std::tm toLocalTime(const std::time_t time)
+	{
+		std::tm localTime{};
+#ifdef _WIN32
+		localtime_s(&localTime, &time);
+#else
+		localtime_r(&time, &localTime);
+#endif
+		return localTime;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,31 @@
+#pragma once
+#include <ctime>
+#include <string>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief The directory separator of the paths built by the Logger
+	*/
+#ifdef _WIN32
+	constexpr char PATH_SEPARATOR = '\\';
+#else
+	constexpr char PATH_SEPARATOR = '/';
+#endif
+
+	/**
+	 * @brief Returns the folder of the per-user application data: %APPDATA% on Windows,
+		$XDG_DATA_HOME or ~/.local/share on the other platforms
+	 *
+	 * @return The path of the folder without a trailing separator. Empty if it could not be determined
+	*/
+	std::string userDataFolder();
+	/**
+	 * @brief Breaks the given time down to the local calendar time. It is thread safe unlike std::localtime()
+	 *
+	 * @param time Seconds since the Unix epoch
+	 *
+	 * @return The local calendar time
+	*/
+	std::tm toLocalTime(const std::time_t time);
+}
\ No newline at end of file
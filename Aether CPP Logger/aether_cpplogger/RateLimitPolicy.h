@@ -0,0 +1,26 @@
+#pragma once
+#include <cstdint>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief Defines how many logs a call site of the AETHER_LOG_* macros may make.
+		Each call site has its own token bucket: it holds up to Burst logs and refills with LogsPerSecond.
+		The logs of an empty bucket are skipped before their arguments are evaluated
+	*/
+	struct RateLimitPolicy
+	{
+		/**
+		 * @brief Limit the logs of each call site
+		*/
+		bool IsEnabled = false;
+		/**
+		 * @brief The sustained number of logs per second of a call site
+		*/
+		double LogsPerSecond = 10.0;
+		/**
+		 * @brief The number of logs a call site may make at once after being quiet
+		*/
+		std::uint32_t Burst = 100;
+	};
+}
\ No newline at end of file
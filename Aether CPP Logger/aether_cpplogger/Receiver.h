@@ -1,14 +1,68 @@
 #pragma once
+#include "LoggerStats.h"
+#include "RecordView.h"
+
+#include <cstddef>
 #include <string_view>
 
 namespace aether_cpplogger
 {
+	/**
+	 * @brief The base class of the objects which are notified about the logs of a logger.
+	 *
+	 * A receiver overrides one of the three levels, each level forwards to the one below by default:
+	 * onReceiveBatch() gets the logs the async writer thread drained together, onReceiveRecord() gets a single log with its details
+	 * and onReceive() gets only its message. In sync mode every log is a batch of its own.
+	 * onReceiveStats() gets the periodic reports of the logger's own counters, see StatsPolicy.
+	 * A receiver may log to the logger notifying it. On the async writer thread flush() returns immediately there
+	 * and a log which does not fit into the full queue is dropped even with the BLOCK overflow policy
+	*/
 	class Receiver
 	{
 	public:
 		Receiver() = default;
 		virtual ~Receiver() = default;
 
-		virtual void onReceive(std::string_view message) = 0;
+		/**
+		 * @brief Receives the message of a log
+		 *
+		 * @param message The message of the log without the prefixes
+		*/
+		virtual void onReceive(std::string_view message)
+		{
+			static_cast<void>(message);
+		}
+		/**
+		 * @brief Receives a log with its details. By default it forwards the message to onReceive()
+		 *
+		 * @param record The details of the log
+		*/
+		virtual void onReceiveRecord(const RecordView& record)
+		{
+			onReceive(record.Message);
+		}
+		/**
+		 * @brief Receives the logs written together in the order of their timestamps. By default it forwards them one by one to onReceiveRecord()
+		 *
+		 * @param records The first of the logs
+		 * @param count The number of the logs
+		*/
+		virtual void onReceiveBatch(const RecordView* records, const std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				onReceiveRecord(records[i]);
+			}
+		}
+		/**
+		 * @brief Receives a snapshot of the logger's own counters. It is called from the writer thread in async mode,
+			from the logging thread which finds the report due in sync mode and from the dispatcher thread of an isolated receiver
+		 *
+		 * @param stats The counters of the logger
+		*/
+		virtual void onReceiveStats(const LoggerStats& stats)
+		{
+			static_cast<void>(stats);
+		}
 	};
 }
\ No newline at end of file
@@ -0,0 +1,284 @@
+#include "ReceiverDispatcher.h"
+#include "TimestampCache.h"
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <iostream>
+
+/**
+ * @brief The dispatcher thread wakes up at least this often even if it was not notified
+*/
+constexpr auto DISPATCHER_IDLE_TIMEOUT = std::chrono::milliseconds(10);
+/**
+ * @brief The largest number of records handed to the receiver in a single call
+*/
+constexpr std::size_t MAX_BATCH_SIZE = 256;
+
+namespace
+{
+	/**
+	 * @brief Raises the maximum to the given value. Only a single thread may change the maximum
+	*/
+	void updateMaximum(std::atomic<std::int64_t>& maximum, const std::int64_t value)
+	{
+		if (value > maximum.load(std::memory_order_relaxed))
+		{
+			maximum.store(value, std::memory_order_relaxed);
+		}
+	}
+}
+
+namespace aether_cpplogger
+{
+	ReceiverDispatcher::ReceiverDispatcher(Receiver* receiver, const ReceiverPolicy& receiverPolicy) :
+		m_receiver(receiver),
+		m_overflowPolicy(receiverPolicy.Overflow),
+		m_records(receiverPolicy.Capacity)
+	{
+		m_dispatcherThread = std::thread(&ReceiverDispatcher::run, this);
+	}
+
+	ReceiverDispatcher::~ReceiverDispatcher()
+	{
+		m_isRunning.store(false);
+		wakeUpDispatcher();
+
+		if (m_dispatcherThread.joinable())
+		{
+			m_dispatcherThread.join();
+		}
+	}
+
+	void ReceiverDispatcher::push(const RecordView* records, const std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			const auto& record = records[i];
+			const auto& writeRecord = [&record](LogRecord& slot)
+			{
+				slot.Severity = record.Severity;
+				slot.Timestamp = record.Timestamp;
+				slot.ThreadId = record.ThreadId;
+				//Assigning keeps the capacity of the slot's string so the steady state does not allocate
+				slot.Message.assign(record.Message.data(), record.Message.size());
+				slot.Source.assign(record.Source.data(), record.Source.size());
+				slot.Line = record.Line;
+			};
+
+			bool isPushed = true;
+			while (!m_records.tryPush(writeRecord))
+			{
+				if (m_overflowPolicy == OverflowPolicy::DROP_NEWEST)
+				{
+					m_droppedRecords.fetch_add(1, std::memory_order_relaxed);
+					isPushed = false;
+					break;
+				}
+				else if (m_overflowPolicy == OverflowPolicy::DROP_OLDEST)
+				{
+					//Discard the oldest queued record to make room for the new one
+					if (m_records.tryPop([](LogRecord&) {}))
+					{
+						m_droppedRecords.fetch_add(1, std::memory_order_relaxed);
+						m_completedRecords.fetch_add(1, std::memory_order_release);
+					}
+				}
+				else
+				{
+					//Block the notifying thread until the dispatcher makes room
+					wakeUpDispatcher();
+					std::this_thread::yield();
+				}
+			}
+
+			if (isPushed)
+			{
+				m_pushedRecords.fetch_add(1, std::memory_order_relaxed);
+			}
+		}
+
+		//Pairs with the dispatcher thread setting the sleeping flag before checking the queue
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (m_isDispatcherSleeping.load(std::memory_order_relaxed))
+		{
+			wakeUpDispatcher();
+		}
+	}
+
+	void ReceiverDispatcher::pushStats(const LoggerStats& stats)
+	{
+		{
+			std::lock_guard lock(m_statsMutex);
+			m_pendingStats = stats;
+		}
+		m_hasPendingStats.store(true);
+		wakeUpDispatcher();
+	}
+
+	void ReceiverDispatcher::flush()
+	{
+		if (std::this_thread::get_id() == m_dispatcherThread.get_id())
+		{
+			return;
+		}
+
+		const auto target = m_pushedRecords.load();
+		m_flushWaiters.fetch_add(1);
+		wakeUpDispatcher();
+
+		std::unique_lock lock(m_mutex);
+		m_drainedCondition.wait(lock, [this, target]()
+			{
+				return m_completedRecords.load(std::memory_order_acquire) >= target;
+			});
+		m_flushWaiters.fetch_sub(1);
+	}
+
+	Receiver* ReceiverDispatcher::receiver() const
+	{
+		return m_receiver;
+	}
+
+	ReceiverStats ReceiverDispatcher::stats() const
+	{
+		ReceiverStats stats;
+		//The completed records are read first, so they cannot outnumber the pushed ones read after them
+		const auto completedRecords = m_completedRecords.load(std::memory_order_acquire);
+		stats.ReceivedRecords = m_pushedRecords.load(std::memory_order_relaxed);
+		stats.DeliveredRecords = m_deliveredRecords.load(std::memory_order_relaxed);
+		stats.DroppedRecords = m_droppedRecords.load(std::memory_order_relaxed);
+		stats.QueuedRecords = stats.ReceivedRecords > completedRecords ? stats.ReceivedRecords - completedRecords : 0;
+		stats.Lag = std::chrono::microseconds(m_lag.load(std::memory_order_relaxed));
+		stats.MaxLag = std::chrono::microseconds(m_maxLag.load(std::memory_order_relaxed));
+		stats.ReceiveTime = std::chrono::nanoseconds(m_receiveTime.load(std::memory_order_relaxed));
+		stats.MaxReceiveTime = std::chrono::nanoseconds(m_maxReceiveTime.load(std::memory_order_relaxed));
+
+		return stats;
+	}
+
+	void ReceiverDispatcher::run()
+	{
+		while (true)
+		{
+			drain();
+			deliverStats();
+			notifyFlushWaiters();
+
+			if (!m_isRunning.load() && m_records.empty())
+			{
+				break;
+			}
+
+			std::unique_lock lock(m_mutex);
+			m_isDispatcherSleeping.store(true);
+			m_wakeUpCondition.wait_for(lock, DISPATCHER_IDLE_TIMEOUT, [this]()
+				{
+					return !m_records.empty() || m_hasPendingStats.load() || !m_isRunning.load();
+				});
+			m_isDispatcherSleeping.store(false);
+		}
+	}
+
+	void ReceiverDispatcher::drain()
+	{
+		const auto& popRecord = [this](LogRecord& slot)
+		{
+			RecordView record;
+			record.Severity = slot.Severity;
+			record.Timestamp = slot.Timestamp;
+			record.ThreadId = slot.ThreadId;
+			record.Source = slot.Source;
+			record.Line = slot.Line;
+			record.Message = slot.Message;
+			m_batch.add(record);
+		};
+
+		while (true)
+		{
+			while (m_batch.size() < MAX_BATCH_SIZE && m_records.tryPop(popRecord))
+			{
+			}
+
+			if (m_batch.size() == 0)
+			{
+				return;
+			}
+
+			deliverBatch();
+		}
+	}
+
+	void ReceiverDispatcher::deliverBatch()
+	{
+		const auto* records = m_batch.views();
+		const auto count = m_batch.size();
+
+		const auto lag = std::max<std::int64_t>(Clock::now() - records[0].Timestamp, 0);
+		m_lag.store(lag, std::memory_order_relaxed);
+		updateMaximum(m_maxLag, lag);
+
+		const auto start = std::chrono::steady_clock::now();
+		try
+		{
+			m_receiver->onReceiveBatch(records, count);
+		}
+		catch (const std::exception& ex)
+		{
+			//There is no caller to forward the exception to on the dispatcher thread
+			std::cerr << ex.what() << std::endl;
+		}
+		const auto receiveTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+		m_receiveTime.fetch_add(receiveTime, std::memory_order_relaxed);
+		updateMaximum(m_maxReceiveTime, receiveTime);
+
+		m_batch.clear();
+		m_deliveredRecords.fetch_add(count, std::memory_order_relaxed);
+		m_completedRecords.fetch_add(count, std::memory_order_release);
+
+		if (m_flushWaiters.load(std::memory_order_relaxed) > 0)
+		{
+			notifyFlushWaiters();
+		}
+	}
+
+	void ReceiverDispatcher::deliverStats()
+	{
+		if (!m_hasPendingStats.exchange(false))
+		{
+			return;
+		}
+
+		//The receiver gets a copy, so the next report can be queued during the notification
+		LoggerStats stats;
+		{
+			std::lock_guard lock(m_statsMutex);
+			stats = m_pendingStats;
+		}
+
+		try
+		{
+			m_receiver->onReceiveStats(stats);
+		}
+		catch (const std::exception& ex)
+		{
+			std::cerr << ex.what() << std::endl;
+		}
+	}
+
+	void ReceiverDispatcher::wakeUpDispatcher()
+	{
+		{
+			std::lock_guard lock(m_mutex);
+		}
+		m_wakeUpCondition.notify_one();
+	}
+
+	void ReceiverDispatcher::notifyFlushWaiters()
+	{
+		{
+			std::lock_guard lock(m_mutex);
+		}
+		m_drainedCondition.notify_all();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,146 @@
+#pragma once
+#include "LogRecord.h"
+#include "LoggerStats.h"
+#include "Receiver.h"
+#include "ReceiverPolicy.h"
+#include "ReceiverStats.h"
+#include "RecordBatch.h"
+#include "RecordView.h"
+#include "RingBuffer.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief Notifies an isolated receiver on a thread of its own.
+	 *
+	 * The logs are copied into a bounded lock-free RingBuffer, which is drained by the dispatcher thread
+	 * and handed to the receiver in batches. A slow receiver only delays its own queue; when the queue is full the overflow policy decides.
+	 * The slots reuse LogRecord, only its severity, timestamp, thread, source and message are set
+	*/
+	class ReceiverDispatcher
+	{
+	private:
+		Receiver* const m_receiver;
+		const OverflowPolicy m_overflowPolicy;
+		RingBuffer<LogRecord> m_records;
+
+		/**
+		 * @brief Number of records accepted by the queue
+		*/
+		std::atomic<std::uint64_t> m_pushedRecords{ 0 };
+		/**
+		 * @brief Number of accepted records which left the queue (delivered or discarded as oldest)
+		*/
+		std::atomic<std::uint64_t> m_completedRecords{ 0 };
+		std::atomic<std::uint64_t> m_deliveredRecords{ 0 };
+		std::atomic<std::uint64_t> m_droppedRecords{ 0 };
+		/**
+		 * @brief The lag counters in microseconds and the receive time counters in nanoseconds. Only the dispatcher thread changes them
+		*/
+		std::atomic<std::int64_t> m_lag{ 0 };
+		std::atomic<std::int64_t> m_maxLag{ 0 };
+		std::atomic<std::int64_t> m_receiveTime{ 0 };
+		std::atomic<std::int64_t> m_maxReceiveTime{ 0 };
+
+		/**
+		 * @brief The copies of the records handed to the receiver together. Only the dispatcher thread uses it
+		*/
+		RecordBatch m_batch;
+		/**
+		 * @brief The latest stats report which the receiver has not got yet, guarded by m_statsMutex.
+			A newer report replaces it, the reports are snapshots of the same counters
+		*/
+		LoggerStats m_pendingStats;
+		std::atomic<bool> m_hasPendingStats{ false };
+		std::mutex m_statsMutex;
+		/**
+		 * @brief Number of threads waiting in flush()
+		*/
+		std::atomic<int> m_flushWaiters{ 0 };
+
+		std::atomic<bool> m_isRunning{ true };
+		std::atomic<bool> m_isDispatcherSleeping{ false };
+		std::mutex m_mutex;
+		std::condition_variable m_wakeUpCondition;
+		std::condition_variable m_drainedCondition;
+
+		std::thread m_dispatcherThread;
+
+		/**
+		 * @brief The loop of the dispatcher thread
+		*/
+		void run();
+		/**
+		 * @brief Pops the available records in batches and hands them to the receiver
+		*/
+		void drain();
+		/**
+		 * @brief Hands the current batch to the receiver and updates the counters
+		*/
+		void deliverBatch();
+		/**
+		 * @brief Hands the pending stats report to the receiver
+		*/
+		void deliverStats();
+		/**
+		 * @brief Wakes up the dispatcher thread if it is waiting for records
+		*/
+		void wakeUpDispatcher();
+		/**
+		 * @brief Wakes up the threads waiting in flush()
+		*/
+		void notifyFlushWaiters();
+
+	public:
+		/**
+		 * @brief Creates the queue and starts the dispatcher thread
+		 *
+		 * @param receiver The receiver to be notified
+		 * @param receiverPolicy The capacity and the overflow policy of the queue
+		*/
+		ReceiverDispatcher(Receiver* receiver, const ReceiverPolicy& receiverPolicy);
+		/**
+		 * @brief Hands the queued records to the receiver and stops the dispatcher thread.
+			It must not be called from the notification of the receiver
+		*/
+		~ReceiverDispatcher();
+
+		ReceiverDispatcher(const ReceiverDispatcher&) = delete;
+		ReceiverDispatcher& operator=(const ReceiverDispatcher&) = delete;
+
+		/**
+		 * @brief Copies the logs into the queue according to the overflow policy
+		 *
+		 * @param records The first of the logs
+		 * @param count The number of the logs
+		*/
+		void push(const RecordView* records, const std::size_t count);
+		/**
+		 * @brief Queues the stats report for the receiver. A report which the receiver has not got yet is replaced
+		 *
+		 * @param stats The counters of the logger
+		*/
+		void pushStats(const LoggerStats& stats);
+		/**
+		 * @brief Blocks until every record queued before this call has been handed to the receiver.
+			It returns right away on the dispatcher thread, which would wait for itself
+		*/
+		void flush();
+
+		/**
+		 * @brief The notified receiver
+		*/
+		Receiver* receiver() const;
+		/**
+		 * @brief Returns a snapshot of the counters
+		*/
+		ReceiverStats stats() const;
+	};
+}
\ No newline at end of file
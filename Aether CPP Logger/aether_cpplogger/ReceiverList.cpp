@@ -0,0 +1,197 @@
+#include "ReceiverList.h"
+
+#include <algorithm>
+
+namespace aether_cpplogger
+{
+	ReceiverList::~ReceiverList()
+	{
+		delete m_receivers.load();
+	}
+
+	void ReceiverList::publish(std::unique_ptr<Receivers> receivers)
+	{
+		const Receivers* newReceivers = receivers && !receivers->empty() ? receivers.release() : nullptr;
+		const Receivers* oldReceivers = m_receivers.exchange(newReceivers);
+		if (oldReceivers)
+		{
+			m_retiredReceivers.emplace_back(oldReceivers);
+		}
+	}
+
+	void ReceiverList::synchronize()
+	{
+		m_gracePeriod.synchronize();
+		m_retiredReceivers.clear();
+	}
+
+	void ReceiverList::add(Receiver* receiver, const ReceiverPolicy& receiverPolicy)
+	{
+		auto dispatcher = receiverPolicy.IsIsolated ? std::make_shared<ReceiverDispatcher>(receiver, receiverPolicy) : nullptr;
+
+		std::lock_guard lock(m_writerMutex);
+
+		const Receivers* current = m_receivers.load();
+		auto receivers = current ? std::make_unique<Receivers>(*current) : std::make_unique<Receivers>();
+		receivers->push_back({ receiver, std::move(dispatcher) });
+
+		publish(std::move(receivers));
+	}
+
+	void ReceiverList::remove(Receiver* receiver)
+	{
+		const auto& isReceiver = [receiver](const Entry& entry)
+		{
+			return entry.Target == receiver;
+		};
+
+		//The dispatcher hands over its queued logs after the writer mutex is released, so the changes are not blocked meanwhile
+		std::shared_ptr<ReceiverDispatcher> dispatcher;
+		{
+			std::lock_guard lock(m_writerMutex);
+
+			const Receivers* current = m_receivers.load();
+			if (!current || std::none_of(current->begin(), current->end(), isReceiver))
+			{
+				return;
+			}
+
+			auto receivers = std::make_unique<Receivers>(*current);
+			const auto entry = std::find_if(receivers->begin(), receivers->end(), isReceiver);
+			dispatcher = std::move(entry->Dispatcher);
+			receivers->erase(entry);
+
+			publish(std::move(receivers));
+			synchronize();
+		}
+	}
+
+	void ReceiverList::clear()
+	{
+		//The dispatchers are destroyed after the writer mutex is released, as in remove()
+		std::vector<std::shared_ptr<ReceiverDispatcher>> dispatchers;
+		{
+			std::lock_guard lock(m_writerMutex);
+
+			if (const Receivers* current = m_receivers.load())
+			{
+				for (const auto& entry : *current)
+				{
+					dispatchers.push_back(entry.Dispatcher);
+				}
+			}
+
+			publish(nullptr);
+			synchronize();
+		}
+	}
+
+	void ReceiverList::flush()
+	{
+		std::vector<std::shared_ptr<ReceiverDispatcher>> dispatchers;
+		{
+			std::lock_guard lock(m_writerMutex);
+
+			if (const Receivers* current = m_receivers.load())
+			{
+				for (const auto& entry : *current)
+				{
+					if (entry.Dispatcher)
+					{
+						dispatchers.push_back(entry.Dispatcher);
+					}
+				}
+			}
+		}
+
+		for (const auto& dispatcher : dispatchers)
+		{
+			dispatcher->flush();
+		}
+	}
+
+	ReceiverStats ReceiverList::stats(Receiver* receiver) const
+	{
+		std::lock_guard lock(m_writerMutex);
+
+		if (const Receivers* current = m_receivers.load())
+		{
+			for (const auto& entry : *current)
+			{
+				if (entry.Target == receiver && entry.Dispatcher)
+				{
+					return entry.Dispatcher->stats();
+				}
+			}
+		}
+
+		return ReceiverStats();
+	}
+
+	void ReceiverList::notify(const RecordView& record)
+	{
+		notifyBatch(&record, 1);
+	}
+
+	void ReceiverList::notifyBatch(const RecordView* records, const std::size_t count)
+	{
+		//Cheap exit for the common case without receivers
+		if (count == 0 || !m_receivers.load(std::memory_order_relaxed))
+		{
+			return;
+		}
+
+		GracePeriod::ReadGuard guard(m_gracePeriod);
+
+		const Receivers* receivers = m_receivers.load();
+		if (!receivers)
+		{
+			return;
+		}
+
+		for (const auto& entry : *receivers)
+		{
+			if (entry.Dispatcher)
+			{
+				entry.Dispatcher->push(records, count);
+			}
+			else
+			{
+				entry.Target->onReceiveBatch(records, count);
+			}
+		}
+	}
+
+	void ReceiverList::notifyStats(const LoggerStats& stats)
+	{
+		if (!m_receivers.load(std::memory_order_relaxed))
+		{
+			return;
+		}
+
+		GracePeriod::ReadGuard guard(m_gracePeriod);
+
+		const Receivers* receivers = m_receivers.load();
+		if (!receivers)
+		{
+			return;
+		}
+
+		for (const auto& entry : *receivers)
+		{
+			if (entry.Dispatcher)
+			{
+				entry.Dispatcher->pushStats(stats);
+			}
+			else
+			{
+				entry.Target->onReceiveStats(stats);
+			}
+		}
+	}
+
+	bool ReceiverList::empty() const
+	{
+		return !m_receivers.load(std::memory_order_relaxed);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,132 @@
+#pragma once
+#include "GracePeriod.h"
+#include "Receiver.h"
+#include "ReceiverDispatcher.h"
+#include "ReceiverPolicy.h"
+#include "ReceiverStats.h"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief The set of Receiver objects attached to a logger.
+	 *
+	 * Every change publishes a new immutable array, so notify() never takes a lock. It only registers itself
+	 * in the GracePeriod while it walks the array.
+	 * remove() and clear() wait for a grace period: they return only after every notification which could still see
+	 * the removed receivers has finished, so the removed objects can be destroyed right away.
+	 * An isolated receiver is notified through its ReceiverDispatcher, the notification only copies the logs into its queue
+	*/
+	class ReceiverList
+	{
+	private:
+		/**
+		 * @brief An attached receiver with its dispatcher. The dispatcher is nullptr if the receiver is notified directly
+		*/
+		struct Entry
+		{
+			Receiver* Target = nullptr;
+			std::shared_ptr<ReceiverDispatcher> Dispatcher;
+		};
+		using Receivers = std::vector<Entry>;
+
+		/**
+		 * @brief The currently published array. Nullptr if no receiver is attached
+		*/
+		std::atomic<const Receivers*> m_receivers{ nullptr };
+		/**
+		 * @brief The notifications which may still read a replaced array
+		*/
+		GracePeriod m_gracePeriod;
+
+		/**
+		 * @brief Mutex which serializes the changes. It is never taken by notify()
+		*/
+		mutable std::mutex m_writerMutex;
+		/**
+		 * @brief Replaced arrays which may still be read by running notifications. They are freed after the next grace period
+		*/
+		std::vector<std::unique_ptr<const Receivers>> m_retiredReceivers;
+
+		/**
+		 * @brief Publishes the given array and retires the previous one. The writer mutex must be held by the caller
+		 *
+		 * @param receivers The new array. An empty array is published as nullptr
+		*/
+		void publish(std::unique_ptr<Receivers> receivers);
+		/**
+		 * @brief Waits until every notification started before the call has finished and frees the retired arrays.
+			The writer mutex must be held by the caller
+		*/
+		void synchronize();
+
+	public:
+		ReceiverList() = default;
+		~ReceiverList();
+
+		ReceiverList(const ReceiverList&) = delete;
+		ReceiverList& operator=(const ReceiverList&) = delete;
+
+		/**
+		 * @brief Attaches the given receiver. It does not wait for running notifications, so a receiver may add other receivers
+		 *
+		 * @param receiver The receiver to be attached
+		 * @param receiverPolicy Whether the receiver is notified directly or on a dispatcher thread of its own
+		*/
+		void add(Receiver* receiver, const ReceiverPolicy& receiverPolicy = ReceiverPolicy());
+		/**
+		 * @brief Detaches the given receiver and waits until its running notifications have finished.
+			An isolated receiver gets its queued logs before the call returns.
+			Nothing happens if the receiver is not attached.
+			It must not be called from a notification of the same list, because it would wait for itself
+		 *
+		 * @param receiver The receiver to be detached
+		*/
+		void remove(Receiver* receiver);
+		/**
+		 * @brief Detaches every receiver and waits until the running notifications have finished.
+			The isolated receivers get their queued logs before the call returns.
+			It must not be called from a notification of the same list
+		*/
+		void clear();
+		/**
+		 * @brief Blocks until the isolated receivers have got every log queued before this call
+		*/
+		void flush();
+		/**
+		 * @brief Returns the counters of the given receiver. They are all zero if the receiver is not isolated or not attached
+		 *
+		 * @param receiver The attached receiver
+		*/
+		ReceiverStats stats(Receiver* receiver) const;
+		/**
+		 * @brief Forwards the log to every attached receiver as a batch of its own without taking a lock
+		 *
+		 * @param record The log to be forwarded
+		*/
+		void notify(const RecordView& record);
+		/**
+		 * @brief Forwards the logs to every attached receiver in a single call without taking a lock
+		 *
+		 * @param records The first of the logs to be forwarded
+		 * @param count The number of the logs
+		*/
+		void notifyBatch(const RecordView* records, const std::size_t count);
+		/**
+		 * @brief Forwards the stats report to every attached receiver without taking a lock.
+			An isolated receiver gets it on its dispatcher thread
+		 *
+		 * @param stats The counters of the logger
+		*/
+		void notifyStats(const LoggerStats& stats);
+		/**
+		 * @brief Checks whether no receiver is attached. The result may already be outdated when it is used
+		*/
+		bool empty() const;
+	};
+}
\ No newline at end of file
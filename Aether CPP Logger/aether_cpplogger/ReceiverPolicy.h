@@ -0,0 +1,29 @@
+#pragma once
+#include "OverflowPolicy.h"
+
+#include <cstddef>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief Defines how a receiver is notified about the logs.
+		An isolated receiver gets a bounded queue and a dispatcher thread of its own, so the time it spends in its notifications
+		is not added to the logging threads or to the async writer thread
+	*/
+	struct ReceiverPolicy
+	{
+		/**
+		 * @brief Notify the receiver on its own dispatcher thread instead of the thread which writes the log
+		*/
+		bool IsIsolated = false;
+		/**
+		 * @brief The number of logs the queue of an isolated receiver can hold
+		*/
+		std::size_t Capacity = 8192;
+		/**
+		 * @brief The behaviour when the queue of an isolated receiver is full.
+			BLOCK makes the thread which writes the log wait for the receiver, so it gives up the isolation
+		*/
+		OverflowPolicy Overflow = OverflowPolicy::DROP_NEWEST;
+	};
+}
\ No newline at end of file
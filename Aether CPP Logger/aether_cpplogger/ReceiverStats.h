@@ -0,0 +1,45 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief The counters of an isolated receiver. The counters of a receiver which is notified directly are all zero
+	*/
+	struct ReceiverStats
+	{
+		/**
+		 * @brief Number of logs accepted by the queue of the receiver
+		*/
+		std::uint64_t ReceivedRecords = 0;
+		/**
+		 * @brief Number of logs handed to the receiver
+		*/
+		std::uint64_t DeliveredRecords = 0;
+		/**
+		 * @brief Number of logs lost because of the overflow policy
+		*/
+		std::uint64_t DroppedRecords = 0;
+		/**
+		 * @brief Number of accepted logs which the receiver has not finished yet, including the batch it is notified with
+		*/
+		std::uint64_t QueuedRecords = 0;
+		/**
+		 * @brief The time between the creation of the oldest log of the last delivered batch and the start of its delivery
+		*/
+		std::chrono::microseconds Lag = std::chrono::microseconds(0);
+		/**
+		 * @brief The largest lag of every delivered batch
+		*/
+		std::chrono::microseconds MaxLag = std::chrono::microseconds(0);
+		/**
+		 * @brief The time the receiver spent in its notifications altogether
+		*/
+		std::chrono::nanoseconds ReceiveTime = std::chrono::nanoseconds(0);
+		/**
+		 * @brief The longest notification of the receiver
+		*/
+		std::chrono::nanoseconds MaxReceiveTime = std::chrono::nanoseconds(0);
+	};
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+#pragma once
+#include "RecordView.h"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief Collects copies of logs until they are handed to the receivers together.
+		The strings of the entries are reused, so the steady state does not allocate. An instance must be used by a single thread
+	*/
+	class RecordBatch
+	{
+	private:
+		struct Entry
+		{
+			RecordView View;
+			std::string Source;
+			std::string Message;
+		};
+
+		std::vector<Entry> m_entries;
+		std::vector<RecordView> m_views;
+		std::size_t m_size = 0;
+
+	public:
+		/**
+		 * @brief Copies the log into the batch
+		*/
+		void add(const RecordView& record)
+		{
+			if (m_size == m_entries.size())
+			{
+				m_entries.emplace_back();
+			}
+
+			auto& entry = m_entries[m_size++];
+			entry.View = record;
+			entry.Source.assign(record.Source.data(), record.Source.size());
+			entry.Message.assign(record.Message.data(), record.Message.size());
+		}
+
+		/**
+		 * @brief Returns the views of the collected logs. They are valid until the next change of the batch
+		*/
+		const RecordView* views()
+		{
+			m_views.resize(m_size);
+			for (std::size_t i = 0; i < m_size; ++i)
+			{
+				m_views[i] = m_entries[i].View;
+				m_views[i].Source = m_entries[i].Source;
+				m_views[i].Message = m_entries[i].Message;
+			}
+			return m_views.data();
+		}
+
+		std::size_t size() const
+		{
+			return m_size;
+		}
+
+		void clear()
+		{
+			m_size = 0;
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,41 @@
+#pragma once
+#include "LogSeverity.h"
+
+#include <cstdint>
+#include <string_view>
+#include <thread>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief The details of a log as they are passed to the receivers. The views are only valid during the notification
+	*/
+	struct RecordView
+	{
+		/**
+		 * @brief The severity of the log
+		*/
+		LogSeverity Severity = LogSeverity::INFO;
+		/**
+		 * @brief The creation time of the log in microseconds since the Unix epoch (see Clock)
+		*/
+		std::int64_t Timestamp = 0;
+		/**
+		 * @brief The ID of the thread which made the log
+		*/
+		std::thread::id ThreadId;
+		/**
+		 * @brief The name of the source file where the log originates. Empty if the log has no source details
+		*/
+		std::string_view Source;
+		/**
+		 * @brief The line number where the log originates. 0 if the log has no source details
+		*/
+		int Line = 0;
+		/**
+		 * @brief The message of the log without the prefixes. It is the same text Receiver::onReceive() gets,
+			so in the TEXT line format it ends with the source details
+		*/
+		std::string_view Message;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,32 @@
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief Defines how many completed log files are kept in the log directory.
+		The oldest completed files are deleted when the Logger opens a log file, until every enabled limit is met.
+		The open log file is never deleted and not counted. A limit of 0 is disabled
+	*/
+	struct RetentionPolicy
+	{
+		/**
+		 * @brief Delete the old log files according to the limits
+		*/
+		bool IsEnabled = false;
+		/**
+		 * @brief The maximal total size of the completed log files in bytes. Compressed files count with their compressed size
+		*/
+		std::uintmax_t MaxTotalSize = 0;
+		/**
+		 * @brief The maximal age of the logs. A log file is deleted when the end of its date is older than this
+		*/
+		std::chrono::hours MaxAge = std::chrono::hours(0);
+		/**
+		 * @brief The maximal number of completed log files
+		*/
+		std::size_t MaxFileCount = 0;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,165 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief Bounded lock-free queue with a fixed number of preallocated slots.
+	 *
+	 * Any number of threads may push and pop concurrently (each slot carries a sequence number, see D. Vyukov's bounded queue).
+	 * The Logger uses it with many producers and a single writer thread; producers only pop to discard the oldest entry.
+	 * Values are written and read in place, so the storage of the slots (e.g. string capacity) is reused
+	*/
+	template<typename T>
+	class RingBuffer
+	{
+	private:
+		/**
+		 * @brief Size of a cache line. The positions are padded to avoid false sharing between producers and the consumer
+		*/
+		static constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+		/**
+		 * @brief A single element of the queue with its sequence number
+		*/
+		struct Slot
+		{
+			std::atomic<std::size_t> Sequence;
+			T Value;
+		};
+
+		std::unique_ptr<Slot[]> m_slots;
+		const std::size_t m_mask;
+
+		alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> m_enqueuePosition{ 0 };
+		alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> m_dequeuePosition{ 0 };
+
+		/**
+		 * @brief Rounds the requested capacity up to the next power of two (minimum 2)
+		*/
+		static std::size_t roundCapacity(std::size_t capacity)
+		{
+			std::size_t rounded = 2;
+			while (rounded < capacity)
+			{
+				rounded <<= 1;
+			}
+
+			return rounded;
+		}
+
+	public:
+		/**
+		 * @brief Creates the queue and preallocates every slot
+		 *
+		 * @param capacity The requested number of slots. It is rounded up to the next power of two
+		*/
+		explicit RingBuffer(const std::size_t capacity) :
+			m_slots(std::make_unique<Slot[]>(roundCapacity(capacity))),
+			m_mask(roundCapacity(capacity) - 1)
+		{
+			for (std::size_t i = 0; i <= m_mask; ++i)
+			{
+				m_slots[i].Sequence.store(i, std::memory_order_relaxed);
+			}
+		}
+
+		RingBuffer(const RingBuffer&) = delete;
+		RingBuffer& operator=(const RingBuffer&) = delete;
+
+		/**
+		 * @brief Claims a free slot and fills it with the given writer
+		 *
+		 * @param writer Callable invoked with a reference to the claimed slot value
+		 *
+		 * @return True if a slot was claimed, false if the queue is full
+		*/
+		template<typename Writer>
+		bool tryPush(Writer&& writer)
+		{
+			std::size_t position = m_enqueuePosition.load(std::memory_order_relaxed);
+			while (true)
+			{
+				Slot& slot = m_slots[position & m_mask];
+				const std::size_t sequence = slot.Sequence.load(std::memory_order_acquire);
+				const auto difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+
+				if (difference == 0)
+				{
+					if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					{
+						writer(slot.Value);
+						slot.Sequence.store(position + 1, std::memory_order_release);
+						return true;
+					}
+				}
+				else if (difference < 0)
+				{
+					return false;
+				}
+				else
+				{
+					position = m_enqueuePosition.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		/**
+		 * @brief Takes the oldest published slot and hands it to the given reader
+		 *
+		 * @param reader Callable invoked with a reference to the slot value before the slot is released
+		 *
+		 * @return True if a value was read, false if the queue is empty
+		*/
+		template<typename Reader>
+		bool tryPop(Reader&& reader)
+		{
+			std::size_t position = m_dequeuePosition.load(std::memory_order_relaxed);
+			while (true)
+			{
+				Slot& slot = m_slots[position & m_mask];
+				const std::size_t sequence = slot.Sequence.load(std::memory_order_acquire);
+				const auto difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position + 1);
+
+				if (difference == 0)
+				{
+					if (m_dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					{
+						reader(slot.Value);
+						slot.Sequence.store(position + m_mask + 1, std::memory_order_release);
+						return true;
+					}
+				}
+				else if (difference < 0)
+				{
+					return false;
+				}
+				else
+				{
+					position = m_dequeuePosition.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		/**
+		 * @brief Checks whether there are claimed slots which are not yet consumed
+		 *
+		 * @return True if the queue is empty. The result is only a snapshot under concurrent use
+		*/
+		bool empty() const
+		{
+			return m_dequeuePosition.load(std::memory_order_seq_cst) >= m_enqueuePosition.load(std::memory_order_seq_cst);
+		}
+
+		/**
+		 * @brief The number of slots of the queue
+		*/
+		std::size_t capacity() const
+		{
+			return m_mask + 1;
+		}
+	};
+}
\ No newline at end of file
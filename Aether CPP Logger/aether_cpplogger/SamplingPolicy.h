@@ -0,0 +1,26 @@
+#pragma once
+#include <cstdint>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief Defines which part of the logs of a severity is kept, e.g. to leave TRACE logs enabled at 0.1% in production.
+		The logs of the AETHER_LOG_* macros are sampled before their arguments are evaluated. A log is kept if it passes both rules
+	*/
+	struct SamplingPolicy
+	{
+		/**
+		 * @brief Sample the logs of the severity
+		*/
+		bool IsEnabled = false;
+		/**
+		 * @brief The probability of a log to be kept, e.g. 0.001 keeps 0.1% of the logs. It is decided by a per-thread random number generator.
+			It is clamped to the range [0, 1], NaN keeps every log
+		*/
+		double Probability = 1.0;
+		/**
+		 * @brief Only every Interval-th log of each call site which passed the probability is kept, starting with the first one. 1 keeps every log
+		*/
+		std::uint32_t Interval = 1;
+	};
+}
\ No newline at end of file
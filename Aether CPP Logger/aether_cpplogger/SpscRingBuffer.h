@@ -0,0 +1,191 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief Bounded lock-free queue for a single producer thread and a single consumer thread.
+	 *
+	 * Each side owns one position and only reads the other side's position when its cached copy says the queue is full or empty,
+	 * so a push or a pop is a plain store with release order and no compare-and-swap.
+	 * The slots are constructed on the first lap of the producer, so a large queue only touches the memory it uses.
+	 * Values are written and read in place, so the storage of the slots (e.g. string capacity) is reused
+	*/
+	template<typename T>
+	class SpscRingBuffer
+	{
+	private:
+		/**
+		 * @brief Size of a cache line. The positions of the producer and the consumer are kept apart
+		*/
+		static constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+		/**
+		 * @brief Uninitialized storage of a slot
+		*/
+		struct SlotStorage
+		{
+			alignas(T) unsigned char Bytes[sizeof(T)];
+		};
+
+		std::unique_ptr<SlotStorage[]> m_slots;
+		const std::size_t m_mask;
+
+		/**
+		 * @brief The next position of the producer and its copy of the consumer's position
+		*/
+		alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> m_tail{ 0 };
+		std::size_t m_cachedHead = 0;
+		/**
+		 * @brief The position the consumer releases its slots up to, the next position it reads and its copy of the producer's position
+		*/
+		alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> m_head{ 0 };
+		std::size_t m_readPosition = 0;
+		std::size_t m_cachedTail = 0;
+
+		/**
+		 * @brief Rounds the requested capacity up to the next power of two (minimum 2)
+		*/
+		static std::size_t roundCapacity(std::size_t capacity)
+		{
+			std::size_t rounded = 2;
+			while (rounded < capacity)
+			{
+				rounded <<= 1;
+			}
+
+			return rounded;
+		}
+
+		T& slot(const std::size_t position)
+		{
+			return *std::launder(reinterpret_cast<T*>(m_slots[position & m_mask].Bytes));
+		}
+
+	public:
+		/**
+		 * @brief Creates the queue without constructing the slots
+		 *
+		 * @param capacity The requested number of slots. It is rounded up to the next power of two
+		*/
+		explicit SpscRingBuffer(const std::size_t capacity) :
+			m_slots(new SlotStorage[roundCapacity(capacity)]),
+			m_mask(roundCapacity(capacity) - 1)
+		{
+		}
+
+		~SpscRingBuffer()
+		{
+			const std::size_t constructedSlots = std::min(m_tail.load(std::memory_order_acquire), m_mask + 1);
+			for (std::size_t i = 0; i < constructedSlots; ++i)
+			{
+				slot(i).~T();
+			}
+		}
+
+		SpscRingBuffer(const SpscRingBuffer&) = delete;
+		SpscRingBuffer& operator=(const SpscRingBuffer&) = delete;
+
+		/**
+		 * @brief Fills the next free slot with the given writer. Only the producer thread may call it
+		 *
+		 * @param writer Callable invoked with a reference to the slot value
+		 *
+		 * @return True if the value was queued, false if the queue is full
+		*/
+		template<typename Writer>
+		bool tryPush(Writer&& writer)
+		{
+			const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+			if (tail - m_cachedHead > m_mask)
+			{
+				m_cachedHead = m_head.load(std::memory_order_acquire);
+				if (tail - m_cachedHead > m_mask)
+				{
+					return false;
+				}
+			}
+
+			T& value = tail <= m_mask ? *new (m_slots[tail].Bytes) T() : slot(tail);
+			writer(value);
+			m_tail.store(tail + 1, std::memory_order_release);
+			return true;
+		}
+
+		/**
+		 * @brief Hands the oldest value to the given reader and releases its slot afterwards. Only the consumer thread may call it
+		 *
+		 * @param reader Callable invoked with a reference to the slot value before the slot is released
+		 *
+		 * @return True if a value was read, false if the queue is empty
+		*/
+		template<typename Reader>
+		bool tryPop(Reader&& reader)
+		{
+			const std::size_t head = m_readPosition;
+			if (head == m_cachedTail)
+			{
+				m_cachedTail = m_tail.load(std::memory_order_acquire);
+				if (head == m_cachedTail)
+				{
+					return false;
+				}
+			}
+
+			//The reader sees the value as taken (see empty()), the producer only reuses the slot after the reader returned
+			m_readPosition = head + 1;
+			reader(slot(head));
+			m_head.store(head + 1, std::memory_order_release);
+			return true;
+		}
+
+		/**
+		 * @brief Returns the oldest value without releasing its slot, so it can be read in place. Only the consumer thread may call it
+		 *
+		 * @return The oldest value, or nullptr if the queue is empty. It stays valid until pop() is called
+		*/
+		T* front()
+		{
+			if (m_readPosition == m_cachedTail)
+			{
+				m_cachedTail = m_tail.load(std::memory_order_acquire);
+				if (m_readPosition == m_cachedTail)
+				{
+					return nullptr;
+				}
+			}
+
+			return &slot(m_readPosition);
+		}
+
+		/**
+		 * @brief Releases the slot of the value returned by front(). Only the consumer thread may call it
+		*/
+		void pop()
+		{
+			m_head.store(++m_readPosition, std::memory_order_release);
+		}
+
+		/**
+		 * @brief Checks whether every queued value is taken by the consumer. Only the consumer thread may call it
+		 *
+		 * @return True if the queue is empty. The producer may push right after the check
+		*/
+		bool empty() const
+		{
+			return m_readPosition == m_tail.load(std::memory_order_acquire);
+		}
+
+		/**
+		 * @brief The number of slots of the queue
+		*/
+		std::size_t capacity() const
+		{
+			return m_mask + 1;
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,205 @@
+#include "StatsCollector.h"
+#include "ThreadSlots.h"
+
+#include <algorithm>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief The buckets and totals of a latency histogram in a shard
+	*/
+	struct ShardHistogram
+	{
+		std::atomic<std::uint64_t> Buckets[LatencyHistogram::BUCKET_COUNT] = {};
+		std::atomic<std::uint64_t> Sum{ 0 };
+		std::atomic<std::uint64_t> Max{ 0 };
+	};
+
+	/**
+	 * @brief Aligned to the cache line, so the counters of two threads never share one
+	*/
+	struct alignas(64) StatsShard : ThreadSlot
+	{
+		std::atomic<std::uint64_t> Records[5] = {};
+		std::atomic<std::uint64_t> BytesWritten{ 0 };
+		std::atomic<std::uint64_t> Rotations{ 0 };
+		std::atomic<std::uint64_t> Exceptions{ 0 };
+		std::atomic<std::uint64_t> DroppedRecords{ 0 };
+		std::atomic<std::uint64_t> RateLimitedRecords{ 0 };
+		std::atomic<std::uint64_t> SampledOutRecords{ 0 };
+		ShardHistogram Latencies[3];
+	};
+}
+
+namespace
+{
+	std::uint64_t nextCollectorId()
+	{
+		static std::atomic<std::uint64_t> s_nextCollectorId{ 1 };
+		return s_nextCollectorId.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief The shards the calling thread counts into, one entry for each collector it counted with.
+		The shard of an exited thread is kept by its collector and is reused by the next new thread
+	*/
+	thread_local aether_cpplogger::ThreadSlots<aether_cpplogger::StatsShard> t_threadShards;
+
+	/**
+	 * @brief Adds to a counter of the calling thread's shard. A plain load and store is enough, no other thread writes the shard
+	*/
+	void increment(std::atomic<std::uint64_t>& counter, const std::uint64_t value = 1)
+	{
+		counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+	}
+}
+
+namespace aether_cpplogger
+{
+	StatsCollector::StatsCollector() :
+		m_id(nextCollectorId())
+	{
+	}
+
+	StatsCollector::~StatsCollector()
+	{
+		std::lock_guard<std::mutex> lock(m_shardsMutex);
+		for (const auto& shard : m_shards)
+		{
+			shard->IsOwnerStopped.store(true, std::memory_order_release);
+		}
+	}
+
+	StatsShard& StatsCollector::threadShard()
+	{
+		if (auto* shard = t_threadShards.find(m_id))
+		{
+			return *shard;
+		}
+
+		std::shared_ptr<StatsShard> shard;
+		{
+			std::lock_guard<std::mutex> lock(m_shardsMutex);
+			for (const auto& candidate : m_shards)
+			{
+				if (candidate->claim())
+				{
+					shard = candidate;
+					break;
+				}
+			}
+
+			if (!shard)
+			{
+				shard = std::make_shared<StatsShard>();
+				m_shards.push_back(shard);
+			}
+		}
+
+		t_threadShards.add(m_id, shard);
+		return *shard;
+	}
+
+	void StatsCollector::setLatencyTracked(const bool isLatencyTracked)
+	{
+		m_isLatencyTracked.store(isLatencyTracked, std::memory_order_relaxed);
+	}
+
+	void StatsCollector::countRecord(const LogSeverity severity)
+	{
+		increment(threadShard().Records[static_cast<std::size_t>(severity)]);
+	}
+
+	void StatsCollector::countBytes(const std::uint64_t bytes)
+	{
+		increment(threadShard().BytesWritten, bytes);
+	}
+
+	void StatsCollector::countRotation()
+	{
+		increment(threadShard().Rotations);
+	}
+
+	void StatsCollector::countException()
+	{
+		increment(threadShard().Exceptions);
+	}
+
+	void StatsCollector::countDroppedRecords(const std::uint64_t droppedRecords)
+	{
+		increment(threadShard().DroppedRecords, droppedRecords);
+	}
+
+	void StatsCollector::countRateLimitedRecord()
+	{
+		increment(threadShard().RateLimitedRecords);
+	}
+
+	void StatsCollector::countSampledOutRecord()
+	{
+		increment(threadShard().SampledOutRecords);
+	}
+
+	std::atomic<std::uint64_t>& StatsCollector::sampledOutCounter()
+	{
+		return threadShard().SampledOutRecords;
+	}
+
+	void StatsCollector::recordLatency(const LatencyKind kind, const std::uint64_t nanoseconds)
+	{
+		auto& histogram = threadShard().Latencies[static_cast<std::size_t>(kind)];
+		increment(histogram.Buckets[LatencyHistogram::bucketIndex(nanoseconds)]);
+		increment(histogram.Sum, nanoseconds);
+		if (nanoseconds > histogram.Max.load(std::memory_order_relaxed))
+		{
+			histogram.Max.store(nanoseconds, std::memory_order_relaxed);
+		}
+	}
+
+	void StatsCollector::collect(LoggerStats& stats) const
+	{
+		const auto& collectHistogram = [](LatencyHistogram& histogram, const ShardHistogram& shardHistogram)
+		{
+			for (std::size_t i = 0; i < LatencyHistogram::BUCKET_COUNT; ++i)
+			{
+				const auto count = shardHistogram.Buckets[i].load(std::memory_order_relaxed);
+				if (count > 0)
+				{
+					histogram.addBucket(i, count);
+				}
+			}
+			histogram.addTotals(shardHistogram.Sum.load(std::memory_order_relaxed), shardHistogram.Max.load(std::memory_order_relaxed));
+		};
+
+		std::lock_guard<std::mutex> lock(m_shardsMutex);
+		for (const auto& shard : m_shards)
+		{
+			for (std::size_t i = 0; i < stats.Records.size(); ++i)
+			{
+				stats.Records[i] += shard->Records[i].load(std::memory_order_relaxed);
+			}
+			stats.BytesWritten += shard->BytesWritten.load(std::memory_order_relaxed);
+			stats.Rotations += shard->Rotations.load(std::memory_order_relaxed);
+			stats.Exceptions += shard->Exceptions.load(std::memory_order_relaxed);
+			stats.DroppedRecords += shard->DroppedRecords.load(std::memory_order_relaxed);
+			stats.RateLimitedRecords += shard->RateLimitedRecords.load(std::memory_order_relaxed);
+			stats.SampledOutRecords += shard->SampledOutRecords.load(std::memory_order_relaxed);
+
+			collectHistogram(stats.EnqueueLatency, shard->Latencies[static_cast<std::size_t>(LatencyKind::ENQUEUE)]);
+			collectHistogram(stats.WriteLatency, shard->Latencies[static_cast<std::size_t>(LatencyKind::WRITE)]);
+			collectHistogram(stats.FlushLatency, shard->Latencies[static_cast<std::size_t>(LatencyKind::FLUSH)]);
+		}
+	}
+
+	std::uint64_t StatsCollector::rateLimitedRecords() const
+	{
+		std::uint64_t rateLimitedRecords = 0;
+
+		std::lock_guard<std::mutex> lock(m_shardsMutex);
+		for (const auto& shard : m_shards)
+		{
+			rateLimitedRecords += shard->RateLimitedRecords.load(std::memory_order_relaxed);
+		}
+		return rateLimitedRecords;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,178 @@
+#pragma once
+#include "LoggerStats.h"
+#include "LogSeverity.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief The counters of a thread in a StatsCollector. Only its owner thread writes it
+	*/
+	struct StatsShard;
+
+	/**
+	 * @brief A counter of the calling thread's shard which is cached outside of the collector, see sampledOutCounterCache()
+	*/
+	struct ThreadCounterCache
+	{
+		/**
+		 * @brief The collector of the counter, 0 if nothing is cached. The IDs are never reused, so a destroyed collector never matches
+		*/
+		std::uint64_t CollectorId = 0;
+		std::atomic<std::uint64_t>* Counter = nullptr;
+	};
+
+	/**
+	 * @brief Returns the sampled-out counter of the collector the calling thread counted into last through the inline sampling checks.
+		Each module has its own cache
+	*/
+	inline ThreadCounterCache& sampledOutCounterCache()
+	{
+		thread_local ThreadCounterCache cache;
+		return cache;
+	}
+
+	/**
+	 * @brief The measured latencies of a StatsCollector
+	*/
+	enum class LatencyKind
+	{
+		ENQUEUE,
+		WRITE,
+		FLUSH
+	};
+
+	/**
+	 * @brief The counters a logger keeps about itself, sharded by thread.
+	 *
+	 * Every thread gets a shard of its own on its first count, so counting is a relaxed load and store in memory no other thread writes.
+	 * The shard of an exited thread is reused by the next new thread, so its counts are kept.
+	 * The snapshot sums the shards under a mutex which the counting threads only take to get their shard
+	*/
+	class StatsCollector
+	{
+	private:
+		/**
+		 * @brief Identifies the collector in the thread local shard lists, it is never reused unlike the address
+		*/
+		const std::uint64_t m_id;
+		std::atomic<bool> m_isLatencyTracked{ false };
+
+		/**
+		 * @brief The owners of the shards, guarded by m_shardsMutex
+		*/
+		std::vector<std::shared_ptr<StatsShard>> m_shards;
+		mutable std::mutex m_shardsMutex;
+
+		/**
+		 * @brief Returns the shard of the calling thread and creates or reuses one on the first call
+		*/
+		StatsShard& threadShard();
+
+	public:
+		StatsCollector();
+		~StatsCollector();
+
+		StatsCollector(const StatsCollector&) = delete;
+		StatsCollector& operator=(const StatsCollector&) = delete;
+
+		/**
+		 * @brief Identifies the collector, it is never reused unlike the address
+		*/
+		std::uint64_t id() const
+		{
+			return m_id;
+		}
+
+		/**
+		 * @brief Sets whether the latencies are measured
+		*/
+		void setLatencyTracked(const bool isLatencyTracked);
+		/**
+		 * @brief Whether the latencies are measured
+		*/
+		bool isLatencyTracked() const
+		{
+			return m_isLatencyTracked.load(std::memory_order_relaxed);
+		}
+
+		/**
+		 * @brief Counts a log passed to the outputs
+		*/
+		void countRecord(const LogSeverity severity);
+		/**
+		 * @brief Counts the bytes handed to a log file
+		*/
+		void countBytes(const std::uint64_t bytes);
+		void countRotation();
+		void countException();
+		void countDroppedRecords(const std::uint64_t droppedRecords);
+		void countRateLimitedRecord();
+		void countSampledOutRecord();
+		/**
+		 * @brief Returns the counter of the logs skipped by the sampling in the calling thread's shard. Only the calling thread may
+			write it (a relaxed load and store), it stays valid while the collector exists
+		*/
+		std::atomic<std::uint64_t>& sampledOutCounter();
+		/**
+		 * @brief Adds a measured latency to the histogram of its kind
+		 *
+		 * @param kind The measured operation
+		 * @param nanoseconds The duration of the operation
+		*/
+		void recordLatency(const LatencyKind kind, const std::uint64_t nanoseconds);
+
+		/**
+		 * @brief Adds the sum of the shards to the counters and histograms of the given snapshot
+		*/
+		void collect(LoggerStats& stats) const;
+		/**
+		 * @brief Returns the number of logs skipped by the rate limit
+		*/
+		std::uint64_t rateLimitedRecords() const;
+	};
+
+	/**
+	 * @brief Measures the lifetime of the object and records it in the collector if the latencies are tracked
+	*/
+	class LatencyTimer
+	{
+	private:
+		/**
+		 * @brief Nullptr if nothing is measured
+		*/
+		StatsCollector* const m_collector;
+		const LatencyKind m_kind;
+		const std::chrono::steady_clock::time_point m_start;
+
+	public:
+		/**
+		 * @param collector The collector of the latency, nullptr measures nothing
+		 * @param kind The measured operation
+		*/
+		LatencyTimer(StatsCollector* collector, const LatencyKind kind) :
+			m_collector(collector && collector->isLatencyTracked() ? collector : nullptr),
+			m_kind(kind),
+			m_start(m_collector ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point())
+		{
+		}
+
+		~LatencyTimer()
+		{
+			if (m_collector)
+			{
+				const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start).count();
+				m_collector->recordLatency(m_kind, static_cast<std::uint64_t>(duration));
+			}
+		}
+
+		LatencyTimer(const LatencyTimer&) = delete;
+		LatencyTimer& operator=(const LatencyTimer&) = delete;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,21 @@
+#pragma once
+#include <chrono>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief Defines which of the logger's own counters are measured and how often they are reported to the receivers.
+		The counters of the logs, bytes, rotations and errors are always kept, see LoggerStats
+	*/
+	struct StatsPolicy
+	{
+		/**
+		 * @brief Measure the latencies of the enqueue, the log file writes and the flushes. It reads the clock twice for every measurement
+		*/
+		bool IsLatencyTracked = false;
+		/**
+		 * @brief The receivers get a snapshot of the counters this often through Receiver::onReceiveStats(). Zero disables the reports
+		*/
+		std::chrono::milliseconds ReportInterval = std::chrono::milliseconds(0);
+	};
+}
\ No newline at end of file
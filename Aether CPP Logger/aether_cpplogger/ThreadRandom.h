@@ -0,0 +1,32 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <thread>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief Returns the next number of the calling thread's xorshift64* generator. It is seeded from the thread ID and the clock.
+		It is inline, so the sampling of the AETHER_LOG_* macros draws it without calling into the library; each module has its own generators
+	*/
+	inline std::uint64_t threadRandomNumber()
+	{
+		thread_local std::uint64_t state = []()
+		{
+			//splitmix64 spreads the seed over every bit, the state must not be 0
+			std::uint64_t seed = std::hash<std::thread::id>()(std::this_thread::get_id()) ^
+				static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+			seed += 0x9E3779B97F4A7C15ull;
+			seed = (seed ^ (seed >> 30)) * 0xBF58476D1CE4E5B9ull;
+			seed = (seed ^ (seed >> 27)) * 0x94D049BB133111EBull;
+			seed ^= seed >> 31;
+			return seed != 0 ? seed : 1;
+		}();
+
+		state ^= state >> 12;
+		state ^= state << 25;
+		state ^= state >> 27;
+		return state * 0x2545F4914F6CDD1Dull;
+	}
+}
\ No newline at end of file
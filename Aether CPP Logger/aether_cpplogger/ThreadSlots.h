@@ -0,0 +1,101 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief The state shared by an object which a thread uses on behalf of an owner (e.g. the stats shard of a collector)
+		and the owner, which keeps the object after the thread exits
+	*/
+	struct ThreadSlot
+	{
+		/**
+		 * @brief Set while a thread uses the object. The thread clears it with release order when it exits,
+			so the owner sees every write of the thread once it reads the flag cleared with acquire order
+		*/
+		std::atomic<bool> IsOwned{ true };
+		/**
+		 * @brief Set with release order by the owner's destructor, so the threads drop their entry of the object
+		*/
+		std::atomic<bool> IsOwnerStopped{ false };
+
+		/**
+		 * @brief Takes over the object of an exited thread
+		 *
+		 * @return True if the object was not used by any thread and now belongs to the calling thread
+		*/
+		bool claim()
+		{
+			bool isOwned = false;
+			return IsOwned.compare_exchange_strong(isOwned, true, std::memory_order_acquire);
+		}
+	};
+
+	/**
+	 * @brief The objects the calling thread uses on behalf of its owners, one entry for every owner it met. Meant to be thread local.
+	 *
+	 * An owner is identified by an ID which is never reused, unlike its address. The lookup is a scan of the few entries of the thread.
+	 * The entries of stopped owners are dropped when the thread registers with a new owner.
+	 * When the thread exits, it releases every object it still holds
+	*/
+	template<typename T>
+	class ThreadSlots
+	{
+	private:
+		std::vector<std::pair<std::uint64_t, std::shared_ptr<T>>> m_entries;
+
+	public:
+		ThreadSlots() = default;
+
+		~ThreadSlots()
+		{
+			for (const auto& entry : m_entries)
+			{
+				entry.second->IsOwned.store(false, std::memory_order_release);
+			}
+		}
+
+		ThreadSlots(const ThreadSlots&) = delete;
+		ThreadSlots& operator=(const ThreadSlots&) = delete;
+
+		/**
+		 * @brief Returns the object of the given owner
+		 *
+		 * @param ownerId The ID of the owner
+		 *
+		 * @return The object, or nullptr if the thread has not registered with the owner yet
+		*/
+		T* find(const std::uint64_t ownerId) const
+		{
+			for (const auto& entry : m_entries)
+			{
+				if (entry.first == ownerId)
+				{
+					return entry.second.get();
+				}
+			}
+
+			return nullptr;
+		}
+
+		/**
+		 * @brief Registers the object of a new owner and forgets the objects of the stopped owners
+		 *
+		 * @param ownerId The ID of the owner
+		 * @param slot The object, which is also kept by the owner
+		*/
+		void add(const std::uint64_t ownerId, std::shared_ptr<T> slot)
+		{
+			m_entries.erase(std::remove_if(m_entries.begin(), m_entries.end(), [](const auto& entry)
+				{
+					return entry.second->IsOwnerStopped.load(std::memory_order_acquire);
+				}), m_entries.end());
+			m_entries.emplace_back(ownerId, std::move(slot));
+		}
+	};
+}
\ No newline at end of file
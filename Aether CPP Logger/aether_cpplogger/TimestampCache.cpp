@@ -0,0 +1,202 @@
+#include "TimestampCache.h"
+#include "Platform.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <limits>
+
+constexpr std::int64_t MICROSECONDS_PER_SECOND = 1000000;
+/**
+ * @brief The difference between the wall clock and its extrapolation that moves the anchor. Smaller ones come from reading the two clocks apart
+*/
+constexpr std::int64_t RESYNC_TOLERANCE_MICROSECONDS = 1000;
+
+namespace
+{
+	std::int64_t systemClockMicroseconds()
+	{
+		return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+	}
+
+	std::int64_t steadyClockMicroseconds()
+	{
+		return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	/**
+	 * @brief The clocks read by Clock::now() and the anchor between them
+	*/
+	struct ClockState
+	{
+		std::atomic<aether_cpplogger::Clock::TimeSource> WallClock{ &systemClockMicroseconds };
+		std::atomic<aether_cpplogger::Clock::TimeSource> MonotonicClock{ &steadyClockMicroseconds };
+		/**
+		 * @brief The wall clock minus the monotonic clock at the last anchoring
+		*/
+		std::atomic<std::int64_t> Offset{ 0 };
+		/**
+		 * @brief The second in which the wall clock was read last
+		*/
+		std::atomic<std::int64_t> SyncedSecond{ 0 };
+		/**
+		 * @brief Incremented whenever the clocks are replaced, so the threads forget their last timestamps
+		*/
+		std::atomic<std::uint32_t> Generation{ 0 };
+
+		ClockState()
+		{
+			anchor();
+		}
+
+		void anchor()
+		{
+			const auto monotonic = MonotonicClock.load(std::memory_order_relaxed)();
+			const auto wallClock = WallClock.load(std::memory_order_relaxed)();
+			Offset.store(wallClock - monotonic, std::memory_order_relaxed);
+			SyncedSecond.store(wallClock / MICROSECONDS_PER_SECOND, std::memory_order_relaxed);
+		}
+	};
+
+	ClockState& clockState()
+	{
+		static ClockState state;
+		return state;
+	}
+
+	/**
+	 * @brief The last timestamp returned to the thread
+	*/
+	struct LastTimestamp
+	{
+		std::uint32_t Generation = 0;
+		std::int64_t Value = std::numeric_limits<std::int64_t>::min();
+	};
+
+	thread_local LastTimestamp t_lastTimestamp;
+}
+
+namespace aether_cpplogger
+{
+	void Clock::setTimeSources(TimeSource wallClock, TimeSource monotonicClock)
+	{
+		auto& state = clockState();
+		state.WallClock.store(wallClock != nullptr ? wallClock : &systemClockMicroseconds, std::memory_order_relaxed);
+		state.MonotonicClock.store(monotonicClock != nullptr ? monotonicClock : &steadyClockMicroseconds, std::memory_order_relaxed);
+		state.anchor();
+		state.Generation.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	std::int64_t Clock::now()
+	{
+		auto& state = clockState();
+		const auto monotonic = state.MonotonicClock.load(std::memory_order_relaxed)();
+		std::int64_t timestamp = monotonic + state.Offset.load(std::memory_order_relaxed);
+
+		auto syncedSecond = state.SyncedSecond.load(std::memory_order_relaxed);
+		const auto second = timestamp / MICROSECONDS_PER_SECOND;
+		if (second != syncedSecond && state.SyncedSecond.compare_exchange_strong(syncedSecond, second, std::memory_order_relaxed))
+		{
+			//Only the thread which notices the new second reads the wall clock, the anchor is moved if the wall clock was adjusted
+			const auto wallClock = state.WallClock.load(std::memory_order_relaxed)();
+			if (std::abs(wallClock - timestamp) > RESYNC_TOLERANCE_MICROSECONDS)
+			{
+				state.Offset.store(wallClock - monotonic, std::memory_order_relaxed);
+				state.SyncedSecond.store(wallClock / MICROSECONDS_PER_SECOND, std::memory_order_relaxed);
+				timestamp = wallClock;
+			}
+		}
+
+		//A wall clock set back must not reorder the logs of the thread
+		auto& lastTimestamp = t_lastTimestamp;
+		const auto generation = state.Generation.load(std::memory_order_relaxed);
+		if (lastTimestamp.Generation == generation && timestamp < lastTimestamp.Value)
+		{
+			timestamp = lastTimestamp.Value;
+		}
+		lastTimestamp.Generation = generation;
+		lastTimestamp.Value = timestamp;
+
+		return timestamp;
+	}
+
+	DateTime Clock::toDateTime(const std::int64_t timestamp)
+	{
+		const std::time_t time = static_cast<std::time_t>(timestamp / MICROSECONDS_PER_SECOND);
+		const auto& ltm = toLocalTime(time);
+
+		DateTime dt;
+		dt.Year = 1900 + ltm.tm_year;
+		dt.Month = 1 + ltm.tm_mon;
+		dt.Day = ltm.tm_mday;
+		dt.Hours = ltm.tm_hour;
+		dt.Minutes = ltm.tm_min;
+		dt.Seconds = ltm.tm_sec;
+		dt.Microseconds = static_cast<int>(timestamp % MICROSECONDS_PER_SECOND);
+
+		return dt;
+	}
+
+	void TimestampCache::update(const std::int64_t timestamp)
+	{
+		const std::int64_t second = timestamp / MICROSECONDS_PER_SECOND;
+		if (second != m_second)
+		{
+			//Break down the local time only when the second rolls over
+			const auto& dateTime = Clock::toDateTime(timestamp);
+
+			writePaddedDigits(&m_timeBuffer[0], dateTime.Hours, 2);
+			m_timeBuffer[2] = ':';
+			writePaddedDigits(&m_timeBuffer[3], dateTime.Minutes, 2);
+			m_timeBuffer[5] = ':';
+			writePaddedDigits(&m_timeBuffer[6], dateTime.Seconds, 2);
+			m_timeBuffer[8] = '.';
+
+			//Format the date only when the day rolls over
+			if (m_second < 0 ||
+				dateTime.Day != m_dateTime.Day ||
+				dateTime.Month != m_dateTime.Month ||
+				dateTime.Year != m_dateTime.Year)
+			{
+				writePaddedDigits(&m_dateBuffer[0], dateTime.Year, 4);
+				m_dateBuffer[4] = '-';
+				writePaddedDigits(&m_dateBuffer[5], dateTime.Month, 2);
+				m_dateBuffer[7] = '-';
+				writePaddedDigits(&m_dateBuffer[8], dateTime.Day, 2);
+			}
+
+			m_dateTime = dateTime;
+			m_second = second;
+		}
+
+		m_dateTime.Microseconds = static_cast<int>(timestamp % MICROSECONDS_PER_SECOND);
+	}
+
+	const DateTime& TimestampCache::dateTime() const
+	{
+		return m_dateTime;
+	}
+
+	std::string_view TimestampCache::dateString() const
+	{
+		return std::string_view(m_dateBuffer, sizeof(m_dateBuffer));
+	}
+
+	std::string_view TimestampCache::timeString(const TimestampPrecision precision)
+	{
+		//Patch only the fractional digits which are part of the requested precision
+		if (precision == TimestampPrecision::MILLISECONDS)
+		{
+			writePaddedDigits(&m_timeBuffer[9], m_dateTime.Microseconds / 1000, 3);
+			return std::string_view(m_timeBuffer, 12);
+		}
+		else if (precision == TimestampPrecision::MICROSECONDS)
+		{
+			writePaddedDigits(&m_timeBuffer[9], m_dateTime.Microseconds, 6);
+			return std::string_view(m_timeBuffer, 15);
+		}
+
+		return std::string_view(m_timeBuffer, 8);
+	}
+}
\ No newline at end of file
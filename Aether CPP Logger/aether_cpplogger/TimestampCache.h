@@ -0,0 +1,101 @@
+#pragma once
+#include "DateTime.h"
+#include "Export.h"
+
+#include <cstdint>
+#include <string_view>
+
+namespace aether_cpplogger
+{
+	/**
+	 * @brief The time source of the Logger.
+	 *
+	 * The wall clock is anchored to the monotonic clock and only read again when the second rolls over,
+	 * the anchor is moved if the wall clock was adjusted meanwhile.
+	 * The timestamps of a thread never go backwards, they stand still until a wall clock set back catches up
+	*/
+	class AETHER_CPPLOGGER_API Clock
+	{
+	public:
+		/**
+		 * @brief A clock returning microseconds
+		*/
+		using TimeSource = std::int64_t(*)();
+
+	protected:
+		/**
+		 * @brief Replaces the clocks read by now() and anchors them again. This is used for testing purposes only
+		 *
+		 * @param wallClock Returns microseconds since the Unix epoch. The system clock is read if it is nullptr
+		 * @param monotonicClock Returns microseconds which never go backwards. The steady clock is read if it is nullptr
+		*/
+		static void setTimeSources(TimeSource wallClock, TimeSource monotonicClock);
+
+	public:
+		/**
+		 * @brief Returns the current time
+		 *
+		 * @return Microseconds since the Unix epoch
+		*/
+		static std::int64_t now();
+		/**
+		 * @brief Converts the given timestamp to local DateTime
+		 *
+		 * @param timestamp Microseconds since the Unix epoch
+		 *
+		 * @return The local DateTime of the timestamp
+		*/
+		static DateTime toDateTime(const std::int64_t timestamp);
+	};
+
+	/**
+	 * @brief Keeps the formatted date and time of the last timestamp.
+	 *
+	 * The local time is only broken down when the second changes and the date is only formatted when the day changes.
+	 * Within the same second only the fractional digits are patched into the preformatted buffer.
+	 * An instance must be used by a single thread
+	*/
+	class AETHER_CPPLOGGER_API TimestampCache
+	{
+	private:
+		/**
+		 * @brief The second (since the Unix epoch) the cached values belong to
+		*/
+		std::int64_t m_second = -1;
+		DateTime m_dateTime{};
+
+		/**
+		 * @brief Preformatted date e.g.: 1900-10-03
+		*/
+		char m_dateBuffer[10] = {};
+		/**
+		 * @brief Preformatted time with room for microseconds e.g.: 21:02:08.042000
+		*/
+		char m_timeBuffer[15] = {};
+
+	public:
+		/**
+		 * @brief Moves the cache to the given timestamp
+		 *
+		 * @param timestamp Microseconds since the Unix epoch
+		*/
+		void update(const std::int64_t timestamp);
+
+		/**
+		 * @brief Returns the DateTime of the last timestamp
+		*/
+		const DateTime& dateTime() const;
+		/**
+		 * @brief Returns the formatted date of the last timestamp e.g.: 1900-10-03
+		*/
+		std::string_view dateString() const;
+		/**
+		 * @brief Returns the formatted time of the last timestamp with the given fractional second digits
+		 *
+		 * @param precision The fractional second digits of the time
+		 *
+		 * @return The formatted time e.g.: 21:02:08.042 with millisecond precision
+		*/
+		std::string_view timeString(const TimestampPrecision precision);
+	};
+}
\ No newline at end of file
@@ -0,0 +1,72 @@
+#include "Benchmark.h"
+#include "Logger.h"
+
+#include <thread>
+#include <vector>
+
+namespace
+{
+	constexpr std::uint64_t LOG_COUNT_PER_THREAD = 50000;
+	//The largest per-thread queue. The shared queue gets the same number of slots for every thread,
+	//so the logging threads of both modes wait for the writer thread under the same conditions
+	constexpr std::size_t CAPACITY_PER_THREAD = aether_cpplogger::MAX_THREAD_QUEUE_CAPACITY;
+	constexpr int SIZE_LIMIT = 256 * 1048576;
+
+	const std::string BENCHMARK_MESSAGE = "Request handled successfully by the benchmark worker";
+
+	/**
+	 * @brief Logs from the given number of threads at the same time and prints the time per log of the logging threads.
+		The shared queue gets the capacity of every per-thread queue together. The final flush is not measured
+	*/
+	void runAsyncQueue(std::string_view name, const int threadCount, const aether_cpplogger::AsyncQueueMode queueMode)
+	{
+		const auto& directory = aether_cpplogger_bench::createBenchmarkDirectory(name);
+		aether_cpplogger::Logger::init(directory.string(), false, aether_cpplogger::LogSeverity::INFO, SIZE_LIMIT);
+
+		aether_cpplogger::FlushPolicy flushPolicy;
+		flushPolicy.BufferSize = 64 * 1024;
+		aether_cpplogger::Logger::setFlushPolicy(flushPolicy);
+
+		const auto capacity = queueMode == aether_cpplogger::AsyncQueueMode::SHARED ? CAPACITY_PER_THREAD * threadCount : CAPACITY_PER_THREAD;
+		aether_cpplogger::Logger::enableAsync(capacity, aether_cpplogger::OverflowPolicy::BLOCK, queueMode);
+
+		auto result = aether_cpplogger_bench::measure("async_queue/" + std::string(name), 1, [threadCount](std::uint64_t)
+			{
+				std::vector<std::thread> threads;
+				for (int i = 0; i < threadCount; ++i)
+				{
+					threads.emplace_back([]()
+						{
+							for (std::uint64_t j = 0; j < LOG_COUNT_PER_THREAD; ++j)
+							{
+								aether_cpplogger::Logger::logInfo(BENCHMARK_MESSAGE);
+							}
+						});
+				}
+				for (auto& thread : threads)
+				{
+					thread.join();
+				}
+			});
+		result.Operations = LOG_COUNT_PER_THREAD * threadCount;
+		aether_cpplogger_bench::printResult(result);
+
+		aether_cpplogger::Logger::flush();
+		aether_cpplogger::Logger::setFlushPolicy(aether_cpplogger::FlushPolicy());
+		aether_cpplogger::Logger::shutdown();
+		std::filesystem::remove_all(directory);
+	}
+}
+
+namespace aether_cpplogger_bench
+{
+	void runAsyncQueueBenchmarks()
+	{
+		for (const int threadCount : { 1, 2, 4, 8 })
+		{
+			const auto& threads = std::to_string(threadCount) + "_threads";
+			runAsyncQueue("shared_" + threads, threadCount, aether_cpplogger::AsyncQueueMode::SHARED);
+			runAsyncQueue("per_thread_" + threads, threadCount, aether_cpplogger::AsyncQueueMode::PER_THREAD);
+		}
+	}
+}
\ No newline at end of file
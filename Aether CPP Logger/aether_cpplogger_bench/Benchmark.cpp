@@ -0,0 +1,126 @@
+#include "Benchmark.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+namespace
+{
+	std::atomic<std::uint64_t> s_allocationCount{ 0 };
+}
+
+//Counting replacement of the global allocation functions. The array and nothrow forms forward to these
+void* operator new(std::size_t size)
+{
+	s_allocationCount.fetch_add(1, std::memory_order_relaxed);
+	if (void* memory = std::malloc(size > 0 ? size : 1))
+	{
+		return memory;
+	}
+
+	throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+	std::free(memory);
+}
+
+//Over-aligned types (e.g. the cache line aligned counters) are allocated through the aligned forms
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+	s_allocationCount.fetch_add(1, std::memory_order_relaxed);
+	const auto alignmentSize = static_cast<std::size_t>(alignment);
+#ifdef _WIN32
+	void* memory = _aligned_malloc(size > 0 ? size : 1, alignmentSize);
+#else
+	//The size passed to aligned_alloc must be a non-zero multiple of the alignment
+	const std::size_t alignedSize = size > 0 ? (size + alignmentSize - 1) / alignmentSize * alignmentSize : alignmentSize;
+	void* memory = std::aligned_alloc(alignmentSize, alignedSize);
+#endif
+	if (memory)
+	{
+		return memory;
+	}
+
+	throw std::bad_alloc();
+}
+
+void operator delete(void* memory, std::align_val_t) noexcept
+{
+#ifdef _WIN32
+	_aligned_free(memory);
+#else
+	std::free(memory);
+#endif
+}
+
+void operator delete(void* memory, std::size_t, std::align_val_t alignment) noexcept
+{
+	operator delete(memory, alignment);
+}
+
+namespace aether_cpplogger_bench
+{
+	std::uint64_t allocationCount()
+	{
+		return s_allocationCount.load(std::memory_order_relaxed);
+	}
+
+	void printResult(const BenchmarkResult& result)
+	{
+		const double nanoseconds = static_cast<double>(result.Duration.count());
+		const double operations = static_cast<double>(result.Operations);
+
+		const double nanosecondsPerOperation = operations > 0 ? nanoseconds / operations : 0.0;
+		const double operationsPerSecond = nanoseconds > 0 ? operations * 1e9 / nanoseconds : 0.0;
+
+		const double allocationsPerOperation = operations > 0 ? static_cast<double>(result.Allocations) / operations : 0.0;
+		const double megabytesPerSecond = nanoseconds > 0 ? static_cast<double>(result.Bytes) * 1e9 / nanoseconds / 1048576.0 : 0.0;
+
+		std::printf("%-48s %12llu ops %12.1f ns/op %14.0f ops/s %10.2f allocs/op",
+			result.Name.c_str(),
+			static_cast<unsigned long long>(result.Operations),
+			nanosecondsPerOperation,
+			operationsPerSecond,
+			allocationsPerOperation);
+		if (result.Bytes > 0)
+		{
+			std::printf(" %10.1f MB/s", megabytesPerSecond);
+		}
+		std::printf("\n");
+	}
+
+	std::uint64_t directorySize(const std::filesystem::path& directory)
+	{
+		std::uint64_t size = 0;
+		for (const auto& entry : std::filesystem::recursive_directory_iterator(directory))
+		{
+			if (entry.is_regular_file())
+			{
+				size += entry.file_size();
+			}
+		}
+
+		return size;
+	}
+
+	std::filesystem::path createBenchmarkDirectory(std::string_view name)
+	{
+		const auto& directory = std::filesystem::temp_directory_path() / "aether_cpplogger_bench" / name;
+		std::filesystem::remove_all(directory);
+		std::filesystem::create_directories(directory);
+
+		return directory;
+	}
+}
@@ -0,0 +1,130 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+namespace aether_cpplogger_bench
+{
+	/**
+	 * @brief The measured result of a single benchmark
+	*/
+	struct BenchmarkResult
+	{
+		/**
+		 * @brief The name of the benchmark in suite/case form
+		*/
+		std::string Name;
+		/**
+		 * @brief The number of measured operations
+		*/
+		std::uint64_t Operations = 0;
+		/**
+		 * @brief The wall clock time of all operations
+		*/
+		std::chrono::nanoseconds Duration = std::chrono::nanoseconds(0);
+		/**
+		 * @brief The number of heap allocations made during all operations
+		*/
+		std::uint64_t Allocations = 0;
+		/**
+		 * @brief The number of bytes produced by all operations (e.g. written to the log file). 0 if it does not apply
+		*/
+		std::uint64_t Bytes = 0;
+	};
+
+	/**
+	 * @brief Returns the number of heap allocations made through the global operator new since the start of the program.
+		The benchmark replaces operator new to count them. With a dynamically linked C++ runtime on Windows the allocations
+		made inside the Logger DLL are not counted
+	*/
+	std::uint64_t allocationCount();
+
+	/**
+	 * @brief Runs the given operation the given number of times and measures the elapsed time
+	 *
+	 * @param name The name of the benchmark
+	 * @param operations The number of times the operation is run
+	 * @param operation Callable which is invoked with the index of the operation
+	 * @param finish Callable which is invoked once after the operations and is part of the measurement (e.g. flushing)
+	 *
+	 * @return The measured result
+	*/
+	template<typename Operation, typename Finish>
+	BenchmarkResult measure(std::string_view name, const std::uint64_t operations, Operation&& operation, Finish&& finish)
+	{
+		const auto startAllocations = allocationCount();
+		const auto start = std::chrono::steady_clock::now();
+		for (std::uint64_t i = 0; i < operations; ++i)
+		{
+			operation(i);
+		}
+		finish();
+		const auto end = std::chrono::steady_clock::now();
+		const auto endAllocations = allocationCount();
+
+		return BenchmarkResult{ std::string(name), operations, std::chrono::duration_cast<std::chrono::nanoseconds>(end - start), endAllocations - startAllocations };
+	}
+
+	/**
+	 * @brief Runs the given operation the given number of times and measures the elapsed time
+	 *
+	 * @param name The name of the benchmark
+	 * @param operations The number of times the operation is run
+	 * @param operation Callable which is invoked with the index of the operation
+	 *
+	 * @return The measured result
+	*/
+	template<typename Operation>
+	BenchmarkResult measure(std::string_view name, const std::uint64_t operations, Operation&& operation)
+	{
+		return measure(name, operations, std::forward<Operation>(operation), []() {});
+	}
+
+	/**
+	 * @brief Prints the result as a single line with the time per operation, the operations per second, the allocations per operation
+		and the throughput in bytes per second if the result has bytes
+	 *
+	 * @param result The result to be printed
+	*/
+	void printResult(const BenchmarkResult& result);
+
+	/**
+	 * @brief Returns the total size of the files in the given directory and its subdirectories
+	*/
+	std::uint64_t directorySize(const std::filesystem::path& directory);
+	/**
+	 * @brief Creates an empty directory in the temporary folder for the log files of a benchmark
+	 *
+	 * @param name The name of the directory
+	 *
+	 * @return The path of the created directory
+	*/
+	std::filesystem::path createBenchmarkDirectory(std::string_view name);
+
+	/**
+	 * @brief Measures the lines per second of the file sink with each flush policy against the original open-write-close behaviour
+	*/
+	void runFlushPolicyBenchmarks();
+	/**
+	 * @brief Measures the time and the allocations per log of the placeholder formatting against string concatenation
+	*/
+	void runFormatBenchmarks();
+	/**
+	 * @brief Measures the cost of logs which are compiled out or disabled by the severity limit
+	*/
+	void runFilterBenchmarks();
+	/**
+	 * @brief Measures the log file lookup at startup with 10k existing log files against the original probing of every index
+	*/
+	void runIndexDiscoveryBenchmarks();
+	/**
+	 * @brief Measures the logging threads of the async mode with a shared queue against a queue per thread
+	*/
+	void runAsyncQueueBenchmarks();
+	/**
+	 * @brief Measures each stage of a log in isolation (severity filter, prefixes, source details, file write and receivers) and the whole logInfo() call
+	*/
+	void runPipelineBenchmarks();
+}
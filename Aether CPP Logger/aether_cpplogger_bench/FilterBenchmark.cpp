@@ -0,0 +1,83 @@
+//TRACE logs are compiled out of this file, DEBUG logs are compiled in but disabled at runtime
+#define AETHER_LOG_ACTIVE_LEVEL AETHER_LOG_LEVEL_DEBUG
+
+#include "Benchmark.h"
+#include "Logger.h"
+
+namespace
+{
+	constexpr std::uint64_t CALL_COUNT = 100000000;
+	constexpr std::uint64_t LEGACY_CALL_COUNT = 1000000;
+
+	const std::string BENCHMARK_MESSAGE = "Filtered message of the benchmark worker";
+}
+
+namespace aether_cpplogger_bench
+{
+	void runFilterBenchmarks()
+	{
+		const auto& directory = createBenchmarkDirectory("filter");
+		aether_cpplogger::Logger::init(directory.string(), false, aether_cpplogger::LogSeverity::INFO, 1048576);
+
+		//The macro expands to nothing
+		printResult(measure("filter/compiled_out", CALL_COUNT,
+			[]([[maybe_unused]] std::uint64_t i) { AETHER_LOG_TRACE("value {}", i); }));
+
+		//Only the inline severity check runs, the arguments are not evaluated
+		printResult(measure("filter/runtime_disabled_format", CALL_COUNT,
+			[](std::uint64_t i) { AETHER_LOG_DEBUG("value {}", i); }));
+
+		printResult(measure("filter/runtime_disabled_message", CALL_COUNT,
+			[](std::uint64_t i) { AETHER_LOG_DEBUG(std::to_string(i)); }));
+
+		//Calling the Logger directly evaluates the message and crosses the library boundary before the check
+		printResult(measure("filter/direct_call", LEGACY_CALL_COUNT,
+			[](std::uint64_t i) { aether_cpplogger::Logger::logDebug(BENCHMARK_MESSAGE + std::to_string(i), __FILE__, __LINE__); }));
+
+		//A storm of an enabled call site: every log is formatted and written
+		aether_cpplogger::FlushPolicy flushPolicy;
+		flushPolicy.BufferSize = 64 * 1024;
+		aether_cpplogger::Logger::setFlushPolicy(flushPolicy);
+		printResult(measure("filter/storm_written", LEGACY_CALL_COUNT,
+			[](std::uint64_t i) { AETHER_LOG_INFO("value {}", i); }));
+
+		//The token bucket of the call site skips the logs over the burst before the arguments are evaluated
+		aether_cpplogger::RateLimitPolicy rateLimitPolicy;
+		rateLimitPolicy.IsEnabled = true;
+		aether_cpplogger::Logger::setRateLimitPolicy(rateLimitPolicy);
+		printResult(measure("filter/storm_rate_limited", CALL_COUNT,
+			[](std::uint64_t i) { AETHER_LOG_INFO("value {}", i); }));
+		aether_cpplogger::Logger::setRateLimitPolicy(aether_cpplogger::RateLimitPolicy());
+
+		//The repeats are hashed and counted instead of written
+		aether_cpplogger::Logger::setDuplicateSuppression(true);
+		printResult(measure("filter/storm_duplicates", LEGACY_CALL_COUNT,
+			[](std::uint64_t) { AETHER_LOG_INFO(BENCHMARK_MESSAGE); }));
+		aether_cpplogger::Logger::setDuplicateSuppression(false);
+
+		//DEBUG logs enabled at 0.1%: the logs which are not kept only draw a per-thread random number
+		aether_cpplogger::Logger::init(directory.string(), false, aether_cpplogger::LogSeverity::DEBUG, 256 * 1048576);
+		aether_cpplogger::SamplingPolicy samplingPolicy;
+		samplingPolicy.IsEnabled = true;
+		samplingPolicy.Probability = 0.001;
+		aether_cpplogger::Logger::setSamplingPolicy(aether_cpplogger::LogSeverity::DEBUG, samplingPolicy);
+		printResult(measure("filter/debug_sampled_0.1pct", CALL_COUNT,
+			[](std::uint64_t i) { AETHER_LOG_DEBUG("value {}", i); }));
+		aether_cpplogger::Logger::setSamplingPolicy(aether_cpplogger::LogSeverity::DEBUG, aether_cpplogger::SamplingPolicy());
+
+		//DEBUG logs over the severity limit are formatted into the flight recorder ring of the thread only
+		aether_cpplogger::Logger::init(directory.string(), false, aether_cpplogger::LogSeverity::INFO, 1048576);
+		aether_cpplogger::FlightRecorderPolicy flightRecorderPolicy;
+		flightRecorderPolicy.IsEnabled = true;
+		flightRecorderPolicy.Severity = aether_cpplogger::LogSeverity::DEBUG;
+		flightRecorderPolicy.IsDumpedOnSignal = false;
+		aether_cpplogger::Logger::setFlightRecorderPolicy(flightRecorderPolicy);
+		printResult(measure("filter/debug_flight_recorded", LEGACY_CALL_COUNT,
+			[](std::uint64_t i) { AETHER_LOG_DEBUG("value {}", i); }));
+		aether_cpplogger::Logger::setFlightRecorderPolicy(aether_cpplogger::FlightRecorderPolicy());
+
+		aether_cpplogger::Logger::setFlushPolicy(aether_cpplogger::FlushPolicy());
+		aether_cpplogger::Logger::shutdown();
+		std::filesystem::remove_all(directory);
+	}
+}
\ No newline at end of file
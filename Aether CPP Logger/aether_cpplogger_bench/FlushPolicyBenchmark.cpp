@@ -0,0 +1,101 @@
+#include "Benchmark.h"
+#include "Logger.h"
+
+#include <fstream>
+#include <limits>
+
+namespace
+{
+	constexpr std::uint64_t LINE_COUNT = 100000;
+	constexpr std::uint64_t LEGACY_LINE_COUNT = 20000;
+	constexpr int SIZE_LIMIT = 64 * 1048576;
+
+	const std::string BENCHMARK_MESSAGE = "Request handled successfully by the benchmark worker";
+
+	/**
+	 * @brief Reproduces the original file sink: every line checks the directory, probes the indexed file names,
+		opens the file, writes the line with std::endl and closes the file
+	*/
+	void writeLegacyLine(const std::filesystem::path& directory, std::string_view message)
+	{
+		if (!std::filesystem::exists(directory))
+		{
+			std::filesystem::create_directories(directory);
+		}
+
+		std::filesystem::path logFile;
+		for (int index = 1; ; ++index)
+		{
+			logFile = directory / ("legacy" + (index > 1 ? "_" + std::to_string(index) : std::string()) + ".log");
+			if (!std::filesystem::exists(logFile) || std::filesystem::file_size(logFile) < static_cast<std::uintmax_t>(SIZE_LIMIT))
+			{
+				break;
+			}
+		}
+
+		std::ofstream outLogFile;
+		outLogFile.open(logFile, std::ios::app | std::ios::out);
+		outLogFile << message << std::endl;
+		outLogFile.close();
+	}
+
+	/**
+	 * @brief Logs through the Logger with the given flush policy and log file mode and prints the lines per second
+	*/
+	void runPolicy(std::string_view name, const aether_cpplogger::FlushPolicy& flushPolicy,
+		const aether_cpplogger::LogFileMode logFileMode = aether_cpplogger::LogFileMode::BUFFERED)
+	{
+		const auto& directory = aether_cpplogger_bench::createBenchmarkDirectory(name);
+		aether_cpplogger::Logger::init(directory.string(), false, aether_cpplogger::LogSeverity::INFO, SIZE_LIMIT);
+		aether_cpplogger::Logger::setFlushPolicy(flushPolicy);
+		aether_cpplogger::Logger::setLogFileMode(logFileMode);
+
+		const auto& result = aether_cpplogger_bench::measure("flush_policy/" + std::string(name), LINE_COUNT,
+			[](std::uint64_t) { aether_cpplogger::Logger::logInfo(BENCHMARK_MESSAGE); },
+			[]() { aether_cpplogger::Logger::flush(); });
+		aether_cpplogger_bench::printResult(result);
+
+		aether_cpplogger::Logger::setFlushPolicy(aether_cpplogger::FlushPolicy());
+		aether_cpplogger::Logger::setLogFileMode(aether_cpplogger::LogFileMode::BUFFERED);
+		aether_cpplogger::Logger::shutdown();
+		std::filesystem::remove_all(directory);
+	}
+}
+
+namespace aether_cpplogger_bench
+{
+	void runFlushPolicyBenchmarks()
+	{
+		//Original behaviour: open, write, flush and close for every line
+		{
+			const auto& directory = createBenchmarkDirectory("legacy_open_close");
+			const std::string line = "[INFO]\t\t12:00:00\t\t" + BENCHMARK_MESSAGE;
+
+			const auto& result = measure("flush_policy/legacy_open_close", LEGACY_LINE_COUNT,
+				[&](std::uint64_t) { writeLegacyLine(directory, line); });
+			printResult(result);
+
+			std::filesystem::remove_all(directory);
+		}
+
+		//Persistent file, every line is written and flushed on its own
+		runPolicy("immediate", aether_cpplogger::FlushPolicy());
+
+		//Flush when 64KB are buffered
+		aether_cpplogger::FlushPolicy sizePolicy;
+		sizePolicy.BufferSize = 64 * 1024;
+		runPolicy("size_64k", sizePolicy);
+
+		//Flush every 100ms regardless of the buffered size
+		aether_cpplogger::FlushPolicy intervalPolicy;
+		intervalPolicy.BufferSize = std::numeric_limits<std::size_t>::max();
+		intervalPolicy.Interval = std::chrono::milliseconds(100);
+		runPolicy("interval_100ms", intervalPolicy);
+
+		//Preallocated memory-mapped file, the lines are copied without a write call
+		runPolicy("mapped", aether_cpplogger::FlushPolicy(), aether_cpplogger::LogFileMode::MAPPED);
+
+		//Lines compressed into a .log.gz file while they are written, a frame is ended every 64KB
+		runPolicy("compressed", aether_cpplogger::FlushPolicy(), aether_cpplogger::LogFileMode::COMPRESSED);
+	}
+}
@@ -0,0 +1,113 @@
+#include "Benchmark.h"
+#include "Logger.h"
+
+namespace
+{
+	constexpr std::uint64_t LOG_COUNT = 200000;
+	//More than the default async queue capacity so every queue slot has been used once
+	constexpr std::uint64_t WARM_UP_COUNT = 10000;
+	constexpr int SIZE_LIMIT = 256 * 1048576;
+
+	/**
+	 * @brief Logs through the Logger with the given operation and prints the time and the allocations per log.
+		The file sink buffers 64KB so the measurement is dominated by building the message.
+		The time includes the final flush, so in async mode it is bound by the writer thread
+	*/
+	template<typename Operation>
+	void runFormat(std::string_view name, const bool isAsync, const bool isDeferred, const aether_cpplogger::LogFileMode logFileMode, const aether_cpplogger::LogLineFormat lineFormat, Operation&& operation)
+	{
+		const auto& directory = aether_cpplogger_bench::createBenchmarkDirectory(name);
+		aether_cpplogger::Logger::init(directory.string(), false, aether_cpplogger::LogSeverity::INFO, SIZE_LIMIT);
+
+		aether_cpplogger::FlushPolicy flushPolicy;
+		flushPolicy.BufferSize = 64 * 1024;
+		aether_cpplogger::Logger::setFlushPolicy(flushPolicy);
+		aether_cpplogger::Logger::setLogFileMode(logFileMode);
+		aether_cpplogger::Logger::setLineFormat(lineFormat);
+
+		if (isAsync)
+		{
+			aether_cpplogger::Logger::enableAsync();
+		}
+		aether_cpplogger::Logger::setDeferredFormatting(isDeferred);
+
+		//Let the reused buffers reach their final capacity before measuring
+		for (std::uint64_t i = 0; i < WARM_UP_COUNT; ++i)
+		{
+			operation(i);
+		}
+		aether_cpplogger::Logger::flush();
+
+		const auto& result = aether_cpplogger_bench::measure("format/" + std::string(name), LOG_COUNT,
+			operation,
+			[]() { aether_cpplogger::Logger::flush(); });
+		aether_cpplogger_bench::printResult(result);
+
+		aether_cpplogger::Logger::setFlushPolicy(aether_cpplogger::FlushPolicy());
+		aether_cpplogger::Logger::setDeferredFormatting(false);
+		aether_cpplogger::Logger::shutdown();
+		aether_cpplogger::Logger::setLogFileMode(aether_cpplogger::LogFileMode::BUFFERED);
+		aether_cpplogger::Logger::setLineFormat(aether_cpplogger::LogLineFormat::TEXT);
+		std::filesystem::remove_all(directory);
+	}
+}
+
+namespace aether_cpplogger_bench
+{
+	void runFormatBenchmarks()
+	{
+		//Message built by the caller with std::to_string and string concatenation
+		runFormat("concatenation", false, false, aether_cpplogger::LogFileMode::BUFFERED, aether_cpplogger::LogLineFormat::TEXT, [](std::uint64_t i)
+			{
+				aether_cpplogger::Logger::logInfo("user " + std::to_string(i) + " took " + std::to_string(i % 977) + "us");
+			});
+
+		//Message built by the Logger in the reused per-thread buffer
+		runFormat("placeholders", false, false, aether_cpplogger::LogFileMode::BUFFERED, aether_cpplogger::LogLineFormat::TEXT, [](std::uint64_t i)
+			{
+				AETHER_LOG_INFO("user {} took {}us", i, i % 977);
+			});
+
+		//The same in async mode where the message is copied into a reused queue slot
+		runFormat("placeholders_async", true, false, aether_cpplogger::LogFileMode::BUFFERED, aether_cpplogger::LogLineFormat::TEXT, [](std::uint64_t i)
+			{
+				AETHER_LOG_INFO("user {} took {}us", i, i % 977);
+			});
+
+		//Async mode where only the raw arguments are queued and the writer thread formats them
+		runFormat("placeholders_deferred", true, true, aether_cpplogger::LogFileMode::BUFFERED, aether_cpplogger::LogLineFormat::TEXT, [](std::uint64_t i)
+			{
+				AETHER_LOG_INFO("user {} took {}us", i, i % 977);
+			});
+
+		//Binary log file, only the call site ID and the raw arguments are written
+		runFormat("binary", false, false, aether_cpplogger::LogFileMode::BINARY, aether_cpplogger::LogLineFormat::TEXT, [](std::uint64_t i)
+			{
+				AETHER_LOG_INFO("user {} took {}us", i, i % 977);
+			});
+
+		//The same in async mode where the writer thread encodes the records
+		runFormat("binary_async", true, false, aether_cpplogger::LogFileMode::BINARY, aether_cpplogger::LogLineFormat::TEXT, [](std::uint64_t i)
+			{
+				AETHER_LOG_INFO("user {} took {}us", i, i % 977);
+			});
+
+		//Structured log with typed fields written as a JSON line
+		runFormat("fields_json", false, false, aether_cpplogger::LogFileMode::BUFFERED, aether_cpplogger::LogLineFormat::JSON, [](std::uint64_t i)
+			{
+				AETHER_LOG_INFO_FIELDS("request handled", { "user_id", i }, { "latency_us", (i % 977) * 0.5 }, { "path", "/api/v1/users" });
+			});
+
+		//The same as a logfmt line
+		runFormat("fields_logfmt", false, false, aether_cpplogger::LogFileMode::BUFFERED, aether_cpplogger::LogLineFormat::LOGFMT, [](std::uint64_t i)
+			{
+				AETHER_LOG_INFO_FIELDS("request handled", { "user_id", i }, { "latency_us", (i % 977) * 0.5 }, { "path", "/api/v1/users" });
+			});
+
+		//Logs over the severity limit are discarded before formatting
+		runFormat("discarded", false, false, aether_cpplogger::LogFileMode::BUFFERED, aether_cpplogger::LogLineFormat::TEXT, [](std::uint64_t i)
+			{
+				AETHER_LOG_DEBUG("user {} took {}us", i, i % 977);
+			});
+	}
+}
\ No newline at end of file
@@ -0,0 +1,60 @@
+#include "Benchmark.h"
+#include "Logger.h"
+#include "TimestampCache.h"
+
+#include <fstream>
+
+namespace
+{
+	constexpr int SEGMENT_COUNT = 10000;
+	constexpr std::uint64_t STARTUP_COUNT = 20;
+	constexpr int SIZE_LIMIT = 16;
+
+	const std::string BENCHMARK_MESSAGE = "Request handled successfully by the benchmark worker";
+
+	/**
+	 * @brief Reproduces the original index lookup: every index from the first one is probed with an exists and a file_size call
+	*/
+	int findLegacyLogFileIndex(const std::filesystem::path& directory, const std::string& nameBase)
+	{
+		for (int index = 1; ; ++index)
+		{
+			const auto& logFile = directory / (nameBase + (index > 1 ? "_" + std::to_string(index) : std::string()) + ".log");
+			if (!std::filesystem::exists(logFile) || std::filesystem::file_size(logFile) < static_cast<std::uintmax_t>(SIZE_LIMIT))
+			{
+				return index;
+			}
+		}
+	}
+}
+
+namespace aether_cpplogger_bench
+{
+	void runIndexDiscoveryBenchmarks()
+	{
+		//A busy day left full log files of today in the directory
+		const auto& directory = createBenchmarkDirectory("index_discovery");
+		const auto& nameBase = aether_cpplogger::Clock::toDateTime(aether_cpplogger::Clock::now()).currentDateString();
+		for (int index = 1; index <= SEGMENT_COUNT; ++index)
+		{
+			std::ofstream segment(directory / (nameBase + (index > 1 ? "_" + std::to_string(index) : std::string()) + ".log"),
+				std::ios::out | std::ios::binary);
+			segment << std::string(SIZE_LIMIT, 'x');
+		}
+
+		//Original behaviour: probe the indices one by one
+		printResult(measure("index_discovery/legacy_probe_10k", STARTUP_COUNT,
+			[&](std::uint64_t) { findLegacyLogFileIndex(directory, nameBase); }));
+
+		//A single pass over the directory and a single stat of the highest index. Each startup writes one log
+		printResult(measure("index_discovery/logger_startup_10k", STARTUP_COUNT,
+			[&](std::uint64_t)
+			{
+				aether_cpplogger::Logger::init(directory.string(), false, aether_cpplogger::LogSeverity::INFO, SIZE_LIMIT);
+				aether_cpplogger::Logger::logInfo(BENCHMARK_MESSAGE);
+				aether_cpplogger::Logger::shutdown();
+			}));
+
+		std::filesystem::remove_all(directory);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,142 @@
+#include "Benchmark.h"
+#include "Logger.h"
+
+namespace
+{
+	constexpr std::uint64_t FILTER_CALL_COUNT = 100000000;
+	constexpr std::uint64_t STAGE_CALL_COUNT = 5000000;
+	constexpr std::uint64_t WRITE_CALL_COUNT = 1000000;
+	constexpr int SIZE_LIMIT = 256 * 1048576;
+
+	const std::string BENCHMARK_MESSAGE = "Request handled successfully by the benchmark worker";
+
+	constexpr aether_cpplogger::LogSeverity SEVERITIES[] =
+	{
+		aether_cpplogger::LogSeverity::INFO,
+		aether_cpplogger::LogSeverity::WARNING,
+		aether_cpplogger::LogSeverity::ERROR,
+		aether_cpplogger::LogSeverity::DEBUG,
+		aether_cpplogger::LogSeverity::TRACE
+	};
+
+	/**
+	 * @brief Makes the stages of the Logger which are used by logInfo() callable one by one
+	*/
+	class PipelineStages : public aether_cpplogger::Logger
+	{
+	public:
+		using Logger::createMessageSeverityPrefix;
+		using Logger::createMessageTimePrefix;
+		using Logger::createDetailedMessage;
+		using Logger::writeLogToFile;
+		using Logger::notifyReceivers;
+		using Logger::currentDateTime;
+	};
+
+	/**
+	 * @brief A receiver which does nothing, so only the cost of the notification is measured
+	*/
+	class NullReceiver : public aether_cpplogger::Receiver
+	{
+	public:
+		void onReceive(std::string_view) override
+		{
+		}
+	};
+}
+
+namespace aether_cpplogger_bench
+{
+	void runPipelineBenchmarks()
+	{
+		const auto& directory = createBenchmarkDirectory("pipeline");
+		aether_cpplogger::Logger::init(directory.string(), false, aether_cpplogger::LogSeverity::INFO, SIZE_LIMIT);
+
+		//The inline check of the macros with a disabled severity
+		std::uint64_t enabledCount = 0;
+		printResult(measure("pipeline/severity_filter", FILTER_CALL_COUNT, [&enabledCount](std::uint64_t)
+			{
+				enabledCount += aether_cpplogger::Logger::defaultLogger().isSeverityEnabled(aether_cpplogger::LogSeverity::DEBUG) ? 1 : 0;
+			}));
+
+		//The stages which build the line. The bytes are the size of the built strings
+		std::uint64_t bytes = 0;
+		auto result = measure("pipeline/severity_prefix", STAGE_CALL_COUNT, [&bytes](std::uint64_t i)
+			{
+				bytes += PipelineStages::createMessageSeverityPrefix(SEVERITIES[i % std::size(SEVERITIES)]).size();
+			});
+		result.Bytes = bytes;
+		printResult(result);
+
+		const auto& dateTime = PipelineStages::currentDateTime();
+		bytes = 0;
+		result = measure("pipeline/time_prefix", STAGE_CALL_COUNT, [&bytes, &dateTime](std::uint64_t)
+			{
+				bytes += PipelineStages::createMessageTimePrefix(dateTime).size();
+			});
+		result.Bytes = bytes;
+		printResult(result);
+
+		bytes = 0;
+		result = measure("pipeline/detailed_message", STAGE_CALL_COUNT, [&bytes](std::uint64_t)
+			{
+				bytes += PipelineStages::createDetailedMessage(BENCHMARK_MESSAGE, __FILE__, __LINE__).size();
+			});
+		result.Bytes = bytes;
+		printResult(result);
+
+		//The file sink buffers 64KB, the bytes are the size of the written log files
+		aether_cpplogger::FlushPolicy flushPolicy;
+		flushPolicy.BufferSize = 64 * 1024;
+		aether_cpplogger::Logger::setFlushPolicy(flushPolicy);
+
+		result = measure("pipeline/write_log_to_file", WRITE_CALL_COUNT,
+			[&dateTime](std::uint64_t) { PipelineStages::writeLogToFile(BENCHMARK_MESSAGE, dateTime); },
+			[]() { aether_cpplogger::Logger::flush(); });
+		result.Bytes = directorySize(directory);
+		printResult(result);
+
+		//The notification of a receiver which does nothing. The bytes are the size of the forwarded messages
+		NullReceiver receiver;
+		aether_cpplogger::Logger::addReceiver(&receiver);
+		result = measure("pipeline/notify_receivers", STAGE_CALL_COUNT,
+			[](std::uint64_t) { PipelineStages::notifyReceivers(BENCHMARK_MESSAGE); });
+		result.Bytes = result.Operations * BENCHMARK_MESSAGE.size();
+		printResult(result);
+		aether_cpplogger::Logger::clearReceivers();
+
+		//Every stage together
+		aether_cpplogger::Logger::shutdown();
+		std::filesystem::remove_all(directory);
+		std::filesystem::create_directories(directory);
+		result = measure("pipeline/log_info", WRITE_CALL_COUNT,
+			[](std::uint64_t) { aether_cpplogger::Logger::logInfo(BENCHMARK_MESSAGE); },
+			[]() { aether_cpplogger::Logger::flush(); });
+		result.Bytes = directorySize(directory);
+		printResult(result);
+
+		//Every stage with the enqueue, write and flush latencies measured into the histograms
+		aether_cpplogger::StatsPolicy statsPolicy;
+		statsPolicy.IsLatencyTracked = true;
+		aether_cpplogger::Logger::setStatsPolicy(statsPolicy);
+		aether_cpplogger::Logger::shutdown();
+		std::filesystem::remove_all(directory);
+		std::filesystem::create_directories(directory);
+		result = measure("pipeline/log_info_latency_tracked", WRITE_CALL_COUNT,
+			[](std::uint64_t) { aether_cpplogger::Logger::logInfo(BENCHMARK_MESSAGE); },
+			[]() { aether_cpplogger::Logger::flush(); });
+		result.Bytes = directorySize(directory);
+		printResult(result);
+		aether_cpplogger::Logger::setStatsPolicy(aether_cpplogger::StatsPolicy());
+
+		//Keeps the filter loop from being optimized away
+		if (enabledCount > 0)
+		{
+			std::printf("Unexpected enabled severity\n");
+		}
+
+		aether_cpplogger::Logger::setFlushPolicy(aether_cpplogger::FlushPolicy());
+		aether_cpplogger::Logger::shutdown();
+		std::filesystem::remove_all(directory);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,50 @@
+#include "Benchmark.h"
+
+#include <cstdio>
+#include <string_view>
+
+namespace
+{
+	/**
+	 * @brief A named group of benchmarks which can be selected from the command line
+	*/
+	struct BenchmarkSuite
+	{
+		std::string_view Name;
+		void (*Run)();
+	};
+
+	constexpr BenchmarkSuite BENCHMARK_SUITES[] =
+	{
+		{ "flush_policy", &aether_cpplogger_bench::runFlushPolicyBenchmarks },
+		{ "format", &aether_cpplogger_bench::runFormatBenchmarks },
+		{ "filter", &aether_cpplogger_bench::runFilterBenchmarks },
+		{ "index_discovery", &aether_cpplogger_bench::runIndexDiscoveryBenchmarks },
+		{ "async_queue", &aether_cpplogger_bench::runAsyncQueueBenchmarks },
+		{ "pipeline", &aether_cpplogger_bench::runPipelineBenchmarks },
+	};
+}
+
+int main(int argc, char* argv[])
+{
+	//Run every suite by default or only the one given as the first argument
+	const std::string_view selectedSuite = argc > 1 ? argv[1] : "";
+
+	bool isSuiteFound = false;
+	for (const auto& suite : BENCHMARK_SUITES)
+	{
+		if (selectedSuite.empty() || selectedSuite == suite.Name)
+		{
+			suite.Run();
+			isSuiteFound = true;
+		}
+	}
+
+	if (!isSuiteFound)
+	{
+		std::fprintf(stderr, "Unknown benchmark suite: %s\n", argv[1]);
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,339 @@
+#include "JsonReport.h"
+
+#include <cstdio>
+#include <string>
+#include <string_view>
+
+namespace
+{
+	/**
+	 * @brief Writes an indented JSON document member by member. The members of an object and the items of an array are separated automatically
+	*/
+	class JsonWriter
+	{
+	private:
+		std::ostream& m_output;
+		int m_depth = 0;
+		bool m_isFirst = true;
+
+		void separate()
+		{
+			if (m_depth > 0)
+			{
+				if (!m_isFirst)
+				{
+					m_output << ',';
+				}
+				m_output << '\n' << std::string(static_cast<std::size_t>(m_depth), '\t');
+			}
+			m_isFirst = false;
+		}
+
+		void name(std::string_view key)
+		{
+			separate();
+			m_output << '"' << key << "\": ";
+		}
+
+		void open(const char bracket)
+		{
+			m_output << bracket;
+			++m_depth;
+			m_isFirst = true;
+		}
+
+		void close(const char bracket)
+		{
+			--m_depth;
+			if (!m_isFirst)
+			{
+				m_output << '\n' << std::string(static_cast<std::size_t>(m_depth), '\t');
+			}
+			m_output << bracket;
+			m_isFirst = false;
+		}
+
+	public:
+		explicit JsonWriter(std::ostream& output) :
+			m_output(output)
+		{
+		}
+
+		void beginObject()
+		{
+			separate();
+			open('{');
+		}
+
+		void beginObject(std::string_view key)
+		{
+			name(key);
+			open('{');
+		}
+
+		void endObject()
+		{
+			close('}');
+		}
+
+		void beginArray(std::string_view key)
+		{
+			name(key);
+			open('[');
+		}
+
+		void endArray()
+		{
+			close(']');
+		}
+
+		void field(std::string_view key, const std::uint64_t value)
+		{
+			name(key);
+			m_output << value;
+		}
+
+		void field(std::string_view key, const std::int64_t value)
+		{
+			name(key);
+			m_output << value;
+		}
+
+		void field(std::string_view key, const int value)
+		{
+			field(key, static_cast<std::int64_t>(value));
+		}
+
+		void field(std::string_view key, const double value)
+		{
+			char text[32];
+			std::snprintf(text, sizeof(text), "%.3f", value);
+			name(key);
+			m_output << text;
+		}
+
+		void field(std::string_view key, const bool value)
+		{
+			name(key);
+			m_output << (value ? "true" : "false");
+		}
+
+		void field(std::string_view key, std::string_view value)
+		{
+			name(key);
+			m_output << '"';
+			for (const char character : value)
+			{
+				if (character == '"' || character == '\\')
+				{
+					m_output << '\\' << character;
+				}
+				else if (static_cast<unsigned char>(character) < 0x20)
+				{
+					char escaped[8];
+					std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(character));
+					m_output << escaped;
+				}
+				else
+				{
+					m_output << character;
+				}
+			}
+			m_output << '"';
+		}
+
+		void field(std::string_view key, const std::chrono::nanoseconds value)
+		{
+			field(key, static_cast<std::int64_t>(value.count()));
+		}
+	};
+
+	std::string_view arrivalName(const aether_cpplogger_loadgen::ArrivalMode arrival)
+	{
+		switch (arrival)
+		{
+		case aether_cpplogger_loadgen::ArrivalMode::SATURATED:
+			return "saturated";
+		case aether_cpplogger_loadgen::ArrivalMode::STEADY:
+			return "steady";
+		case aether_cpplogger_loadgen::ArrivalMode::BURSTY:
+			return "bursty";
+		}
+
+		return std::string_view();
+	}
+
+	std::string_view sizeDistributionName(const aether_cpplogger_loadgen::MessageSizeDistribution sizeDistribution)
+	{
+		switch (sizeDistribution)
+		{
+		case aether_cpplogger_loadgen::MessageSizeDistribution::FIXED:
+			return "fixed";
+		case aether_cpplogger_loadgen::MessageSizeDistribution::UNIFORM:
+			return "uniform";
+		case aether_cpplogger_loadgen::MessageSizeDistribution::LOGNORMAL:
+			return "lognormal";
+		}
+
+		return std::string_view();
+	}
+
+	std::string_view overflowName(const aether_cpplogger::OverflowPolicy overflow)
+	{
+		switch (overflow)
+		{
+		case aether_cpplogger::OverflowPolicy::BLOCK:
+			return "block";
+		case aether_cpplogger::OverflowPolicy::DROP_NEWEST:
+			return "drop_newest";
+		case aether_cpplogger::OverflowPolicy::DROP_OLDEST:
+			return "drop_oldest";
+		}
+
+		return std::string_view();
+	}
+
+	void writeLatency(JsonWriter& writer, std::string_view key, const aether_cpplogger::LatencyHistogram& histogram)
+	{
+		writer.beginObject(key);
+		writer.field("count", histogram.count());
+		writer.field("mean", histogram.mean());
+		writer.field("p50", histogram.percentile(0.5));
+		writer.field("p90", histogram.percentile(0.9));
+		writer.field("p99", histogram.percentile(0.99));
+		writer.field("p999", histogram.percentile(0.999));
+		writer.field("max", histogram.max());
+		writer.endObject();
+	}
+
+	void writeProfile(JsonWriter& writer, const aether_cpplogger_loadgen::LoadProfile& profile)
+	{
+		writer.beginObject("profile");
+		writer.field("threads", profile.ThreadCount);
+		writer.field("duration_ms", static_cast<std::int64_t>(profile.Duration.count()));
+		writer.beginObject("severity_weights");
+		for (std::size_t i = 0; i < profile.SeverityWeights.size(); ++i)
+		{
+			writer.field(aether_cpplogger::severityName(static_cast<aether_cpplogger::LogSeverity>(i)), profile.SeverityWeights[i]);
+		}
+		writer.endObject();
+		writer.field("severity_limit", aether_cpplogger::severityName(profile.SeverityLimit));
+		writer.field("size_distribution", sizeDistributionName(profile.SizeDistribution));
+		writer.field("message_size", static_cast<std::uint64_t>(profile.MessageSize));
+		writer.field("min_message_size", static_cast<std::uint64_t>(profile.MinMessageSize));
+		writer.field("max_message_size", static_cast<std::uint64_t>(profile.MaxMessageSize));
+		writer.field("arrival", arrivalName(profile.Arrival));
+		writer.field("rate_per_thread", profile.RatePerThread);
+		writer.field("burst_size", static_cast<std::uint64_t>(profile.BurstSize));
+		writer.field("async", profile.IsAsync);
+		writer.field("queue_capacity", static_cast<std::uint64_t>(profile.QueueCapacity));
+		writer.field("queue_mode", std::string_view(profile.QueueMode == aether_cpplogger::AsyncQueueMode::SHARED ? "shared" : "per_thread"));
+		writer.field("overflow", overflowName(profile.Overflow));
+		writer.field("buffer_size", static_cast<std::uint64_t>(profile.BufferSize));
+		writer.field("size_limit", profile.SizeLimit);
+		writer.field("latency_tracked", profile.IsLatencyTracked);
+		writer.field("slow_receivers", profile.SlowReceiverCount);
+		writer.field("receiver_delay_us", static_cast<std::int64_t>(profile.ReceiverDelay.count()));
+		writer.field("receivers_isolated", profile.IsReceiverIsolated);
+		writer.field("seed", static_cast<std::uint64_t>(profile.Seed));
+		writer.endObject();
+	}
+
+	void writeLoggerStats(JsonWriter& writer, const aether_cpplogger::LoggerStats& stats)
+	{
+		writer.beginObject("logger");
+		writer.beginObject("records");
+		for (std::size_t i = 0; i < stats.Records.size(); ++i)
+		{
+			writer.field(aether_cpplogger::severityName(static_cast<aether_cpplogger::LogSeverity>(i)), stats.Records[i]);
+		}
+		writer.endObject();
+		writer.field("bytes_written", stats.BytesWritten);
+		writer.field("rotations", stats.Rotations);
+		writer.field("exceptions", stats.Exceptions);
+		writer.field("dropped_records", stats.DroppedRecords);
+		writeLatency(writer, "enqueue_latency_ns", stats.EnqueueLatency);
+		writeLatency(writer, "write_latency_ns", stats.WriteLatency);
+		writeLatency(writer, "flush_latency_ns", stats.FlushLatency);
+		writer.endObject();
+	}
+}
+
+namespace aether_cpplogger_loadgen
+{
+	void writeJsonReport(std::ostream& output, const LoadProfile& profile, const LoadResult& result)
+	{
+		JsonWriter writer(output);
+		writer.beginObject();
+		writeProfile(writer, profile);
+
+		writer.beginObject("result");
+		writer.field("logs", result.Logs);
+		writer.field("producer_duration_ns", result.ProducerDuration);
+		writer.field("throughput_logs_per_second", result.throughput());
+		writeLatency(writer, "call_latency_ns", result.CallLatency);
+		writeLatency(writer, "response_latency_ns", result.ResponseLatency);
+		writer.field("drain_ns", result.drainDuration());
+		writer.field("flush_ns", result.FlushDuration);
+		writer.field("receiver_removal_ns", result.ReceiverRemovalDuration);
+		writer.field("shutdown_ns", result.ShutdownDuration);
+		writer.endObject();
+
+		writeLoggerStats(writer, result.Stats);
+
+		writer.beginArray("receivers");
+		for (const auto& receiver : result.Receivers)
+		{
+			writer.beginObject();
+			writer.field("received_records", receiver.ReceivedRecords);
+			writer.field("dropped_records", receiver.Stats.DroppedRecords);
+			writer.field("max_lag_us", static_cast<std::int64_t>(receiver.Stats.MaxLag.count()));
+			writer.field("receive_time_ns", receiver.Stats.ReceiveTime);
+			writer.field("max_receive_time_ns", receiver.Stats.MaxReceiveTime);
+			writer.endObject();
+		}
+		writer.endArray();
+
+		writer.endObject();
+		output << '\n';
+	}
+
+	void writeSummary(std::ostream& output, const LoadResult& result)
+	{
+		const auto& toMicroseconds = [](const std::chrono::nanoseconds value)
+		{
+			return static_cast<double>(value.count()) / 1000.0;
+		};
+
+		char line[256];
+		std::snprintf(line, sizeof(line), "logs %llu in %.3f s, %.0f logs/s, drained in %.3f ms\n",
+			static_cast<unsigned long long>(result.Logs),
+			static_cast<double>(result.ProducerDuration.count()) / 1e9,
+			result.throughput(),
+			static_cast<double>(result.drainDuration().count()) / 1e6);
+		output << line;
+
+		std::snprintf(line, sizeof(line), "call latency us: p50 %.2f p99 %.2f p99.9 %.2f max %.2f\n",
+			toMicroseconds(result.CallLatency.percentile(0.5)),
+			toMicroseconds(result.CallLatency.percentile(0.99)),
+			toMicroseconds(result.CallLatency.percentile(0.999)),
+			toMicroseconds(result.CallLatency.max()));
+		output << line;
+
+		if (result.ResponseLatency.count() > 0)
+		{
+			std::snprintf(line, sizeof(line), "response latency us: p50 %.2f p99 %.2f p99.9 %.2f max %.2f\n",
+				toMicroseconds(result.ResponseLatency.percentile(0.5)),
+				toMicroseconds(result.ResponseLatency.percentile(0.99)),
+				toMicroseconds(result.ResponseLatency.percentile(0.999)),
+				toMicroseconds(result.ResponseLatency.max()));
+			output << line;
+		}
+
+		std::snprintf(line, sizeof(line), "written %llu bytes, %llu rotations, %llu dropped\n",
+			static_cast<unsigned long long>(result.Stats.BytesWritten),
+			static_cast<unsigned long long>(result.Stats.Rotations),
+			static_cast<unsigned long long>(result.Stats.DroppedRecords));
+		output << line;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,25 @@
+#pragma once
+#include "LoadGenerator.h"
+#include "LoadProfile.h"
+
+#include <ostream>
+
+namespace aether_cpplogger_loadgen
+{
+	/**
+	 * @brief Writes the profile and the result of a run as a JSON object, so the runs can be compared by scripts.
+		The times are in nanoseconds, the latencies give the count, the mean, the p50, p90, p99, p99.9 percentiles and the maximum
+	 *
+	 * @param output The stream the JSON is written to
+	 * @param profile The profile of the run
+	 * @param result The result of the run
+	*/
+	void writeJsonReport(std::ostream& output, const LoadProfile& profile, const LoadResult& result);
+	/**
+	 * @brief Prints the main figures of the run in a few human readable lines
+	 *
+	 * @param output The stream the summary is written to
+	 * @param result The result of the run
+	*/
+	void writeSummary(std::ostream& output, const LoadResult& result);
+}
\ No newline at end of file
@@ -0,0 +1,296 @@
+#include "LoadGenerator.h"
+#include "Logger.h"
+#include "LoggerException.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+
+namespace
+{
+	//Every producer cycles through its own pre-made messages and severities, so drawing them is not part of the measured calls
+	constexpr std::size_t MESSAGE_POOL_SIZE = 1024;
+	constexpr std::size_t SEVERITY_POOL_SIZE = 4096;
+	//The spread of the LOGNORMAL sizes: about 5% of the messages are 3.4 times longer than the median
+	constexpr double LOGNORMAL_SIGMA = 0.75;
+	//A producer ahead of its schedule sleeps until this close to its next log and yields for the rest
+	constexpr std::chrono::microseconds SLEEP_MARGIN = std::chrono::microseconds(1000);
+
+	/**
+	 * @brief Makes the Logger::log() call of the static interface callable with any severity
+	*/
+	class LoadLogger : public aether_cpplogger::Logger
+	{
+	public:
+		using Logger::log;
+	};
+
+	/**
+	 * @brief A receiver which keeps the CPU busy for the given time with every log, like a receiver which serializes or ships the logs.
+		It spins instead of sleeping, because the sleeps are far longer than the delays of a few microseconds
+	*/
+	class SlowReceiver : public aether_cpplogger::Receiver
+	{
+	private:
+		const std::chrono::microseconds m_delay;
+		std::atomic<std::uint64_t> m_receivedRecords{ 0 };
+
+	public:
+		explicit SlowReceiver(const std::chrono::microseconds delay) :
+			m_delay(delay)
+		{
+		}
+
+		void onReceiveRecord(const aether_cpplogger::RecordView&) override
+		{
+			const auto end = std::chrono::steady_clock::now() + m_delay;
+			while (std::chrono::steady_clock::now() < end)
+			{
+			}
+			m_receivedRecords.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		std::uint64_t receivedRecords() const
+		{
+			return m_receivedRecords.load(std::memory_order_relaxed);
+		}
+	};
+
+	/**
+	 * @brief The logs and the latencies of a single producer thread
+	*/
+	struct ProducerResult
+	{
+		std::uint64_t Logs = 0;
+		aether_cpplogger::LatencyHistogram CallLatency;
+		aether_cpplogger::LatencyHistogram ResponseLatency;
+	};
+
+	std::size_t drawMessageSize(const aether_cpplogger_loadgen::LoadProfile& profile, std::mt19937& generator)
+	{
+		switch (profile.SizeDistribution)
+		{
+		case aether_cpplogger_loadgen::MessageSizeDistribution::FIXED:
+			return profile.MessageSize;
+		case aether_cpplogger_loadgen::MessageSizeDistribution::UNIFORM:
+			return std::uniform_int_distribution<std::size_t>(profile.MinMessageSize, profile.MaxMessageSize)(generator);
+		case aether_cpplogger_loadgen::MessageSizeDistribution::LOGNORMAL:
+		{
+			std::lognormal_distribution<double> distribution(std::log(static_cast<double>(profile.MessageSize)), LOGNORMAL_SIGMA);
+			const double size = std::clamp(distribution(generator), static_cast<double>(profile.MinMessageSize), static_cast<double>(profile.MaxMessageSize));
+			return static_cast<std::size_t>(size);
+		}
+		}
+
+		return profile.MessageSize;
+	}
+
+	/**
+	 * @brief Creates the messages of a producer. Each message starts with the producer and its index and is padded to its drawn size
+	*/
+	std::vector<std::string> createMessages(const aether_cpplogger_loadgen::LoadProfile& profile, const int producer, std::mt19937& generator)
+	{
+		std::vector<std::string> messages;
+		messages.reserve(MESSAGE_POOL_SIZE);
+		for (std::size_t i = 0; i < MESSAGE_POOL_SIZE; ++i)
+		{
+			auto message = "Producer " + std::to_string(producer) + " handled request " + std::to_string(i) + " ";
+			message.resize(drawMessageSize(profile, generator), 'x');
+			messages.push_back(std::move(message));
+		}
+
+		return messages;
+	}
+
+	std::vector<aether_cpplogger::LogSeverity> createSeverities(const aether_cpplogger_loadgen::LoadProfile& profile, std::mt19937& generator)
+	{
+		std::discrete_distribution<int> distribution(profile.SeverityWeights.begin(), profile.SeverityWeights.end());
+
+		std::vector<aether_cpplogger::LogSeverity> severities;
+		severities.reserve(SEVERITY_POOL_SIZE);
+		for (std::size_t i = 0; i < SEVERITY_POOL_SIZE; ++i)
+		{
+			severities.push_back(static_cast<aether_cpplogger::LogSeverity>(distribution(generator)));
+		}
+
+		return severities;
+	}
+
+	/**
+	 * @brief Returns the planned time of the given log of a producer in STEADY and BURSTY mode
+	*/
+	std::chrono::steady_clock::time_point plannedTime(const aether_cpplogger_loadgen::LoadProfile& profile, const std::chrono::steady_clock::time_point start, const std::uint64_t log)
+	{
+		const double interval = 1e9 / profile.RatePerThread;
+		const double offset = profile.Arrival == aether_cpplogger_loadgen::ArrivalMode::BURSTY
+			? static_cast<double>(log / profile.BurstSize) * interval * static_cast<double>(profile.BurstSize)
+			: static_cast<double>(log) * interval;
+
+		return start + std::chrono::nanoseconds(static_cast<std::int64_t>(offset));
+	}
+
+	void waitUntil(const std::chrono::steady_clock::time_point time)
+	{
+		for (auto now = std::chrono::steady_clock::now(); now < time; now = std::chrono::steady_clock::now())
+		{
+			if (time - now > SLEEP_MARGIN)
+			{
+				std::this_thread::sleep_for(time - now - SLEEP_MARGIN);
+			}
+			else
+			{
+				std::this_thread::yield();
+			}
+		}
+	}
+
+	/**
+	 * @brief Logs with the traffic of the profile until the end of the run and measures every call
+	*/
+	void runProducer(const aether_cpplogger_loadgen::LoadProfile& profile, const int producer, const std::atomic<bool>& isStarted, ProducerResult& result)
+	{
+		std::mt19937 generator(profile.Seed + static_cast<std::uint32_t>(producer));
+		const auto& messages = createMessages(profile, producer, generator);
+		const auto& severities = createSeverities(profile, generator);
+
+		while (!isStarted.load(std::memory_order_acquire))
+		{
+			std::this_thread::yield();
+		}
+
+		const bool isPaced = profile.Arrival != aether_cpplogger_loadgen::ArrivalMode::SATURATED;
+		const auto start = std::chrono::steady_clock::now();
+		const auto end = start + profile.Duration;
+
+		auto callEnd = start;
+		for (std::uint64_t i = 0;; ++i)
+		{
+			auto planned = callEnd;
+			if (isPaced)
+			{
+				planned = plannedTime(profile, start, i);
+				if (planned >= end)
+				{
+					break;
+				}
+				waitUntil(planned);
+			}
+			else if (callEnd >= end)
+			{
+				break;
+			}
+
+			const auto callStart = std::chrono::steady_clock::now();
+			LoadLogger::log(messages[i % MESSAGE_POOL_SIZE], severities[i % SEVERITY_POOL_SIZE]);
+			callEnd = std::chrono::steady_clock::now();
+
+			result.CallLatency.record(static_cast<std::uint64_t>((callEnd - callStart).count()));
+			if (isPaced)
+			{
+				result.ResponseLatency.record(static_cast<std::uint64_t>((callEnd - planned).count()));
+			}
+			++result.Logs;
+		}
+	}
+}
+
+namespace aether_cpplogger_loadgen
+{
+	LoadResult runLoad(const LoadProfile& profile)
+	{
+		//The run writes into a new directory of its own, so removing its logs never touches the files of the user
+		const auto logPath = std::filesystem::path(profile.LogPath) /
+			("run_" + std::to_string(std::chrono::system_clock::now().time_since_epoch().count()));
+		std::filesystem::create_directories(profile.LogPath);
+		if (!std::filesystem::create_directory(logPath))
+		{
+			throw aether_cpplogger::LoggerException("The log directory of the run already exists: " + logPath.string());
+		}
+		aether_cpplogger::Logger::init(logPath.string(), false, profile.SeverityLimit, profile.SizeLimit);
+
+		aether_cpplogger::FlushPolicy flushPolicy;
+		flushPolicy.BufferSize = profile.BufferSize;
+		aether_cpplogger::Logger::setFlushPolicy(flushPolicy);
+
+		aether_cpplogger::StatsPolicy statsPolicy;
+		statsPolicy.IsLatencyTracked = profile.IsLatencyTracked;
+		aether_cpplogger::Logger::setStatsPolicy(statsPolicy);
+
+		aether_cpplogger::ReceiverPolicy receiverPolicy;
+		receiverPolicy.IsIsolated = profile.IsReceiverIsolated;
+		std::vector<std::unique_ptr<SlowReceiver>> receivers;
+		for (int i = 0; i < profile.SlowReceiverCount; ++i)
+		{
+			receivers.push_back(std::make_unique<SlowReceiver>(profile.ReceiverDelay));
+			aether_cpplogger::Logger::addReceiver(receivers.back().get(), receiverPolicy);
+		}
+
+		if (profile.IsAsync)
+		{
+			aether_cpplogger::Logger::enableAsync(profile.QueueCapacity, profile.Overflow, profile.QueueMode);
+		}
+
+		//The producers create their messages first, the measurement starts when all of them are ready
+		std::atomic<bool> isStarted{ false };
+		std::vector<ProducerResult> producerResults(static_cast<std::size_t>(profile.ThreadCount));
+		std::vector<std::thread> producers;
+		for (int i = 0; i < profile.ThreadCount; ++i)
+		{
+			producers.emplace_back(&runProducer, std::cref(profile), i, std::cref(isStarted), std::ref(producerResults[static_cast<std::size_t>(i)]));
+		}
+
+		LoadResult result;
+		const auto start = std::chrono::steady_clock::now();
+		isStarted.store(true, std::memory_order_release);
+		for (auto& producer : producers)
+		{
+			producer.join();
+		}
+		auto time = std::chrono::steady_clock::now();
+		result.ProducerDuration = time - start;
+
+		for (const auto& producerResult : producerResults)
+		{
+			result.Logs += producerResult.Logs;
+			result.CallLatency.merge(producerResult.CallLatency);
+			result.ResponseLatency.merge(producerResult.ResponseLatency);
+		}
+
+		//The drain at shutdown: the queued logs, the isolated receivers and the log file
+		aether_cpplogger::Logger::flush();
+		result.FlushDuration = std::chrono::steady_clock::now() - time;
+
+		for (const auto& receiver : receivers)
+		{
+			result.Receivers.push_back(SlowReceiverResult{ 0, aether_cpplogger::Logger::receiverStats(receiver.get()) });
+		}
+		time = std::chrono::steady_clock::now();
+		aether_cpplogger::Logger::clearReceivers();
+		result.ReceiverRemovalDuration = std::chrono::steady_clock::now() - time;
+		for (std::size_t i = 0; i < receivers.size(); ++i)
+		{
+			result.Receivers[i].ReceivedRecords = receivers[i]->receivedRecords();
+		}
+
+		time = std::chrono::steady_clock::now();
+		aether_cpplogger::Logger::shutdown();
+		result.ShutdownDuration = std::chrono::steady_clock::now() - time;
+
+		result.Stats = aether_cpplogger::Logger::stats();
+		aether_cpplogger::Logger::setStatsPolicy(aether_cpplogger::StatsPolicy());
+		aether_cpplogger::Logger::setFlushPolicy(aether_cpplogger::FlushPolicy());
+		result.LogPath = logPath.string();
+		if (!profile.IsLogKept)
+		{
+			std::filesystem::remove_all(logPath);
+		}
+
+		return result;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,102 @@
+#pragma once
+#include "LoadProfile.h"
+#include "LatencyHistogram.h"
+#include "LoggerStats.h"
+#include "ReceiverStats.h"
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace aether_cpplogger_loadgen
+{
+	/**
+	 * @brief What a slow receiver got during the run
+	*/
+	struct SlowReceiverResult
+	{
+		/**
+		 * @brief Number of logs the receiver was notified about
+		*/
+		std::uint64_t ReceivedRecords = 0;
+		/**
+		 * @brief The counters of the Logger about the receiver. They are all zero if the receiver is not isolated
+		*/
+		aether_cpplogger::ReceiverStats Stats;
+	};
+
+	/**
+	 * @brief The measured result of a load generator run
+	*/
+	struct LoadResult
+	{
+		/**
+		 * @brief Number of logs made by the producer threads
+		*/
+		std::uint64_t Logs = 0;
+		/**
+		 * @brief The wall clock time from the start of the producers until the last of them finished
+		*/
+		std::chrono::nanoseconds ProducerDuration = std::chrono::nanoseconds(0);
+		/**
+		 * @brief The time of the Logger::flush() after the producers finished: the async queue and the isolated receivers are drained
+		*/
+		std::chrono::nanoseconds FlushDuration = std::chrono::nanoseconds(0);
+		/**
+		 * @brief The time of removing the receivers, which waits for the dispatcher threads of the isolated ones
+		*/
+		std::chrono::nanoseconds ReceiverRemovalDuration = std::chrono::nanoseconds(0);
+		/**
+		 * @brief The time of the Logger::shutdown() after the flush
+		*/
+		std::chrono::nanoseconds ShutdownDuration = std::chrono::nanoseconds(0);
+
+		/**
+		 * @brief The time each log call took in the producer thread
+		*/
+		aether_cpplogger::LatencyHistogram CallLatency;
+		/**
+		 * @brief The time from the planned start of each log until its call returned. It includes the time a producer fell behind its
+			schedule because of the earlier calls, so a stall is counted for every log it delays. It is empty in SATURATED mode
+		*/
+		aether_cpplogger::LatencyHistogram ResponseLatency;
+
+		/**
+		 * @brief The counters of the Logger at the end of the run
+		*/
+		aether_cpplogger::LoggerStats Stats;
+		/**
+		 * @brief The result of every slow receiver
+		*/
+		std::vector<SlowReceiverResult> Receivers;
+		/**
+		 * @brief The log directory created for the run. It is removed after the run unless the logs are kept
+		*/
+		std::string LogPath;
+
+		/**
+		 * @brief Returns the time from the producers finishing until the Logger shut down
+		*/
+		std::chrono::nanoseconds drainDuration() const
+		{
+			return FlushDuration + ReceiverRemovalDuration + ShutdownDuration;
+		}
+		/**
+		 * @brief Returns the logs per second the producers sustained
+		*/
+		double throughput() const
+		{
+			return ProducerDuration.count() > 0 ? static_cast<double>(Logs) * 1e9 / static_cast<double>(ProducerDuration.count()) : 0.0;
+		}
+	};
+
+	/**
+	 * @brief Runs the traffic of the profile against the default Logger. The Logger is initialized for the run and shut down after it
+	 *
+	 * @param profile The traffic and the Logger settings
+	 *
+	 * @return The measured result
+	*/
+	LoadResult runLoad(const LoadProfile& profile);
+}
\ No newline at end of file
@@ -0,0 +1,160 @@
+#pragma once
+#include "AsyncWriter.h"
+#include "LogSeverity.h"
+#include "OverflowPolicy.h"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace aether_cpplogger_loadgen
+{
+	/**
+	 * @brief Defines when the producer threads make their logs
+	*/
+	enum class ArrivalMode
+	{
+		/**
+		 * @brief Every producer logs again as soon as its previous log returns
+		*/
+		SATURATED,
+		/**
+		 * @brief Every producer logs at evenly spaced times at the given rate
+		*/
+		STEADY,
+		/**
+		 * @brief Every producer makes bursts of logs at once, the bursts are evenly spaced to keep the given average rate
+		*/
+		BURSTY
+	};
+
+	/**
+	 * @brief Defines how the sizes of the log messages are drawn
+	*/
+	enum class MessageSizeDistribution
+	{
+		/**
+		 * @brief Every message has the given size
+		*/
+		FIXED,
+		/**
+		 * @brief The sizes are uniform between the minimum and the maximum size
+		*/
+		UNIFORM,
+		/**
+		 * @brief The sizes are log-normal around the given size as median, limited by the minimum and the maximum size.
+			It gives the long tail of the messages of real applications
+		*/
+		LOGNORMAL
+	};
+
+	/**
+	 * @brief The traffic of a load generator run and the settings of the Logger it runs against
+	*/
+	struct LoadProfile
+	{
+		/**
+		 * @brief The number of producer threads
+		*/
+		int ThreadCount = 4;
+		/**
+		 * @brief The time the producer threads log for
+		*/
+		std::chrono::milliseconds Duration = std::chrono::milliseconds(5000);
+		/**
+		 * @brief The relative weights of the severities in the logs, indexed by the value of LogSeverity
+		*/
+		std::array<double, 5> SeverityWeights{ 70.0, 10.0, 2.0, 15.0, 3.0 };
+		/**
+		 * @brief The severity limit of the Logger. The logs over the limit are made but filtered out
+		*/
+		aether_cpplogger::LogSeverity SeverityLimit = aether_cpplogger::LogSeverity::INFO;
+
+		/**
+		 * @brief The distribution of the message sizes
+		*/
+		MessageSizeDistribution SizeDistribution = MessageSizeDistribution::LOGNORMAL;
+		/**
+		 * @brief The size of the FIXED messages and the median of the LOGNORMAL ones in bytes
+		*/
+		std::size_t MessageSize = 128;
+		/**
+		 * @brief The smallest message in bytes
+		*/
+		std::size_t MinMessageSize = 16;
+		/**
+		 * @brief The largest message in bytes
+		*/
+		std::size_t MaxMessageSize = 4096;
+
+		/**
+		 * @brief When the producers make their logs
+		*/
+		ArrivalMode Arrival = ArrivalMode::SATURATED;
+		/**
+		 * @brief The logs per second of each producer in STEADY and BURSTY mode
+		*/
+		double RatePerThread = 10000.0;
+		/**
+		 * @brief The number of logs made at once in BURSTY mode
+		*/
+		std::size_t BurstSize = 1000;
+
+		/**
+		 * @brief Run the Logger in async mode
+		*/
+		bool IsAsync = true;
+		/**
+		 * @brief The capacity of the async queue
+		*/
+		std::size_t QueueCapacity = 65536;
+		/**
+		 * @brief Whether the producers share the async queue
+		*/
+		aether_cpplogger::AsyncQueueMode QueueMode = aether_cpplogger::AsyncQueueMode::SHARED;
+		/**
+		 * @brief The behaviour when the async queue is full
+		*/
+		aether_cpplogger::OverflowPolicy Overflow = aether_cpplogger::OverflowPolicy::BLOCK;
+		/**
+		 * @brief The size of the write buffer of the log file. Zero writes every log immediately
+		*/
+		std::size_t BufferSize = 64 * 1024;
+		/**
+		 * @brief The size limit of a log file in bytes. A small limit makes the Logger rotate its log files often
+		*/
+		int SizeLimit = 64 * 1048576;
+		/**
+		 * @brief Let the Logger measure the latencies of its enqueue, writes and flushes, see StatsPolicy
+		*/
+		bool IsLatencyTracked = false;
+
+		/**
+		 * @brief The number of slow receivers attached to the Logger
+		*/
+		int SlowReceiverCount = 0;
+		/**
+		 * @brief The time a slow receiver spends with every log
+		*/
+		std::chrono::microseconds ReceiverDelay = std::chrono::microseconds(20);
+		/**
+		 * @brief Attach the slow receivers as isolated receivers with a dispatcher thread of their own
+		*/
+		bool IsReceiverIsolated = false;
+
+		/**
+		 * @brief The seed of the random message sizes and severities. Every producer derives its own generator from it
+		*/
+		std::uint32_t Seed = 1;
+		/**
+		 * @brief The directory the run creates its own log directory in. Nothing else in it is touched
+		*/
+		std::string LogPath;
+		/**
+		 * @brief Keep the log directory of the run afterwards
+		*/
+		bool IsLogKept = false;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,314 @@
+#include "JsonReport.h"
+#include "LoadGenerator.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace
+{
+	template<typename Value>
+	using NamedValue = std::pair<std::string_view, Value>;
+
+	constexpr NamedValue<aether_cpplogger::LogSeverity> SEVERITY_NAMES[] =
+	{
+		{ "info", aether_cpplogger::LogSeverity::INFO },
+		{ "warning", aether_cpplogger::LogSeverity::WARNING },
+		{ "error", aether_cpplogger::LogSeverity::ERROR },
+		{ "debug", aether_cpplogger::LogSeverity::DEBUG },
+		{ "trace", aether_cpplogger::LogSeverity::TRACE },
+	};
+
+	constexpr NamedValue<aether_cpplogger_loadgen::MessageSizeDistribution> SIZE_DISTRIBUTION_NAMES[] =
+	{
+		{ "fixed", aether_cpplogger_loadgen::MessageSizeDistribution::FIXED },
+		{ "uniform", aether_cpplogger_loadgen::MessageSizeDistribution::UNIFORM },
+		{ "lognormal", aether_cpplogger_loadgen::MessageSizeDistribution::LOGNORMAL },
+	};
+
+	constexpr NamedValue<aether_cpplogger_loadgen::ArrivalMode> ARRIVAL_NAMES[] =
+	{
+		{ "saturated", aether_cpplogger_loadgen::ArrivalMode::SATURATED },
+		{ "steady", aether_cpplogger_loadgen::ArrivalMode::STEADY },
+		{ "bursty", aether_cpplogger_loadgen::ArrivalMode::BURSTY },
+	};
+
+	constexpr NamedValue<aether_cpplogger::AsyncQueueMode> QUEUE_MODE_NAMES[] =
+	{
+		{ "shared", aether_cpplogger::AsyncQueueMode::SHARED },
+		{ "per_thread", aether_cpplogger::AsyncQueueMode::PER_THREAD },
+	};
+
+	constexpr NamedValue<aether_cpplogger::OverflowPolicy> OVERFLOW_NAMES[] =
+	{
+		{ "block", aether_cpplogger::OverflowPolicy::BLOCK },
+		{ "drop_newest", aether_cpplogger::OverflowPolicy::DROP_NEWEST },
+		{ "drop_oldest", aether_cpplogger::OverflowPolicy::DROP_OLDEST },
+	};
+
+	void printUsage()
+	{
+		std::fprintf(stderr,
+			"Usage: aether_cpplogger_loadgen [options]\n"
+			"Logs production-like traffic from several threads and reports the call latencies, the throughput and the drain at shutdown as JSON\n"
+			"\n"
+			"  --threads <count>             Number of producer threads (default 4)\n"
+			"  --duration-ms <ms>            Time the producers log for (default 5000)\n"
+			"  --severity-mix <i,w,e,d,t>    Relative weights of INFO, WARNING, ERROR, DEBUG and TRACE logs (default 70,10,2,15,3)\n"
+			"  --severity-limit <severity>   Severity limit of the Logger: info, warning, error, debug or trace (default info)\n"
+			"  --size-distribution <name>    Message sizes: fixed, uniform or lognormal (default lognormal)\n"
+			"  --message-size <bytes>        Size of the fixed messages, median of the lognormal ones (default 128)\n"
+			"  --min-message-size <bytes>    Smallest message (default 16)\n"
+			"  --max-message-size <bytes>    Largest message (default 4096)\n"
+			"  --arrival <mode>              saturated, steady or bursty (default saturated)\n"
+			"  --rate <logs>                 Logs per second of each producer in steady and bursty mode (default 10000)\n"
+			"  --burst-size <logs>           Logs of a burst in bursty mode (default 1000)\n"
+			"  --sync                        Log in sync mode instead of async mode\n"
+			"  --queue-capacity <logs>       Capacity of the async queue (default 65536)\n"
+			"  --queue-mode <mode>           shared or per_thread (default shared)\n"
+			"  --overflow <policy>           block, drop_newest or drop_oldest (default block)\n"
+			"  --buffer-size <bytes>         Write buffer of the log file, 0 writes every log (default 65536)\n"
+			"  --size-limit <bytes>          Size of a log file before the next one is opened (default 67108864)\n"
+			"  --track-latency               Let the Logger measure its enqueue, write and flush latencies\n"
+			"  --slow-receivers <count>      Number of receivers which spend the receiver delay with every log (default 0)\n"
+			"  --receiver-delay-us <us>      Time a slow receiver spends with a log (default 20)\n"
+			"  --isolated-receivers          Attach the slow receivers with a dispatcher thread of their own\n"
+			"  --seed <number>               Seed of the message sizes and severities (default 1)\n"
+			"  --log-path <directory>        Directory the run creates its own log directory in, nothing else in it is removed\n"
+			"                                (default in the temporary folder)\n"
+			"  --keep-logs                   Keep the log directory of the run afterwards\n"
+			"  --output <file>               Write the JSON to the file instead of the standard output\n");
+	}
+
+	template<typename Number>
+	bool parseNumber(std::string_view value, Number& result)
+	{
+		const auto parsed = std::from_chars(value.data(), value.data() + value.size(), result);
+		return parsed.ec == std::errc() && parsed.ptr == value.data() + value.size();
+	}
+
+	template<typename Value, std::size_t Count>
+	bool parseName(std::string_view value, const NamedValue<Value>(&names)[Count], Value& result)
+	{
+		for (const auto& [name, namedValue] : names)
+		{
+			if (value == name)
+			{
+				result = namedValue;
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	bool parseSeverityMix(std::string_view value, std::array<double, 5>& weights)
+	{
+		for (std::size_t i = 0; i < weights.size(); ++i)
+		{
+			const auto separator = value.find(',');
+			if ((separator == std::string_view::npos) != (i + 1 == weights.size()) || !parseNumber(value.substr(0, separator), weights[i]) || weights[i] < 0.0)
+			{
+				return false;
+			}
+			value.remove_prefix(separator == std::string_view::npos ? value.size() : separator + 1);
+		}
+
+		return true;
+	}
+
+	/**
+	 * @brief Parses the command line into the profile
+	 *
+	 * @return False if the command line is invalid
+	*/
+	bool parseOptions(int argc, char* argv[], aether_cpplogger_loadgen::LoadProfile& profile, std::string& outputPath)
+	{
+		for (int i = 1; i < argc; ++i)
+		{
+			const std::string_view argument = argv[i];
+			const bool hasValue = i + 1 < argc;
+			const std::string_view value = hasValue ? argv[i + 1] : "";
+
+			bool isValid = true;
+			if (argument == "--sync")
+			{
+				profile.IsAsync = false;
+				continue;
+			}
+			else if (argument == "--track-latency")
+			{
+				profile.IsLatencyTracked = true;
+				continue;
+			}
+			else if (argument == "--isolated-receivers")
+			{
+				profile.IsReceiverIsolated = true;
+				continue;
+			}
+			else if (argument == "--keep-logs")
+			{
+				profile.IsLogKept = true;
+				continue;
+			}
+			else if (!hasValue)
+			{
+				return false;
+			}
+			else if (argument == "--threads")
+			{
+				isValid = parseNumber(value, profile.ThreadCount) && profile.ThreadCount > 0;
+			}
+			else if (argument == "--duration-ms")
+			{
+				long long duration = 0;
+				isValid = parseNumber(value, duration) && duration > 0;
+				profile.Duration = std::chrono::milliseconds(duration);
+			}
+			else if (argument == "--severity-mix")
+			{
+				isValid = parseSeverityMix(value, profile.SeverityWeights);
+			}
+			else if (argument == "--severity-limit")
+			{
+				isValid = parseName(value, SEVERITY_NAMES, profile.SeverityLimit);
+			}
+			else if (argument == "--size-distribution")
+			{
+				isValid = parseName(value, SIZE_DISTRIBUTION_NAMES, profile.SizeDistribution);
+			}
+			else if (argument == "--message-size")
+			{
+				isValid = parseNumber(value, profile.MessageSize) && profile.MessageSize > 0;
+			}
+			else if (argument == "--min-message-size")
+			{
+				isValid = parseNumber(value, profile.MinMessageSize);
+			}
+			else if (argument == "--max-message-size")
+			{
+				isValid = parseNumber(value, profile.MaxMessageSize);
+			}
+			else if (argument == "--arrival")
+			{
+				isValid = parseName(value, ARRIVAL_NAMES, profile.Arrival);
+			}
+			else if (argument == "--rate")
+			{
+				isValid = parseNumber(value, profile.RatePerThread) && profile.RatePerThread > 0.0;
+			}
+			else if (argument == "--burst-size")
+			{
+				isValid = parseNumber(value, profile.BurstSize) && profile.BurstSize > 0;
+			}
+			else if (argument == "--queue-capacity")
+			{
+				isValid = parseNumber(value, profile.QueueCapacity) && profile.QueueCapacity > 0;
+			}
+			else if (argument == "--queue-mode")
+			{
+				isValid = parseName(value, QUEUE_MODE_NAMES, profile.QueueMode);
+			}
+			else if (argument == "--overflow")
+			{
+				isValid = parseName(value, OVERFLOW_NAMES, profile.Overflow);
+			}
+			else if (argument == "--buffer-size")
+			{
+				isValid = parseNumber(value, profile.BufferSize);
+			}
+			else if (argument == "--size-limit")
+			{
+				isValid = parseNumber(value, profile.SizeLimit) && profile.SizeLimit > 0;
+			}
+			else if (argument == "--slow-receivers")
+			{
+				isValid = parseNumber(value, profile.SlowReceiverCount) && profile.SlowReceiverCount >= 0;
+			}
+			else if (argument == "--receiver-delay-us")
+			{
+				long long delay = 0;
+				isValid = parseNumber(value, delay) && delay >= 0;
+				profile.ReceiverDelay = std::chrono::microseconds(delay);
+			}
+			else if (argument == "--seed")
+			{
+				isValid = parseNumber(value, profile.Seed);
+			}
+			else if (argument == "--log-path")
+			{
+				profile.LogPath = value;
+			}
+			else if (argument == "--output")
+			{
+				outputPath = value;
+			}
+			else
+			{
+				return false;
+			}
+
+			if (!isValid)
+			{
+				return false;
+			}
+			++i;
+		}
+
+		const bool hasWeight = std::any_of(profile.SeverityWeights.begin(), profile.SeverityWeights.end(), [](const double weight) { return weight > 0.0; });
+		return hasWeight && profile.MinMessageSize <= profile.MaxMessageSize;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	aether_cpplogger_loadgen::LoadProfile profile;
+	std::string outputPath;
+	if (!parseOptions(argc, argv, profile, outputPath))
+	{
+		printUsage();
+		return 1;
+	}
+	if (profile.LogPath.empty())
+	{
+		profile.LogPath = (std::filesystem::temp_directory_path() / "aether_cpplogger_loadgen").string();
+	}
+
+	std::ofstream outputFile;
+	if (!outputPath.empty())
+	{
+		outputFile.open(outputPath, std::ios::out | std::ios::trunc);
+		if (!outputFile.is_open())
+		{
+			std::fprintf(stderr, "Output file could not be opened: %s\n", outputPath.c_str());
+			return 1;
+		}
+	}
+	std::ostream& output = outputFile.is_open() ? outputFile : std::cout;
+
+	try
+	{
+		const auto& result = aether_cpplogger_loadgen::runLoad(profile);
+		aether_cpplogger_loadgen::writeSummary(std::cerr, result);
+		aether_cpplogger_loadgen::writeJsonReport(output, profile, result);
+		if (profile.IsLogKept)
+		{
+			std::fprintf(stderr, "log files kept in %s\n", result.LogPath.c_str());
+		}
+	}
+	catch (const std::exception& ex)
+	{
+		std::fprintf(stderr, "%s\n", ex.what());
+		return 1;
+	}
+
+	output.flush();
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,136 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "../aether_cpplogger/Logger.h"
+#include "../aether_cpplogger/BinaryLogReader.h"
+
+#include <chrono>
+#include <filesystem>
+#include <thread>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace aether_cpplogger_tests
+{
+	TEST_CLASS(BinaryLogTest)
+	{
+	private:
+		const std::string testLogPath = "BinaryLogTest";
+		const std::string testMessage = "This is a test";
+
+		/**
+		 * @brief Returns the path of the only binary log file of the test folder
+		*/
+		std::string binaryLogFilePath() const
+		{
+			for (const auto& entry : std::filesystem::directory_iterator(testLogPath))
+			{
+				if (entry.path().extension() == ".logb")
+				{
+					return entry.path().string();
+				}
+			}
+
+			return std::string();
+		}
+
+		TEST_METHOD_INITIALIZE(Setup)
+		{
+			aether_cpplogger::LoggerRegistry::clear();
+			if (std::filesystem::exists(testLogPath))
+			{
+				std::filesystem::remove_all(testLogPath);
+			}
+		}
+
+		TEST_METHOD(BinaryRoundTripTest)
+		{
+			const auto& logger = aether_cpplogger::LoggerRegistry::get("binary");
+			logger->init(testLogPath, false, aether_cpplogger::LogSeverity::TRACE, 1048576);
+			logger->setLogFileMode(aether_cpplogger::LogFileMode::BINARY);
+
+			AETHER_LOG_INFO_TO(*logger, "user {} took {}us", 42, 1.5);
+			AETHER_LOG_WARNING_TO(*logger, "name {} flag {} char {{{}}} from {}", std::string("alice"), true, 'x', "literal");
+			AETHER_LOG_DEBUG_TO(*logger, "value {}", -7); const int debugLine = __LINE__;
+			logger->logError(testMessage);
+			logger->shutdown();
+
+			const auto& path = binaryLogFilePath();
+			Assert::IsFalse(path.empty(), L"The binary log file should exist");
+			Assert::IsTrue(std::filesystem::exists(path + ".idx"), L"The index file should exist");
+
+			aether_cpplogger::BinaryLogReader reader(path);
+			aether_cpplogger::BinaryLogEntry entry;
+
+			Assert::IsTrue(reader.next(entry));
+			Assert::AreEqual(std::string("user 42 took 1.5us"), entry.Message);
+			Assert::IsTrue(entry.Severity == aether_cpplogger::LogSeverity::INFO, L"The severity is incorrect");
+
+			std::string line;
+			reader.formatLine(line, entry, aether_cpplogger::TimestampPrecision::SECONDS);
+			Assert::AreEqual(std::string("[INFO]\t\t"), line.substr(0, 8), L"The line should start with the severity prefix");
+			Assert::AreEqual(std::string("\t\tuser 42 took 1.5us"), line.substr(16), L"The line should have the text layout");
+
+			Assert::IsTrue(reader.next(entry));
+			Assert::AreEqual(std::string("name alice flag true char {x} from literal"), entry.Message);
+			Assert::IsTrue(entry.Severity == aether_cpplogger::LogSeverity::WARNING, L"The severity is incorrect");
+
+			Assert::IsTrue(reader.next(entry));
+			Assert::AreEqual(std::string("value -7\t\tSOURCE: ") + __FILE__ + "\t\tLINE: " + std::to_string(debugLine), entry.Message);
+
+			Assert::IsTrue(reader.next(entry));
+			Assert::AreEqual(testMessage, entry.Message);
+			Assert::IsTrue(entry.Severity == aether_cpplogger::LogSeverity::ERROR, L"The severity is incorrect");
+
+			Assert::IsFalse(reader.next(entry), L"There should be no more logs");
+
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(BinarySeekTest)
+		{
+			const auto& logger = aether_cpplogger::LoggerRegistry::get("binary");
+			logger->init(testLogPath, false, aether_cpplogger::LogSeverity::INFO, 16 * 1048576);
+			logger->setLogFileMode(aether_cpplogger::LogFileMode::BINARY);
+
+			//Enough logs for several checkpoint sections
+			const int logCount = 8000;
+			std::int64_t middle = 0;
+			for (int i = 0; i < logCount; ++i)
+			{
+				if (i == logCount / 2)
+				{
+					std::this_thread::sleep_for(std::chrono::milliseconds(2));
+					middle = aether_cpplogger::Clock::now();
+					std::this_thread::sleep_for(std::chrono::milliseconds(2));
+				}
+				AETHER_LOG_INFO_TO(*logger, "index {} {}", i, testMessage);
+			}
+			logger->shutdown();
+
+			aether_cpplogger::BinaryLogReader reader(binaryLogFilePath());
+			aether_cpplogger::BinaryLogEntry entry;
+
+			Assert::IsTrue(reader.seek(middle), L"The index file should be used");
+			Assert::IsTrue(reader.next(entry));
+			Assert::AreEqual("index " + std::to_string(logCount / 2) + " " + testMessage, entry.Message);
+
+			int count = 1;
+			while (reader.next(entry))
+			{
+				count += 1;
+			}
+			Assert::AreEqual(logCount / 2, count, L"Every log after the seek time should be read");
+
+			reader.seek(0);
+			count = 0;
+			while (reader.next(entry))
+			{
+				count += 1;
+			}
+			Assert::AreEqual(logCount, count, L"Every log should be read from the start");
+
+			std::filesystem::remove_all(testLogPath);
+		}
+	};
+}
\ No newline at end of file
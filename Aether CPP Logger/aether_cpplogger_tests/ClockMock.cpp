@@ -0,0 +1,10 @@
+#include "pch.h"
+#include "ClockMock.h"
+
+namespace aether_cpplogger_tests
+{
+	void ClockMock::setTimeSourcesTest(aether_cpplogger::Clock::TimeSource wallClock, aether_cpplogger::Clock::TimeSource monotonicClock)
+	{
+		aether_cpplogger::Clock::setTimeSources(wallClock, monotonicClock);
+	}
+}
\ No newline at end of file
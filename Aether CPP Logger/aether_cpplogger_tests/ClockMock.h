@@ -0,0 +1,11 @@
+#pragma once
+#include "../aether_cpplogger/TimestampCache.h"
+
+namespace aether_cpplogger_tests
+{
+	class ClockMock : public aether_cpplogger::Clock
+	{
+	public:
+		static void setTimeSourcesTest(aether_cpplogger::Clock::TimeSource wallClock, aether_cpplogger::Clock::TimeSource monotonicClock);
+	};
+}
\ No newline at end of file
@@ -0,0 +1,224 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "ReceiverMock.h"
+#include "../aether_cpplogger/Logger.h"
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace aether_cpplogger_tests
+{
+	TEST_CLASS(FlightRecorderTest)
+	{
+	private:
+		const std::string testLogPath = "FlightRecorderTest";
+
+		std::string readDump() const
+		{
+			std::ifstream dumpFile(std::filesystem::path(testLogPath) / "flight_recorder.log", std::ios::in | std::ios::binary);
+			std::stringstream content;
+			content << dumpFile.rdbuf();
+			return content.str();
+		}
+
+		static int countOf(const std::string& text, const std::string& part)
+		{
+			int count = 0;
+			for (auto position = text.find(part); position != std::string::npos; position = text.find(part, position + part.size()))
+			{
+				++count;
+			}
+			return count;
+		}
+
+		TEST_METHOD_INITIALIZE(Setup)
+		{
+			aether_cpplogger::LoggerRegistry::clear();
+			if (std::filesystem::exists(testLogPath))
+			{
+				std::filesystem::remove_all(testLogPath);
+			}
+		}
+
+		TEST_METHOD(DumpOnErrorTest)
+		{
+			BlockingReceiverMock receiverMock;
+			receiverMock.release();
+
+			aether_cpplogger::FlightRecorderPolicy flightRecorderPolicy;
+			flightRecorderPolicy.IsEnabled = true;
+			flightRecorderPolicy.IsDumpedOnSignal = false;
+
+			const auto& logger = aether_cpplogger::LoggerRegistry::get("flight");
+			logger->init(testLogPath, false, aether_cpplogger::LogSeverity::ERROR, 1048576);
+			logger->setFlightRecorderPolicy(flightRecorderPolicy);
+			logger->addReceiver(&receiverMock);
+
+			//The TRACE logs pass the macros for the recorder, but the severity limit keeps them out of the outputs
+			for (int i = 0; i < 3; ++i)
+			{
+				AETHER_LOG_TRACE_TO(*logger, "step {}", i);
+			}
+			AETHER_LOG_DEBUG_FIELDS_TO(*logger, "request", { "id", 7 });
+			Assert::AreEqual(0, receiverMock.receivedCount(), L"The recorded logs over the severity limit should not be written");
+
+			logger->logError("request failed");
+			Assert::AreEqual(1, receiverMock.receivedCount(), L"The ERROR log should be written");
+
+			auto dump = readDump();
+			Assert::AreEqual(1, countOf(dump, "=== Flight recorder dump (ERROR) ==="), L"The ERROR log should trigger a dump");
+			Assert::AreNotEqual(std::string::npos, dump.find("[TRACE]\t\tstep 0"), L"The dump should contain the discarded TRACE logs");
+			Assert::AreNotEqual(std::string::npos, dump.find("[TRACE]\t\tstep 2"), L"The dump should contain the latest TRACE log");
+			Assert::AreNotEqual(std::string::npos, dump.find("id=7"), L"The fields should be recorded in logfmt form");
+			Assert::IsTrue(dump.find("step 2") < dump.find("request failed"), L"The records should be dumped in the order of the logs");
+
+			//The next dump only contains the new records
+			AETHER_LOG_TRACE_TO(*logger, "retry");
+			logger->logError("request failed again");
+			dump = readDump();
+			Assert::AreEqual(2, countOf(dump, "=== Flight recorder dump (ERROR) ==="), L"The second ERROR log should append a dump");
+			Assert::AreEqual(1, countOf(dump, "step 0"), L"The dumped records should not be dumped again");
+			Assert::AreEqual(1, countOf(dump, "retry"), L"The new records should be dumped");
+
+			logger->shutdown();
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(RingPerThreadTest)
+		{
+			aether_cpplogger::FlightRecorderPolicy flightRecorderPolicy;
+			flightRecorderPolicy.IsEnabled = true;
+			flightRecorderPolicy.Severity = aether_cpplogger::LogSeverity::DEBUG;
+			flightRecorderPolicy.RecordsPerThread = 4;
+			flightRecorderPolicy.MaxRecordSize = 16;
+			flightRecorderPolicy.IsDumpedOnError = false;
+			flightRecorderPolicy.IsDumpedOnSignal = false;
+
+			std::filesystem::create_directories(testLogPath);
+			const auto& logger = aether_cpplogger::LoggerRegistry::get("flight");
+			logger->init(testLogPath, false, aether_cpplogger::LogSeverity::ERROR, 1048576);
+			logger->setFlightRecorderPolicy(flightRecorderPolicy);
+
+			//Each thread overwrites the oldest records of its own ring
+			for (int i = 0; i < 10; ++i)
+			{
+				AETHER_LOG_DEBUG_TO(*logger, "main {}", i);
+			}
+			std::thread worker([&logger]()
+				{
+					AETHER_LOG_DEBUG_TO(*logger, "worker");
+				});
+			worker.join();
+
+			AETHER_LOG_TRACE_TO(*logger, "not recorded");
+			logger->logError("this message is longer than sixteen bytes");
+			Assert::IsTrue(readDump().empty(), L"The ERROR log should not trigger a dump if it is disabled");
+
+			logger->dumpFlightRecorder();
+			const auto& dump = readDump();
+			Assert::AreEqual(2, countOf(dump, "--- Thread "), L"Every thread should have a ring of its own");
+			Assert::AreEqual(std::string::npos, dump.find("main 6"), L"The oldest records should be overwritten");
+			Assert::AreNotEqual(std::string::npos, dump.find("main 7"), L"The latest records of the thread should be kept");
+			Assert::AreNotEqual(std::string::npos, dump.find("worker"), L"The records of the exited thread should be kept");
+			Assert::AreEqual(std::string::npos, dump.find("not recorded"), L"The logs over the severity of the recorder should not be recorded");
+			Assert::AreNotEqual(std::string::npos, dump.find("this message is \n"), L"The long messages should be truncated");
+
+			logger->shutdown();
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(ReusedRingAttributionTest)
+		{
+			aether_cpplogger::FlightRecorderPolicy flightRecorderPolicy;
+			flightRecorderPolicy.IsEnabled = true;
+			flightRecorderPolicy.Severity = aether_cpplogger::LogSeverity::DEBUG;
+			flightRecorderPolicy.IsDumpedOnSignal = false;
+
+			std::filesystem::create_directories(testLogPath);
+			const auto& logger = aether_cpplogger::LoggerRegistry::get("flight");
+			logger->init(testLogPath, false, aether_cpplogger::LogSeverity::ERROR, 1048576);
+			logger->setFlightRecorderPolicy(flightRecorderPolicy);
+
+			//The second thread reuses the ring of the exited first thread, which still holds its undumped records
+			std::thread([&logger]() { AETHER_LOG_DEBUG_TO(*logger, "made by the first thread"); }).join();
+			std::thread([&logger]()
+				{
+					AETHER_LOG_DEBUG_TO(*logger, "made by the second thread");
+					logger->logError("failure of the second thread");
+				}).join();
+
+			const auto& dump = readDump();
+			const auto firstHeader = dump.find("--- Thread 1 ---");
+			const auto secondHeader = dump.find("--- Thread 2 ---");
+			Assert::AreEqual(2, countOf(dump, "--- Thread "), L"Each thread should get a header of its own");
+			Assert::AreNotEqual(std::string::npos, firstHeader, L"The records of the exited thread should keep its number");
+			Assert::AreNotEqual(std::string::npos, secondHeader, L"The records of the reusing thread should get its number");
+			Assert::IsTrue(firstHeader < dump.find("made by the first thread") && dump.find("made by the first thread") < secondHeader,
+				L"The record of the exited thread should be under its header");
+			Assert::IsTrue(secondHeader < dump.find("made by the second thread") && secondHeader < dump.find("failure of the second thread"),
+				L"The records of the reusing thread should be under its header");
+
+			logger->shutdown();
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(PolicyChangeWhileLoggingTest)
+		{
+			aether_cpplogger::FlightRecorderPolicy flightRecorderPolicy;
+			flightRecorderPolicy.IsEnabled = true;
+			flightRecorderPolicy.Severity = aether_cpplogger::LogSeverity::DEBUG;
+			flightRecorderPolicy.IsDumpedOnSignal = false;
+
+			std::filesystem::create_directories(testLogPath);
+			const auto& logger = aether_cpplogger::LoggerRegistry::get("flight");
+			logger->init(testLogPath, false, aether_cpplogger::LogSeverity::ERROR, 1048576);
+			logger->setFlightRecorderPolicy(flightRecorderPolicy);
+
+			//The replaced recorders are destroyed while the threads record into them and dump them
+			std::atomic<bool> isLogging{ true };
+			std::vector<std::thread> threads;
+			for (int i = 0; i < 4; ++i)
+			{
+				threads.emplace_back([&logger, &isLogging, i]()
+					{
+						for (int j = 0; isLogging.load(); ++j)
+						{
+							AETHER_LOG_DEBUG_TO(*logger, "thread {} log {}", i, j);
+							if (j % 64 == 0)
+							{
+								logger->dumpFlightRecorder();
+							}
+						}
+					});
+			}
+
+			for (int i = 0; i < 50; ++i)
+			{
+				flightRecorderPolicy.IsEnabled = i % 5 != 4;
+				flightRecorderPolicy.IsDumpedOnError = i % 2 == 0;
+				logger->setFlightRecorderPolicy(flightRecorderPolicy);
+			}
+			isLogging.store(false);
+			for (auto& thread : threads)
+			{
+				thread.join();
+			}
+
+			flightRecorderPolicy.IsEnabled = true;
+			logger->setFlightRecorderPolicy(flightRecorderPolicy);
+			AETHER_LOG_DEBUG_TO(*logger, "after the changes");
+			logger->dumpFlightRecorder();
+			Assert::AreNotEqual(std::string::npos, readDump().find("after the changes"), L"The last recorder should keep recording");
+
+			logger->shutdown();
+			std::filesystem::remove_all(testLogPath);
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,181 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "../aether_cpplogger/Logger.h"
+#include "../aether_cpplogger/TimestampCache.h"
+
+#include <filesystem>
+#include <fstream>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace aether_cpplogger_tests
+{
+	TEST_CLASS(LogRetentionTest)
+	{
+	private:
+		const std::string testLogPath = "LogRetentionTest";
+		const std::string testMessage = "This is a test";
+
+		/**
+		 * @brief Creates a file of the given size in the test folder
+		*/
+		void createFile(const std::string& filename, const std::size_t size) const
+		{
+			std::ofstream outFile(std::filesystem::path(testLogPath) / filename, std::ios::out | std::ios::binary);
+			outFile << std::string(size, 'x');
+		}
+
+		bool fileExists(const std::string& filename) const
+		{
+			return std::filesystem::exists(std::filesystem::path(testLogPath) / filename);
+		}
+
+		int fileCount() const
+		{
+			int count = 0;
+			for (const auto& entry : std::filesystem::directory_iterator(testLogPath))
+			{
+				count += entry.is_regular_file() ? 1 : 0;
+			}
+			return count;
+		}
+
+		TEST_METHOD_INITIALIZE(Setup)
+		{
+			aether_cpplogger::LoggerRegistry::clear();
+			if (std::filesystem::exists(testLogPath))
+			{
+				std::filesystem::remove_all(testLogPath);
+			}
+			std::filesystem::create_directories(testLogPath);
+		}
+
+		TEST_METHOD(MaxFileCountTest)
+		{
+			createFile("2000-01-01.log", 10);
+			createFile("2000-01-01_2.log", 10);
+			createFile("2000-01-01_10.log", 10);
+			createFile("2000-01-02.log.gz", 10);
+			createFile("2000-01-03.logb", 10);
+			createFile("2000-01-03.logb.idx", 10);
+			createFile("notes.txt", 10);
+
+			aether_cpplogger::RetentionPolicy retentionPolicy;
+			retentionPolicy.IsEnabled = true;
+			retentionPolicy.MaxFileCount = 2;
+
+			const auto& logger = aether_cpplogger::LoggerRegistry::get("retention");
+			logger->init(testLogPath, false, aether_cpplogger::LogSeverity::TRACE, 1048576);
+			logger->setRetentionPolicy(retentionPolicy);
+			logger->logInfo(testMessage);
+			logger->shutdown();
+
+			//The files are ordered by date and index, the index is compared as a number
+			Assert::IsFalse(fileExists("2000-01-01.log"), L"The oldest file should be deleted");
+			Assert::IsFalse(fileExists("2000-01-01_2.log"), L"The second oldest file should be deleted");
+			Assert::IsFalse(fileExists("2000-01-01_10.log"), L"The third oldest file should be deleted");
+			Assert::IsTrue(fileExists("2000-01-02.log.gz"), L"The compressed file should be kept");
+			Assert::IsTrue(fileExists("2000-01-03.logb"), L"The newest file should be kept");
+			Assert::IsTrue(fileExists("2000-01-03.logb.idx"), L"The index file should be kept with its log file");
+			Assert::IsTrue(fileExists("notes.txt"), L"Other files should not be touched");
+
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(MaxTotalSizeTest)
+		{
+			createFile("2000-01-01.log", 100);
+			createFile("2000-01-02.log", 100);
+			createFile("2000-01-03.logb", 60);
+			createFile("2000-01-03.logb.idx", 40);
+			createFile("2000-01-04.log", 100);
+
+			aether_cpplogger::RetentionPolicy retentionPolicy;
+			retentionPolicy.IsEnabled = true;
+			retentionPolicy.MaxTotalSize = 250;
+
+			const auto& logger = aether_cpplogger::LoggerRegistry::get("retention");
+			logger->init(testLogPath, false, aether_cpplogger::LogSeverity::TRACE, 1048576);
+			logger->setRetentionPolicy(retentionPolicy);
+			logger->logInfo(testMessage);
+			logger->shutdown();
+
+			//The binary log file and its index file count as one entry of 100 bytes
+			Assert::IsFalse(fileExists("2000-01-01.log"), L"The oldest file should be deleted");
+			Assert::IsFalse(fileExists("2000-01-02.log"), L"The second oldest file should be deleted");
+			Assert::IsTrue(fileExists("2000-01-03.logb"), L"The files within the size limit should be kept");
+			Assert::IsTrue(fileExists("2000-01-04.log"), L"The newest file should be kept");
+
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(MaxAgeTest)
+		{
+			const auto& today = aether_cpplogger::Clock::toDateTime(aether_cpplogger::Clock::now()).currentDateString();
+			createFile("2000-01-01.log", 10);
+			createFile("2000-01-02_3.log", 10);
+			createFile(today + "_8.log", 10);
+			createFile(today + "_9.log", 10);
+
+			aether_cpplogger::RetentionPolicy retentionPolicy;
+			retentionPolicy.IsEnabled = true;
+			retentionPolicy.MaxAge = std::chrono::hours(24);
+
+			const auto& logger = aether_cpplogger::LoggerRegistry::get("retention");
+			logger->init(testLogPath, false, aether_cpplogger::LogSeverity::TRACE, 1048576);
+			logger->setRetentionPolicy(retentionPolicy);
+			logger->logInfo(testMessage);
+			logger->shutdown();
+
+			Assert::IsFalse(fileExists("2000-01-01.log"), L"The expired file should be deleted");
+			Assert::IsFalse(fileExists("2000-01-02_3.log"), L"The expired file should be deleted");
+			Assert::IsTrue(fileExists(today + "_8.log"), L"The file of today should be kept");
+			Assert::IsTrue(fileExists(today + "_9.log"), L"The continued log file should be kept");
+
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(RotationTest)
+		{
+			aether_cpplogger::RetentionPolicy retentionPolicy;
+			retentionPolicy.IsEnabled = true;
+			retentionPolicy.MaxFileCount = 2;
+
+			//Every log fills a log file, so each log rotates to the next file
+			const auto& logger = aether_cpplogger::LoggerRegistry::get("retention");
+			logger->init(testLogPath, false, aether_cpplogger::LogSeverity::TRACE, 10);
+			logger->setRetentionPolicy(retentionPolicy);
+			for (int i = 0; i < 10; ++i)
+			{
+				logger->logInfo(testMessage);
+			}
+
+			//The two completed files and the open file are kept
+			const auto& today = aether_cpplogger::Clock::toDateTime(aether_cpplogger::Clock::now()).currentDateString();
+			Assert::AreEqual(3, fileCount(), L"Only the newest completed files should be kept");
+			Assert::IsTrue(fileExists(today + "_10.log"), L"The open log file should be kept");
+			Assert::IsTrue(fileExists(today + "_9.log"), L"The newest completed file should be kept");
+			Assert::IsFalse(fileExists(today + "_7.log"), L"The older completed files should be deleted");
+
+			//The file closed by a mode change is counted when the next file is opened
+			logger->setLogFileMode(aether_cpplogger::LogFileMode::BINARY);
+			logger->logInfo(testMessage);
+			logger->shutdown();
+
+			Assert::AreEqual(4, fileCount(), L"The two completed files and the binary log file with its index file should be kept");
+			Assert::IsFalse(fileExists(today + "_8.log"), L"The oldest completed file should be deleted");
+			Assert::IsTrue(fileExists(today + "_10.log"), L"The closed log file should be kept as completed file");
+
+			//The numbering continues after the deleted files when the text log files are looked up again
+			logger->setLogFileMode(aether_cpplogger::LogFileMode::BUFFERED);
+			logger->logInfo(testMessage);
+			logger->shutdown();
+
+			Assert::IsTrue(fileExists(today + "_11.log"), L"The next log file should follow the highest index");
+			Assert::IsFalse(fileExists(today + ".log"), L"The index of a deleted file should not be reused");
+
+			std::filesystem::remove_all(testLogPath);
+		}
+	};
+}
\ No newline at end of file
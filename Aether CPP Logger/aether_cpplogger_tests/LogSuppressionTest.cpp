@@ -0,0 +1,235 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "ReceiverMock.h"
+#include "../aether_cpplogger/Logger.h"
+
+#include <chrono>
+#include <filesystem>
+#include <limits>
+#include <thread>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace aether_cpplogger_tests
+{
+	TEST_CLASS(LogSuppressionTest)
+	{
+	private:
+		const std::string testLogPath = "LogSuppressionTest";
+
+		TEST_METHOD_INITIALIZE(Setup)
+		{
+			aether_cpplogger::LoggerRegistry::clear();
+			if (std::filesystem::exists(testLogPath))
+			{
+				std::filesystem::remove_all(testLogPath);
+			}
+		}
+
+		TEST_METHOD(RateLimitTest)
+		{
+			BlockingReceiverMock receiverMock;
+			receiverMock.release();
+
+			aether_cpplogger::RateLimitPolicy rateLimitPolicy;
+			rateLimitPolicy.IsEnabled = true;
+			rateLimitPolicy.LogsPerSecond = 0.001;
+			rateLimitPolicy.Burst = 3;
+
+			const auto& logger = aether_cpplogger::LoggerRegistry::get("suppression");
+			logger->init(testLogPath, false, aether_cpplogger::LogSeverity::TRACE, 1048576);
+			logger->setRateLimitPolicy(rateLimitPolicy);
+			logger->addReceiver(&receiverMock);
+
+			//A storm of a single call site only passes the burst
+			int evaluatedCount = 0;
+			for (int i = 0; i < 10; ++i)
+			{
+				AETHER_LOG_ERROR_TO(*logger, "storm {}", ++evaluatedCount);
+			}
+			Assert::AreEqual(3, receiverMock.receivedCount(), L"Only the burst of the call site should be logged");
+			Assert::AreEqual(3, evaluatedCount, L"The arguments of the skipped logs should not be evaluated");
+			Assert::AreEqual(std::uint64_t(7), logger->rateLimitedRecords(), L"The skipped logs should be counted");
+
+			//Every call site has its own bucket
+			AETHER_LOG_ERROR_TO(*logger, "other call site");
+			Assert::AreEqual(4, receiverMock.receivedCount(), L"Another call site should not be limited");
+
+			logger->shutdown();
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(RateLimitRefillTest)
+		{
+			BlockingReceiverMock receiverMock;
+			receiverMock.release();
+
+			aether_cpplogger::RateLimitPolicy rateLimitPolicy;
+			rateLimitPolicy.IsEnabled = true;
+			rateLimitPolicy.LogsPerSecond = 5;
+			rateLimitPolicy.Burst = 1;
+
+			const auto& logger = aether_cpplogger::LoggerRegistry::get("suppression");
+			logger->init(testLogPath, false, aether_cpplogger::LogSeverity::TRACE, 1048576);
+			logger->setRateLimitPolicy(rateLimitPolicy);
+			logger->addReceiver(&receiverMock);
+
+			//The bucket gets a token after 200ms
+			for (int i = 0; i < 3; ++i)
+			{
+				AETHER_LOG_WARNING_TO(*logger, "storm");
+				if (i == 1)
+				{
+					std::this_thread::sleep_for(std::chrono::milliseconds(250));
+				}
+			}
+
+			const std::vector<std::string> expectedMessages = { "storm", "Rate limit skipped 1 logs of the next call site", "storm" };
+			const auto& messages = receiverMock.messages();
+			Assert::AreEqual(expectedMessages.size(), messages.size(), L"The call site should be allowed again after the refill");
+			for (std::size_t i = 0; i < expectedMessages.size(); ++i)
+			{
+				Assert::AreEqual(expectedMessages[i], messages[i], L"The skipped logs should be reported before the next log");
+			}
+
+			logger->shutdown();
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(SamplingIntervalTest)
+		{
+			BlockingReceiverMock receiverMock;
+			receiverMock.release();
+
+			aether_cpplogger::SamplingPolicy samplingPolicy;
+			samplingPolicy.IsEnabled = true;
+			samplingPolicy.Interval = 10;
+
+			const auto& logger = aether_cpplogger::LoggerRegistry::get("suppression");
+			logger->init(testLogPath, false, aether_cpplogger::LogSeverity::TRACE, 1048576);
+			logger->setSamplingPolicy(aether_cpplogger::LogSeverity::TRACE, samplingPolicy);
+			logger->addReceiver(&receiverMock);
+
+			//Every 10th log of the call site is kept, the arguments of the others are not evaluated
+			int evaluatedCount = 0;
+			for (int i = 0; i < 100; ++i)
+			{
+				AETHER_LOG_TRACE_TO(*logger, "sampled {}", ++evaluatedCount);
+			}
+			Assert::AreEqual(10, receiverMock.receivedCount(), L"Every 10th log should be kept");
+			Assert::AreEqual(10, evaluatedCount, L"The arguments of the logs which are not kept should not be evaluated");
+
+			//The other severities are not sampled
+			for (int i = 0; i < 10; ++i)
+			{
+				AETHER_LOG_DEBUG_TO(*logger, "not sampled");
+			}
+			Assert::AreEqual(20, receiverMock.receivedCount(), L"Only the sampled severity should be affected");
+
+			logger->setSamplingPolicy(aether_cpplogger::LogSeverity::TRACE, aether_cpplogger::SamplingPolicy());
+			AETHER_LOG_TRACE_TO(*logger, "sampled {}", ++evaluatedCount);
+			Assert::AreEqual(21, receiverMock.receivedCount(), L"A disabled sampling should keep every log");
+
+			logger->shutdown();
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(SamplingProbabilityTest)
+		{
+			BlockingReceiverMock receiverMock;
+			receiverMock.release();
+
+			aether_cpplogger::SamplingPolicy samplingPolicy;
+			samplingPolicy.IsEnabled = true;
+			samplingPolicy.Probability = 0.0;
+
+			const auto& logger = aether_cpplogger::LoggerRegistry::get("suppression");
+			logger->init(testLogPath, false, aether_cpplogger::LogSeverity::TRACE, 1048576);
+			logger->setSamplingPolicy(aether_cpplogger::LogSeverity::DEBUG, samplingPolicy);
+			logger->addReceiver(&receiverMock);
+
+			for (int i = 0; i < 1000; ++i)
+			{
+				AETHER_LOG_DEBUG_TO(*logger, "never kept");
+			}
+			Assert::AreEqual(0, receiverMock.receivedCount(), L"No log should be kept with 0 probability");
+
+			//The bounds are more than 10 standard deviations away from the expected 2500 logs
+			samplingPolicy.Probability = 0.25;
+			logger->setSamplingPolicy(aether_cpplogger::LogSeverity::DEBUG, samplingPolicy);
+			for (int i = 0; i < 10000; ++i)
+			{
+				AETHER_LOG_DEBUG_TO(*logger, "sometimes kept");
+			}
+			Assert::IsTrue(receiverMock.receivedCount() > 2000 && receiverMock.receivedCount() < 3000, L"About a quarter of the logs should be kept");
+
+			//The probability is clamped and NaN keeps every log
+			const int keptCount = receiverMock.receivedCount();
+			samplingPolicy.Probability = std::numeric_limits<double>::quiet_NaN();
+			logger->setSamplingPolicy(aether_cpplogger::LogSeverity::DEBUG, samplingPolicy);
+			for (int i = 0; i < 100; ++i)
+			{
+				AETHER_LOG_DEBUG_TO(*logger, "always kept");
+			}
+			Assert::AreEqual(keptCount + 100, receiverMock.receivedCount(), L"Every log should be kept with NaN probability");
+
+			samplingPolicy.Probability = -0.5;
+			logger->setSamplingPolicy(aether_cpplogger::LogSeverity::DEBUG, samplingPolicy);
+			AETHER_LOG_DEBUG_TO(*logger, "never kept");
+			samplingPolicy.Probability = 2.0;
+			logger->setSamplingPolicy(aether_cpplogger::LogSeverity::DEBUG, samplingPolicy);
+			AETHER_LOG_DEBUG_TO(*logger, "always kept");
+			Assert::AreEqual(keptCount + 101, receiverMock.receivedCount(), L"The probability should be clamped to [0, 1]");
+
+			logger->shutdown();
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(DuplicateSuppressionTest)
+		{
+			BlockingReceiverMock receiverMock;
+			receiverMock.release();
+
+			const auto& logger = aether_cpplogger::LoggerRegistry::get("suppression");
+			logger->init(testLogPath, false, aether_cpplogger::LogSeverity::TRACE, 1048576);
+			logger->setDuplicateSuppression(true);
+			logger->addReceiver(&receiverMock);
+
+			for (int i = 0; i < 5; ++i)
+			{
+				logger->logError("connection refused");
+			}
+			//Same message with another severity
+			logger->logWarning("connection refused");
+			for (int i = 0; i < 3; ++i)
+			{
+				AETHER_LOG_INFO_TO(*logger, "retry {} of {}", 1, 3);
+			}
+			AETHER_LOG_INFO_TO(*logger, "retry {} of {}", 2, 3);
+			AETHER_LOG_INFO_TO(*logger, "retry {} of {}", 2, 3);
+			logger->flush();
+
+			const std::vector<std::string> expectedMessages =
+			{
+				"connection refused",
+				"Last message repeated 4 times",
+				"connection refused",
+				"retry 1 of 3",
+				"Last message repeated 2 times",
+				"retry 2 of 3",
+				"Last message repeated 1 times"
+			};
+			const auto& messages = receiverMock.messages();
+			Assert::AreEqual(expectedMessages.size(), messages.size(), L"The repeats should be collapsed");
+			for (std::size_t i = 0; i < expectedMessages.size(); ++i)
+			{
+				Assert::AreEqual(expectedMessages[i], messages[i], L"The repeat count should follow the repeated log");
+			}
+			Assert::AreEqual(std::uint64_t(7), logger->suppressedDuplicates(), L"The skipped repeats should be counted");
+
+			logger->shutdown();
+			std::filesystem::remove_all(testLogPath);
+		}
+	};
+}
\ No newline at end of file
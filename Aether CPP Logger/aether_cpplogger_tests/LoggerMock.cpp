@@ -23,9 +23,9 @@ namespace aether_cpplogger_tests
 		return aether_cpplogger::Logger::writeLogToConsole(message);
 	}
 
-	void LoggerMock::writeLogToFileTest(std::string_view message, const aether_cpplogger::Logger::DateTime& dateTime)
+	void LoggerMock::writeLogToFileTest(std::string_view message, const aether_cpplogger::Logger::DateTime& dateTime, const aether_cpplogger::LogSeverity severity)
 	{
-		return aether_cpplogger::Logger::writeLogToFile(message, dateTime);
+		return aether_cpplogger::Logger::writeLogToFile(message, dateTime, severity);
 	}
 
 	void LoggerMock::notifyReceiversTest(std::string_view message)
@@ -1,5 +1,5 @@
 #pragma once
-#include "..\aether_cpplogger\Logger.h"
+#include "../aether_cpplogger/Logger.h"
 
 namespace aether_cpplogger_tests
 {
@@ -12,7 +12,7 @@ namespace aether_cpplogger_tests
 		static std::string createMessageTimePrefixTest(const aether_cpplogger::Logger::DateTime& dateTime);
 
 		static void writeLogToConsoleTest(std::string_view message);
-		static void writeLogToFileTest(std::string_view message, const aether_cpplogger::Logger::DateTime& dateTime);
+		static void writeLogToFileTest(std::string_view message, const aether_cpplogger::Logger::DateTime& dateTime, const aether_cpplogger::LogSeverity severity = aether_cpplogger::LogSeverity::INFO);
 		static void notifyReceiversTest(std::string_view message);
 
 		static aether_cpplogger::Logger::DateTime currentDateTimeTest();
@@ -0,0 +1,106 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "ReceiverMock.h"
+#include "../aether_cpplogger/Logger.h"
+
+#include <filesystem>
+#include <thread>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace aether_cpplogger_tests
+{
+	TEST_CLASS(LoggerRegistryTest)
+	{
+	private:
+		const std::string testLogPath = "LoggerRegistryTest";
+		const std::string testMessage = "This is a test";
+
+		TEST_METHOD_INITIALIZE(Setup)
+		{
+			aether_cpplogger::LoggerRegistry::clear();
+		}
+
+		TEST_METHOD(RegistryLookupTest)
+		{
+			const auto& networkLogger = aether_cpplogger::LoggerRegistry::get("network");
+			Assert::IsTrue(networkLogger == aether_cpplogger::LoggerRegistry::get("network"), L"The same name should return the same logger");
+			Assert::IsTrue(networkLogger == aether_cpplogger::LoggerRegistry::find("network"), L"The created logger should be found");
+			Assert::AreEqual(std::string("network"), networkLogger->name());
+
+			Assert::IsTrue(aether_cpplogger::LoggerRegistry::find("storage") == nullptr, L"Missing loggers should not be created by find");
+
+			Assert::IsTrue(aether_cpplogger::LoggerRegistry::remove("network"));
+			Assert::IsFalse(aether_cpplogger::LoggerRegistry::remove("network"));
+			Assert::IsTrue(aether_cpplogger::LoggerRegistry::find("network") == nullptr, L"The removed logger should not be found");
+		}
+
+		TEST_METHOD(IndependentLoggersTest)
+		{
+			std::filesystem::remove_all(testLogPath);
+
+			ReceiverMock networkReceiver;
+			ReceiverMock storageReceiver;
+
+			const auto& networkLogger = aether_cpplogger::LoggerRegistry::get("network");
+			networkLogger->init(testLogPath + "/network", false, aether_cpplogger::LogSeverity::INFO, 1048576);
+			networkLogger->addReceiver(&networkReceiver);
+
+			const auto& storageLogger = aether_cpplogger::LoggerRegistry::get("storage");
+			storageLogger->init(testLogPath + "/storage", false, aether_cpplogger::LogSeverity::DEBUG, 1048576);
+			storageLogger->addReceiver(&storageReceiver);
+
+			AETHER_LOG_INFO_TO(*networkLogger, "connected to {}", 42);
+			AETHER_LOG_DEBUG_TO(*networkLogger, testMessage);
+			AETHER_LOG_DEBUG_TO(*storageLogger, testMessage);
+
+			Assert::AreEqual(std::string("connected to 42"), networkReceiver.testMessage(), L"DEBUG logs should be discarded by the network logger");
+			Assert::IsTrue(storageReceiver.testMessage().rfind(testMessage, 0) == 0, L"DEBUG logs should reach the storage receiver");
+
+			Assert::IsTrue(std::filesystem::exists(testLogPath + "/network"), L"The network logger should write to its own folder");
+			Assert::IsTrue(std::filesystem::exists(testLogPath + "/storage"), L"The storage logger should write to its own folder");
+
+			aether_cpplogger::LoggerRegistry::clear();
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(ConcurrentConfigurationTest)
+		{
+			std::filesystem::remove_all(testLogPath);
+
+			ReceiverMock receiverMock;
+			const auto& logger = aether_cpplogger::LoggerRegistry::get("concurrent");
+			logger->init(testLogPath, false, aether_cpplogger::LogSeverity::INFO, 1048576);
+
+			//Reconfigure the logger while other threads log with it
+			std::vector<std::thread> threads;
+			for (int i = 0; i < 4; ++i)
+			{
+				threads.emplace_back([&logger]()
+					{
+						for (int j = 0; j < 200; ++j)
+						{
+							AETHER_LOG_INFO_TO(*logger, "log {}", j);
+						}
+					});
+			}
+
+			for (int i = 0; i < 50; ++i)
+			{
+				logger->addReceiver(&receiverMock);
+				logger->init(testLogPath, false, i % 2 == 0 ? aether_cpplogger::LogSeverity::INFO : aether_cpplogger::LogSeverity::ERROR, 1048576);
+				logger->removeReceiver(&receiverMock);
+			}
+
+			for (auto& thread : threads)
+			{
+				thread.join();
+			}
+
+			aether_cpplogger::LoggerRegistry::clear();
+			std::filesystem::remove_all(testLogPath);
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,336 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "ReceiverMock.h"
+#include "../aether_cpplogger/Logger.h"
+
+#include <chrono>
+#include <filesystem>
+#include <thread>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace aether_cpplogger_tests
+{
+	TEST_CLASS(LoggerStatsTest)
+	{
+	private:
+		const std::string testLogPath = "LoggerStatsTest";
+
+		TEST_METHOD_INITIALIZE(Setup)
+		{
+			aether_cpplogger::LoggerRegistry::clear();
+			if (std::filesystem::exists(testLogPath))
+			{
+				std::filesystem::remove_all(testLogPath);
+			}
+		}
+
+		TEST_METHOD(LatencyHistogramTest)
+		{
+			aether_cpplogger::LatencyHistogram histogram;
+			Assert::AreEqual(std::int64_t(0), histogram.percentile(0.99).count(), L"An empty histogram should report zero");
+
+			for (std::uint64_t value = 1; value <= 1000; ++value)
+			{
+				histogram.record(value);
+			}
+			Assert::AreEqual(std::uint64_t(1000), histogram.count(), L"Every value should be counted");
+			Assert::AreEqual(std::int64_t(500), histogram.mean().count(), L"The mean should be exact");
+			Assert::AreEqual(std::int64_t(1000), histogram.max().count(), L"The maximum should be exact");
+			Assert::AreEqual(std::int64_t(1000), histogram.percentile(1.0).count(), L"The 100th percentile should not exceed the maximum");
+
+			const auto median = histogram.percentile(0.5).count();
+			Assert::IsTrue(median >= 500 && median <= 532, L"The median should be within the bucket precision");
+			const auto p99 = histogram.percentile(0.99).count();
+			Assert::IsTrue(p99 >= 990 && p99 <= 1000, L"The 99th percentile should be within the bucket precision");
+
+			//Every value falls into the bucket whose bounds contain it
+			for (std::uint64_t value = 0; value < 100000; value += 7)
+			{
+				const auto bucket = aether_cpplogger::LatencyHistogram::bucketIndex(value);
+				Assert::IsTrue(aether_cpplogger::LatencyHistogram::bucketLowerBound(bucket) <= value &&
+					value <= aether_cpplogger::LatencyHistogram::bucketUpperBound(bucket), L"The bucket should contain the value");
+			}
+			Assert::AreEqual(aether_cpplogger::LatencyHistogram::BUCKET_COUNT - 1, aether_cpplogger::LatencyHistogram::bucketIndex(UINT64_MAX),
+				L"The largest values should share the last bucket");
+
+			aether_cpplogger::LatencyHistogram other;
+			other.record(5000);
+			histogram.merge(other);
+			Assert::AreEqual(std::uint64_t(1001), histogram.count(), L"The merged values should be counted");
+			Assert::AreEqual(std::int64_t(5000), histogram.max().count(), L"The merged maximum should be kept");
+		}
+
+		TEST_METHOD(CountersTest)
+		{
+			const auto& logger = aether_cpplogger::LoggerRegistry::get("stats");
+			logger->init(testLogPath, false, aether_cpplogger::LogSeverity::DEBUG, 1000);
+
+			for (int i = 0; i < 100; ++i)
+			{
+				AETHER_LOG_INFO_TO(*logger, "counted message {}", i);
+			}
+			for (int i = 0; i < 10; ++i)
+			{
+				logger->logWarning("counted warning");
+			}
+			logger->logError("counted error");
+			logger->logDebug("counted debug", __FILE__, __LINE__);
+			logger->logTrace("over the severity limit", __FILE__, __LINE__);
+			logger->flush();
+
+			const auto& stats = logger->stats();
+			Assert::AreEqual(std::uint64_t(100), stats.records(aether_cpplogger::LogSeverity::INFO), L"The INFO logs should be counted");
+			Assert::AreEqual(std::uint64_t(10), stats.records(aether_cpplogger::LogSeverity::WARNING), L"The WARNING logs should be counted");
+			Assert::AreEqual(std::uint64_t(1), stats.records(aether_cpplogger::LogSeverity::ERROR), L"The ERROR logs should be counted");
+			Assert::AreEqual(std::uint64_t(1), stats.records(aether_cpplogger::LogSeverity::DEBUG), L"The DEBUG logs should be counted");
+			Assert::AreEqual(std::uint64_t(0), stats.records(aether_cpplogger::LogSeverity::TRACE), L"The discarded logs should not be counted");
+
+			std::uintmax_t fileSize = 0;
+			std::uint64_t fileCount = 0;
+			for (const auto& entry : std::filesystem::directory_iterator(testLogPath))
+			{
+				fileSize += entry.file_size();
+				fileCount += 1;
+			}
+			Assert::IsTrue(fileCount > 1, L"The size limit should rotate the log file");
+			Assert::AreEqual(fileCount - 1, stats.Rotations, L"Every completed log file should be counted as a rotation");
+			Assert::AreEqual(static_cast<std::uint64_t>(fileSize), stats.BytesWritten, L"The written bytes should match the log files");
+			Assert::AreEqual(std::uint64_t(0), stats.Exceptions, L"No error should be counted");
+			Assert::AreEqual(std::uint64_t(0), stats.EnqueueLatency.count(), L"The latencies should not be measured by default");
+
+			logger->shutdown();
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(SkippedRecordsTest)
+		{
+			BlockingReceiverMock receiverMock;
+
+			aether_cpplogger::RateLimitPolicy rateLimitPolicy;
+			rateLimitPolicy.IsEnabled = true;
+			rateLimitPolicy.LogsPerSecond = 0.001;
+			rateLimitPolicy.Burst = 3;
+			aether_cpplogger::SamplingPolicy samplingPolicy;
+			samplingPolicy.IsEnabled = true;
+			samplingPolicy.Interval = 10;
+
+			const auto& logger = aether_cpplogger::LoggerRegistry::get("stats");
+			logger->init(testLogPath, false, aether_cpplogger::LogSeverity::TRACE, 1048576);
+
+			logger->setRateLimitPolicy(rateLimitPolicy);
+			for (int i = 0; i < 10; ++i)
+			{
+				AETHER_LOG_ERROR_TO(*logger, "storm {}", i);
+			}
+			logger->setRateLimitPolicy(aether_cpplogger::RateLimitPolicy());
+
+			logger->setSamplingPolicy(aether_cpplogger::LogSeverity::TRACE, samplingPolicy);
+			for (int i = 0; i < 100; ++i)
+			{
+				AETHER_LOG_TRACE_TO(*logger, "sampled");
+			}
+			logger->setSamplingPolicy(aether_cpplogger::LogSeverity::TRACE, aether_cpplogger::SamplingPolicy());
+
+			logger->setDuplicateSuppression(true);
+			for (int i = 0; i < 5; ++i)
+			{
+				logger->logWarning("repeated");
+			}
+			logger->setDuplicateSuppression(false);
+
+			//The writer thread is blocked by the receiver, so the logs over the queue capacity are dropped
+			logger->enableAsync(4, aether_cpplogger::OverflowPolicy::DROP_NEWEST);
+			logger->addReceiver(&receiverMock);
+			logger->logInfo("first");
+			receiverMock.waitForFirstMessage();
+			for (int i = 0; i < 7; ++i)
+			{
+				logger->logInfo("queued");
+			}
+			receiverMock.release();
+			logger->shutdown();
+			logger->clearReceivers();
+
+			const auto& stats = logger->stats();
+			Assert::AreEqual(std::uint64_t(7), stats.RateLimitedRecords, L"The rate limited logs should be counted");
+			Assert::AreEqual(logger->rateLimitedRecords(), stats.RateLimitedRecords, L"The getter should report the same count");
+			Assert::AreEqual(std::uint64_t(90), stats.SampledOutRecords, L"The logs not kept by the sampling should be counted");
+			Assert::AreEqual(std::uint64_t(4), stats.SuppressedDuplicates, L"The repeats should be counted");
+			Assert::AreEqual(std::uint64_t(4), stats.DroppedRecords, L"The dropped logs should be kept after the async mode ends");
+			Assert::AreEqual(std::uint64_t(8), stats.records(aether_cpplogger::LogSeverity::INFO), L"The dropped logs should be counted as records as well");
+
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(ShardedCountersTest)
+		{
+			const auto& logger = aether_cpplogger::LoggerRegistry::get("stats");
+			logger->init(testLogPath, false, aether_cpplogger::LogSeverity::INFO, 1048576);
+			logger->enableAsync(1024, aether_cpplogger::OverflowPolicy::BLOCK, aether_cpplogger::AsyncQueueMode::PER_THREAD);
+
+			//The second round of threads reuses the shards of the exited ones
+			for (int round = 0; round < 2; ++round)
+			{
+				std::vector<std::thread> threads;
+				for (int i = 0; i < 4; ++i)
+				{
+					threads.emplace_back([&logger]()
+						{
+							for (int j = 0; j < 1000; ++j)
+							{
+								AETHER_LOG_INFO_TO(*logger, "sharded {}", j);
+							}
+						});
+				}
+				for (auto& thread : threads)
+				{
+					thread.join();
+				}
+			}
+			logger->flush();
+
+			const auto& stats = logger->stats();
+			Assert::AreEqual(std::uint64_t(8000), stats.records(aether_cpplogger::LogSeverity::INFO), L"The logs of every thread should be summed");
+			Assert::AreEqual(std::uint64_t(0), stats.DroppedRecords, L"The blocking queue should not drop logs");
+
+			logger->shutdown();
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(SampledOutLoggersTest)
+		{
+			aether_cpplogger::SamplingPolicy samplingPolicy;
+			samplingPolicy.IsEnabled = true;
+			samplingPolicy.Probability = 0.0;
+
+			const auto& firstLogger = aether_cpplogger::LoggerRegistry::get("stats");
+			const auto& secondLogger = aether_cpplogger::LoggerRegistry::get("stats_second");
+			for (const auto& logger : { firstLogger, secondLogger })
+			{
+				logger->init(testLogPath, false, aether_cpplogger::LogSeverity::TRACE, 1048576);
+				logger->setSamplingPolicy(aether_cpplogger::LogSeverity::DEBUG, samplingPolicy);
+			}
+
+			//The threads alternate between the loggers, so the cached counter of the thread is switched on every log
+			std::vector<std::thread> threads;
+			for (int i = 0; i < 2; ++i)
+			{
+				threads.emplace_back([&firstLogger, &secondLogger]()
+					{
+						for (int j = 0; j < 100; ++j)
+						{
+							AETHER_LOG_DEBUG_TO(*firstLogger, "first {}", j);
+							AETHER_LOG_DEBUG_TO(*firstLogger, "first {}", j);
+							AETHER_LOG_DEBUG_TO(*secondLogger, "second {}", j);
+						}
+					});
+			}
+			for (auto& thread : threads)
+			{
+				thread.join();
+			}
+
+			Assert::AreEqual(std::uint64_t(400), firstLogger->stats().SampledOutRecords, L"Every skipped log should be counted by its logger");
+			Assert::AreEqual(std::uint64_t(200), secondLogger->stats().SampledOutRecords, L"Every skipped log should be counted by its logger");
+			Assert::AreEqual(std::uint64_t(0), firstLogger->stats().records(aether_cpplogger::LogSeverity::DEBUG), L"No log should be kept with 0 probability");
+
+			firstLogger->shutdown();
+			secondLogger->shutdown();
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(LatencyTrackingTest)
+		{
+			aether_cpplogger::StatsPolicy statsPolicy;
+			statsPolicy.IsLatencyTracked = true;
+
+			const auto& logger = aether_cpplogger::LoggerRegistry::get("stats");
+			logger->init(testLogPath, false, aether_cpplogger::LogSeverity::INFO, 1048576);
+			logger->enableAsync();
+			logger->setStatsPolicy(statsPolicy);
+
+			for (int i = 0; i < 1000; ++i)
+			{
+				AETHER_LOG_INFO_TO(*logger, "measured {}", i);
+			}
+			logger->flush();
+
+			auto stats = logger->stats();
+			Assert::AreEqual(std::uint64_t(1000), stats.EnqueueLatency.count(), L"Every enqueue should be measured");
+			Assert::AreEqual(std::uint64_t(1000), stats.WriteLatency.count(), L"Every log file write should be measured");
+			Assert::IsTrue(stats.FlushLatency.count() > 0, L"The flushes should be measured");
+			Assert::IsTrue(stats.EnqueueLatency.percentile(0.5) <= stats.EnqueueLatency.percentile(0.99), L"The percentiles should be ordered");
+			Assert::IsTrue(stats.EnqueueLatency.percentile(0.99) <= stats.EnqueueLatency.max(), L"The percentiles should not exceed the maximum");
+
+			logger->setStatsPolicy(aether_cpplogger::StatsPolicy());
+			logger->logInfo("not measured");
+			logger->flush();
+			stats = logger->stats();
+			Assert::AreEqual(std::uint64_t(1000), stats.EnqueueLatency.count(), L"The enqueue should not be measured after the tracking is disabled");
+			Assert::AreEqual(std::uint64_t(1001), stats.records(aether_cpplogger::LogSeverity::INFO), L"The logs should still be counted");
+
+			logger->shutdown();
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(SyncReportTest)
+		{
+			StatsReceiverMock directReceiver;
+			StatsReceiverMock isolatedReceiver;
+			aether_cpplogger::ReceiverPolicy receiverPolicy;
+			receiverPolicy.IsIsolated = true;
+			aether_cpplogger::StatsPolicy statsPolicy;
+			statsPolicy.ReportInterval = std::chrono::milliseconds(20);
+
+			const auto& logger = aether_cpplogger::LoggerRegistry::get("stats");
+			logger->init(testLogPath, false, aether_cpplogger::LogSeverity::INFO, 1048576);
+			logger->addReceiver(&directReceiver);
+			logger->addReceiver(&isolatedReceiver, receiverPolicy);
+			logger->setStatsPolicy(statsPolicy);
+
+			logger->logInfo("before the interval");
+			Assert::AreEqual(0, directReceiver.reportCount(), L"The report should wait for the interval");
+
+			//The first log after the interval makes the report on the logging thread
+			std::this_thread::sleep_for(std::chrono::milliseconds(40));
+			logger->logInfo("after the interval");
+			Assert::AreEqual(1, directReceiver.reportCount(), L"The log after the interval should make a report");
+			Assert::IsTrue(std::this_thread::get_id() == directReceiver.lastThreadId(), L"The logging thread should report in sync mode");
+			Assert::AreEqual(std::uint64_t(2), directReceiver.lastStats().records(aether_cpplogger::LogSeverity::INFO), L"The report should count the logs");
+
+			Assert::IsTrue(isolatedReceiver.waitForReports(1, std::chrono::milliseconds(2000)), L"The isolated receiver should get the report");
+			Assert::IsTrue(std::this_thread::get_id() != isolatedReceiver.lastThreadId(), L"The isolated receiver should get the report on its dispatcher thread");
+
+			logger->shutdown();
+			logger->clearReceivers();
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(AsyncReportTest)
+		{
+			StatsReceiverMock receiverMock;
+			aether_cpplogger::StatsPolicy statsPolicy;
+			statsPolicy.ReportInterval = std::chrono::milliseconds(10);
+
+			const auto& logger = aether_cpplogger::LoggerRegistry::get("stats");
+			logger->init(testLogPath, false, aether_cpplogger::LogSeverity::INFO, 1048576);
+			logger->enableAsync();
+			logger->addReceiver(&receiverMock);
+			logger->setStatsPolicy(statsPolicy);
+			logger->logInfo("reported");
+
+			//The idle writer thread keeps reporting without new logs
+			Assert::IsTrue(receiverMock.waitForReports(3, std::chrono::milliseconds(2000)), L"The writer thread should report periodically");
+			Assert::IsTrue(std::this_thread::get_id() != receiverMock.lastThreadId(), L"The writer thread should report in async mode");
+			Assert::AreEqual(std::uint64_t(1), receiverMock.lastStats().records(aether_cpplogger::LogSeverity::INFO), L"The report should count the logs");
+
+			logger->setStatsPolicy(aether_cpplogger::StatsPolicy());
+			logger->shutdown();
+			logger->clearReceivers();
+			std::filesystem::remove_all(testLogPath);
+		}
+	};
+}
\ No newline at end of file
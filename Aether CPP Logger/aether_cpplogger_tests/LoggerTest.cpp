@@ -1,13 +1,16 @@
 #include "pch.h"
 #include "CppUnitTest.h"
 
+#include "ClockMock.h"
 #include "LoggerMock.h"
 #include "ReceiverMock.h"
 #include "LoggerException.h"
+#include "TimestampCache.h"
 
 #include <iostream>
 #include <filesystem>
 #include <fstream>
+#include <thread>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 
@@ -18,7 +21,7 @@ namespace aether_cpplogger_tests
 	private:
 		const std::string testLogPath = "LoggerTest";
 		const std::string testMessage = "This is a test";
-		const std::string testLogFilename = "2022-3-22.log";
+		const std::string testLogFilename = "2022-03-22.log";
 		aether_cpplogger::Logger::DateTime testDateTime;
 		
 		TEST_METHOD_INITIALIZE(Setup)
@@ -66,6 +69,28 @@ namespace aether_cpplogger_tests
 			aether_cpplogger::Logger::logInfo(testMessage);
 			Assert::IsTrue(std::filesystem::exists(testLogPath), L"Log path directory should not exist");
 
+			aether_cpplogger::Logger::shutdown();
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(DisabledLogArgumentsTest)
+		{
+			int evaluationCount = 0;
+			const auto& evaluate = [&]()
+			{
+				evaluationCount += 1;
+				return evaluationCount;
+			};
+
+			aether_cpplogger::Logger::init(testLogPath, false, aether_cpplogger::LogSeverity::INFO, 10);
+			AETHER_LOG_DEBUG("value {}", evaluate());
+			AETHER_LOG_TRACE(std::to_string(evaluate()));
+			Assert::AreEqual(0, evaluationCount, L"The arguments of a disabled log should not be evaluated");
+
+			AETHER_LOG_INFO("value {}", evaluate());
+			Assert::AreEqual(1, evaluationCount, L"The arguments of an enabled log should be evaluated once");
+
+			aether_cpplogger::Logger::shutdown();
 			std::filesystem::remove_all(testLogPath);
 		}
 
@@ -74,7 +99,11 @@ namespace aether_cpplogger_tests
 			const std::string testApplication = "TestApp";
 			const std::string testDomain = "TestDomain";
 			const auto& appDataFolder = LoggerMock::createAppDataPathTest(testApplication, testDomain);
+#ifdef _WIN32
 			const std::string expectedAppDataFolderEnding = "\\AppData\\Roaming\\TestDomain\\TestApp\\logs";
+#else
+			const std::string expectedAppDataFolderEnding = "/TestDomain/TestApp/logs";
+#endif
 			const auto endsWith = appDataFolder.compare(appDataFolder.size() - expectedAppDataFolderEnding.size(), expectedAppDataFolderEnding.size(), expectedAppDataFolderEnding);
 			Assert::IsTrue(endsWith == 0);
 		}
@@ -84,7 +113,11 @@ namespace aether_cpplogger_tests
 			const std::string testApplication = "TestApp";
 			const std::string testDomain = "";
 			const auto& appDataFolder = LoggerMock::createAppDataPathTest(testApplication, testDomain);
+#ifdef _WIN32
 			const std::string expectedAppDataFolderEnding = "\\AppData\\Roaming\\TestApp\\logs";
+#else
+			const std::string expectedAppDataFolderEnding = "/TestApp/logs";
+#endif
 			const auto endsWith = appDataFolder.compare(appDataFolder.size() - expectedAppDataFolderEnding.size(), expectedAppDataFolderEnding.size(), expectedAppDataFolderEnding);
 			Assert::IsTrue(endsWith == 0);
 		}
@@ -114,32 +147,105 @@ namespace aether_cpplogger_tests
 			Assert::AreEqual(expectedTimePrefix, timePrefix);
 		}
 
+		TEST_METHOD(MessageTimePrefixPrecisionTest)
+		{
+			auto dateTime = testDateTime;
+			dateTime.Hours = 9;
+			dateTime.Minutes = 5;
+			dateTime.Seconds = 3;
+			dateTime.Microseconds = 42017;
+
+			aether_cpplogger::Logger::setTimestampPrecision(aether_cpplogger::TimestampPrecision::MILLISECONDS);
+			Assert::AreEqual(std::string("09:05:03.042\t\t"), LoggerMock::createMessageTimePrefixTest(dateTime));
+
+			aether_cpplogger::Logger::setTimestampPrecision(aether_cpplogger::TimestampPrecision::MICROSECONDS);
+			Assert::AreEqual(std::string("09:05:03.042017\t\t"), LoggerMock::createMessageTimePrefixTest(dateTime));
+
+			aether_cpplogger::Logger::setTimestampPrecision(aether_cpplogger::TimestampPrecision::SECONDS);
+			Assert::AreEqual(std::string("09:05:03\t\t"), LoggerMock::createMessageTimePrefixTest(dateTime));
+		}
+
+		TEST_METHOD(TimestampCacheTest)
+		{
+			const std::int64_t timestamp = aether_cpplogger::Clock::now();
+			const auto& expectedDateTime = aether_cpplogger::Clock::toDateTime(timestamp);
+
+			aether_cpplogger::TimestampCache timestampCache;
+			timestampCache.update(timestamp);
+			Assert::AreEqual(expectedDateTime.currentDateString(), std::string(timestampCache.dateString()));
+			Assert::AreEqual(expectedDateTime.currentTimeString(aether_cpplogger::TimestampPrecision::MICROSECONDS),
+				std::string(timestampCache.timeString(aether_cpplogger::TimestampPrecision::MICROSECONDS)));
+
+			//Moving within the same second only patches the fractional digits
+			const std::int64_t laterTimestamp = timestamp - timestamp % 1000000 + 999999;
+			timestampCache.update(laterTimestamp);
+			Assert::AreEqual(expectedDateTime.currentTimeString() + ".999",
+				std::string(timestampCache.timeString(aether_cpplogger::TimestampPrecision::MILLISECONDS)));
+
+			//Timestamps of the clock never go backwards
+			Assert::IsTrue(aether_cpplogger::Clock::now() >= timestamp);
+		}
+
+		TEST_METHOD(ClockResyncTest)
+		{
+			static std::int64_t fakeWallClock = 0;
+			static std::int64_t fakeMonotonicClock = 0;
+			const auto& advance = [](const std::int64_t wallClock, const std::int64_t monotonicClock)
+				{
+					fakeWallClock += wallClock;
+					fakeMonotonicClock += monotonicClock;
+				};
+
+			fakeWallClock = 1600000000000000;
+			fakeMonotonicClock = 5000000;
+			ClockMock::setTimeSourcesTest([]() { return fakeWallClock; }, []() { return fakeMonotonicClock; });
+			Assert::AreEqual(fakeWallClock, aether_cpplogger::Clock::now(), L"The clock should be anchored to the wall clock");
+
+			//An adjustment of the wall clock within the second is not noticed
+			advance(3600000000 + 500000, 500000);
+			Assert::AreEqual(fakeWallClock - 3600000000, aether_cpplogger::Clock::now(), L"The clock should be extrapolated within the second");
+
+			//The wall clock is read again when the second rolls over
+			advance(600000, 600000);
+			Assert::AreEqual(fakeWallClock, aether_cpplogger::Clock::now(), L"The clock should follow the adjusted wall clock");
+			advance(1000, 1000);
+			Assert::AreEqual(fakeWallClock, aether_cpplogger::Clock::now(), L"The clock should keep the new anchor");
+
+			//The clock stands still until the wall clock set back catches up
+			const auto lastTimestamp = fakeWallClock;
+			advance(-7200000000 + 1000000, 1000000);
+			Assert::AreEqual(lastTimestamp, aether_cpplogger::Clock::now(), L"The clock should not go backwards");
+			advance(1000000, 1000000);
+			Assert::AreEqual(lastTimestamp, aether_cpplogger::Clock::now(), L"The clock should not go backwards");
+			advance(10800000000, 10800000000);
+			Assert::AreEqual(fakeWallClock, aether_cpplogger::Clock::now(), L"The clock should follow the wall clock after catching up");
+
+			ClockMock::setTimeSourcesTest(nullptr, nullptr);
+			const std::int64_t systemClock = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+			Assert::IsTrue(std::abs(aether_cpplogger::Clock::now() - systemClock) < 1000000, L"The clock should read the system clock again");
+		}
+
 		TEST_METHOD(DateTimeTest)
 		{
 			const auto& currentDateTime = LoggerMock::currentDateTimeTest();
 
 			const time_t now = time(nullptr);
 			tm ltm;
+#ifdef _WIN32
 			localtime_s(&ltm, &now);
+#else
+			localtime_r(&now, &ltm);
+#endif
 
-			const int currentYear = 1900 + ltm.tm_year;
-			const int currentMonth = 1 + ltm.tm_mon;
-			const int currentDay = ltm.tm_mday;
-			const int currentHours = ltm.tm_hour;
-			const int currentMinutes = ltm.tm_min;
-			const int currentSeconds = ltm.tm_sec;
-
-			const std::string expectedDate = std::to_string(currentYear) + "-" +
-				std::to_string(currentMonth) + "-" +
-				std::to_string(currentDay);
+			char expectedDate[11];
+			std::strftime(expectedDate, sizeof(expectedDate), "%Y-%m-%d", &ltm);
 
-			Assert::AreEqual(expectedDate, currentDateTime.currentDateString());
+			Assert::AreEqual(std::string(expectedDate), currentDateTime.currentDateString());
 
-			const std::string expectedTime = std::to_string(currentHours) + ":" +
-				std::to_string(currentMinutes) + ":" +
-				std::to_string(currentSeconds);
+			char expectedTime[9];
+			std::strftime(expectedTime, sizeof(expectedTime), "%H:%M:%S", &ltm);
 
-			Assert::AreEqual(expectedTime, currentDateTime.currentTimeString());
+			Assert::AreEqual(std::string(expectedTime), currentDateTime.currentTimeString());
 		}
 
 		TEST_METHOD(LogPathTest)
@@ -173,7 +279,7 @@ namespace aether_cpplogger_tests
 			std::filesystem::create_directory(testLogPath);
 
 			std::ofstream testLogFile;
-			testLogFile.open(testLogPath + "\\" + testLogFilename);
+			testLogFile.open(testLogPath + "/" + testLogFilename);
 			testLogFile.close();
 
 			aether_cpplogger::Logger::init(testLogPath);
@@ -188,12 +294,12 @@ namespace aether_cpplogger_tests
 			std::filesystem::create_directory(testLogPath);
 
 			std::ofstream testLogFile;
-			testLogFile.open(testLogPath + "\\" + testLogFilename);
+			testLogFile.open(testLogPath + "/" + testLogFilename);
 			testLogFile.seekp(10);
 			testLogFile.write("", 1);
 			testLogFile.close();
 
-			const std::string expectedLogFilename = "2022-3-22_2.log";
+			const std::string expectedLogFilename = "2022-03-22_2.log";
 			aether_cpplogger::Logger::init(testLogPath, false, aether_cpplogger::LogSeverity::ERROR, 9);
 			const auto& filename = LoggerMock::checkLogFileTest(testDateTime);
 			Assert::AreEqual(expectedLogFilename.c_str(), filename.c_str());
@@ -201,6 +307,50 @@ namespace aether_cpplogger_tests
 			std::filesystem::remove_all(testLogPath);
 		}
 
+		TEST_METHOD(LogFileWithHighestExistingIndexTest)
+		{
+			std::filesystem::create_directory(testLogPath);
+
+			//The indices before the highest one are not checked, even the missing and the not full ones
+			const auto& createLogFile = [this](const std::string& filename, const std::size_t size)
+			{
+				std::ofstream testLogFile(testLogPath + "/" + filename, std::ios::out | std::ios::binary);
+				testLogFile << std::string(size, 'x');
+			};
+			createLogFile(testLogFilename, 1);
+			createLogFile("2022-03-22_4.log", 10);
+			createLogFile("2022-03-22_6.log.gz", 1);
+			createLogFile("2022-03-22_7.log", 1);
+			createLogFile("2022-03-22_12.logb", 1);
+			createLogFile("2022-03-23_20.log", 1);
+
+			aether_cpplogger::Logger::init(testLogPath, false, aether_cpplogger::LogSeverity::ERROR, 9);
+			Assert::AreEqual(std::string("2022-03-22_7.log"), LoggerMock::checkLogFileTest(testDateTime), L"The highest index should be continued");
+
+			createLogFile("2022-03-22_7.log", 10);
+			Assert::AreEqual(std::string("2022-03-22_8.log"), LoggerMock::checkLogFileTest(testDateTime), L"A full file should be followed by the next index");
+
+			createLogFile("2022-03-22_8.log.gz", 1);
+			Assert::AreEqual(std::string("2022-03-22_9.log"), LoggerMock::checkLogFileTest(testDateTime), L"A compressed file should be followed by the next index");
+
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(LogFileIndexOverLegacyLimitTest)
+		{
+			std::filesystem::create_directory(testLogPath);
+
+			//A busy day continues past the index 99999 which used to end in an exception
+			std::ofstream testLogFile(testLogPath + "/2022-03-22_99999.log", std::ios::out | std::ios::binary);
+			testLogFile << std::string(10, 'x');
+			testLogFile.close();
+
+			aether_cpplogger::Logger::init(testLogPath, false, aether_cpplogger::LogSeverity::ERROR, 9);
+			Assert::AreEqual(std::string("2022-03-22_100000.log"), LoggerMock::checkLogFileTest(testDateTime), L"The full file should be followed by the next index");
+
+			std::filesystem::remove_all(testLogPath);
+		}
+
 		TEST_METHOD(WriteToConsoleTest)
 		{
 			std::stringstream buffer;
@@ -227,10 +377,10 @@ namespace aether_cpplogger_tests
 			LoggerMock::writeLogToFileTest(testMessage, testDateTime);
 
 			Assert::IsTrue(std::filesystem::exists(testLogPath), L"Log path directory should exist");
-			Assert::IsTrue(std::filesystem::exists(testLogPath + "\\" + testLogFilename), L"Log file should exist");
+			Assert::IsTrue(std::filesystem::exists(testLogPath + "/" + testLogFilename), L"Log file should exist");
 
 			std::ifstream inLogFile;
-			inLogFile.open(testLogPath + "\\" + testLogFilename);
+			inLogFile.open(testLogPath + "/" + testLogFilename);
 			std::string fileContent;
 
 			inLogFile.seekg(0, std::ios::end);
@@ -244,6 +394,7 @@ namespace aether_cpplogger_tests
 
 			Assert::AreEqual(testMessage + "\n", fileContent, L"The file content is incorrect");
 
+			aether_cpplogger::Logger::shutdown();
 			std::filesystem::remove_all(testLogPath);
 		}
 
@@ -256,18 +407,18 @@ namespace aether_cpplogger_tests
 			std::filesystem::create_directory(testLogPath);
 
 			std::ofstream testLogFile;
-			testLogFile.open(testLogPath + "\\" + testLogFilename);
+			testLogFile.open(testLogPath + "/" + testLogFilename);
 			testLogFile << testMessage << std::endl;
 			testLogFile.close();
 
 			Assert::IsTrue(std::filesystem::exists(testLogPath), L"Log path directory should exist");
-			Assert::IsTrue(std::filesystem::exists(testLogPath + "\\" + testLogFilename), L"Initial log file should exist");
+			Assert::IsTrue(std::filesystem::exists(testLogPath + "/" + testLogFilename), L"Initial log file should exist");
 
 			aether_cpplogger::Logger::init(testLogPath, true, aether_cpplogger::LogSeverity::ERROR, 1024);
 			LoggerMock::writeLogToFileTest(testMessage, testDateTime);
 
 			std::ifstream inLogFile;
-			inLogFile.open(testLogPath + "\\" + testLogFilename);
+			inLogFile.open(testLogPath + "/" + testLogFilename);
 			std::string fileContent;
 
 			inLogFile.seekg(0, std::ios::end);
@@ -282,6 +433,7 @@ namespace aether_cpplogger_tests
 			const std::string expectedMessage = testMessage + "\n" + testMessage + "\n";
 			Assert::AreEqual(expectedMessage, fileContent, L"The file content is incorrect");
 
+			aether_cpplogger::Logger::shutdown();
 			std::filesystem::remove_all(testLogPath);
 		}
 
@@ -294,19 +446,19 @@ namespace aether_cpplogger_tests
 			std::filesystem::create_directory(testLogPath);
 
 			std::ofstream testLogFile;
-			testLogFile.open(testLogPath + "\\" + testLogFilename);
+			testLogFile.open(testLogPath + "/" + testLogFilename);
 			testLogFile << testMessage << std::endl;
 			testLogFile.close();
 
 			Assert::IsTrue(std::filesystem::exists(testLogPath), L"Log path directory should exist");
-			Assert::IsTrue(std::filesystem::exists(testLogPath + "\\" + testLogFilename), L"Initial log file should exist");
+			Assert::IsTrue(std::filesystem::exists(testLogPath + "/" + testLogFilename), L"Initial log file should exist");
 
 			aether_cpplogger::Logger::init(testLogPath, true, aether_cpplogger::LogSeverity::ERROR, 1);
 			LoggerMock::writeLogToFileTest(testMessage, testDateTime);
 
-			const std::string expectedLogFilename = "2022-3-22_2.log";
+			const std::string expectedLogFilename = "2022-03-22_2.log";
 			std::ifstream inLogFile;
-			inLogFile.open(testLogPath + "\\" + expectedLogFilename);
+			inLogFile.open(testLogPath + "/" + expectedLogFilename);
 			std::string fileContent;
 
 			inLogFile.seekg(0, std::ios::end);
@@ -321,6 +473,344 @@ namespace aether_cpplogger_tests
 			const std::string expectedMessage = testMessage + "\n";
 			Assert::AreEqual(expectedMessage, fileContent, L"The file content is incorrect");
 
+			aether_cpplogger::Logger::shutdown();
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(WriteLogToFileRotationTest)
+		{
+			if (std::filesystem::exists(testLogPath))
+			{
+				std::filesystem::remove_all(testLogPath);
+			}
+
+			//The second message reaches the limit, so the third one has to go into a new file
+			aether_cpplogger::Logger::init(testLogPath, false, aether_cpplogger::LogSeverity::ERROR, 20);
+			LoggerMock::writeLogToFileTest(testMessage, testDateTime);
+			LoggerMock::writeLogToFileTest(testMessage, testDateTime);
+			LoggerMock::writeLogToFileTest(testMessage, testDateTime);
+			aether_cpplogger::Logger::shutdown();
+
+			const std::string expectedLogFilename = "2022-03-22_2.log";
+			Assert::IsTrue(std::filesystem::exists(testLogPath + "/" + testLogFilename), L"Log file should exist");
+			Assert::IsTrue(std::filesystem::exists(testLogPath + "/" + expectedLogFilename), L"Rotated log file should exist");
+
+			std::ifstream inLogFile;
+			inLogFile.open(testLogPath + "/" + expectedLogFilename);
+			std::string fileContent;
+			fileContent.assign((std::istreambuf_iterator<char>(inLogFile)),
+				std::istreambuf_iterator<char>());
+			inLogFile.close();
+
+			Assert::AreEqual(testMessage + "\n", fileContent, L"The file content is incorrect");
+
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(MappedLogFileRotationTest)
+		{
+			if (std::filesystem::exists(testLogPath))
+			{
+				std::filesystem::remove_all(testLogPath);
+			}
+
+			//Two lines fit into the preallocated file, the third one has to go into a new file
+			aether_cpplogger::Logger::init(testLogPath, false, aether_cpplogger::LogSeverity::ERROR, 40);
+			aether_cpplogger::Logger::setLogFileMode(aether_cpplogger::LogFileMode::MAPPED);
+			LoggerMock::writeLogToFileTest(testMessage, testDateTime);
+			LoggerMock::writeLogToFileTest(testMessage, testDateTime);
+			LoggerMock::writeLogToFileTest(testMessage, testDateTime);
+			aether_cpplogger::Logger::shutdown();
+			aether_cpplogger::Logger::setLogFileMode(aether_cpplogger::LogFileMode::BUFFERED);
+
+			const std::string expectedLogFilename = "2022-03-22_2.log";
+			Assert::IsTrue(std::filesystem::exists(testLogPath + "/" + testLogFilename), L"Log file should exist");
+			Assert::IsTrue(std::filesystem::exists(testLogPath + "/" + expectedLogFilename), L"Rotated log file should exist");
+
+			//The unused tail of the preallocated files is truncated
+			std::ifstream inLogFile;
+			inLogFile.open(testLogPath + "/" + testLogFilename);
+			std::string fileContent;
+			fileContent.assign((std::istreambuf_iterator<char>(inLogFile)),
+				std::istreambuf_iterator<char>());
+			inLogFile.close();
+
+			Assert::AreEqual(testMessage + "\n" + testMessage + "\n", fileContent, L"The file content is incorrect");
+
+			inLogFile.open(testLogPath + "/" + expectedLogFilename);
+			fileContent.assign((std::istreambuf_iterator<char>(inLogFile)),
+				std::istreambuf_iterator<char>());
+			inLogFile.close();
+
+			Assert::AreEqual(testMessage + "\n", fileContent, L"The file content is incorrect");
+
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(LogFileCompressionTest)
+		{
+			if (std::filesystem::exists(testLogPath))
+			{
+				std::filesystem::remove_all(testLogPath);
+			}
+
+			//Returns the uncompressed size stored in the gzip trailer, or -1 if the file is not a gzip file
+			const auto& compressedSize = [this](const std::string& filename)
+			{
+				std::ifstream inFile(testLogPath + "/" + filename, std::ios::binary);
+				const std::string content((std::istreambuf_iterator<char>(inFile)), std::istreambuf_iterator<char>());
+				if (content.size() < 18 || static_cast<unsigned char>(content[0]) != 0x1F || static_cast<unsigned char>(content[1]) != 0x8B)
+				{
+					return -1;
+				}
+
+				int size = 0;
+				for (int i = 0; i < 4; ++i)
+				{
+					size |= static_cast<unsigned char>(content[content.size() - 4 + i]) << (8 * i);
+				}
+				return size;
+			};
+
+			//Three lines fill a log file, so the 7 lines are written to 3 files and the first two are completed
+			aether_cpplogger::CompressionPolicy compressionPolicy;
+			compressionPolicy.IsEnabled = true;
+			compressionPolicy.WorkerCount = 2;
+			aether_cpplogger::Logger::init(testLogPath, false, aether_cpplogger::LogSeverity::ERROR, 40);
+			aether_cpplogger::Logger::setCompressionPolicy(compressionPolicy);
+			for (int i = 0; i < 7; ++i)
+			{
+				LoggerMock::writeLogToFileTest(testMessage, testDateTime);
+			}
+			aether_cpplogger::Logger::shutdown();
+
+			const int fullSize = static_cast<int>(3 * (testMessage.size() + 1));
+			Assert::IsFalse(std::filesystem::exists(testLogPath + "/" + "2022-03-22.log"), L"The completed log file should be removed");
+			Assert::AreEqual(fullSize, compressedSize("2022-03-22.log.gz"), L"The completed log file should be compressed");
+			Assert::AreEqual(fullSize, compressedSize("2022-03-22_2.log.gz"), L"The completed log file should be compressed");
+			Assert::IsTrue(std::filesystem::exists(testLogPath + "/" + "2022-03-22_3.log"), L"The open log file should not be compressed");
+
+			//The numbering continues after the compressed files
+			for (int i = 0; i < 3; ++i)
+			{
+				LoggerMock::writeLogToFileTest(testMessage, testDateTime);
+			}
+			aether_cpplogger::Logger::shutdown();
+			aether_cpplogger::Logger::setCompressionPolicy(aether_cpplogger::CompressionPolicy());
+
+			Assert::AreEqual(fullSize, compressedSize("2022-03-22_3.log.gz"), L"The continued log file should be compressed");
+			Assert::IsTrue(std::filesystem::exists(testLogPath + "/" + "2022-03-22_4.log"), L"The next log file should get the next index");
+			Assert::IsFalse(std::filesystem::exists(testLogPath + "/" + "2022-03-22.log"), L"The first index should not be reused");
+
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(CompressedLogFileModeTest)
+		{
+			if (std::filesystem::exists(testLogPath))
+			{
+				std::filesystem::remove_all(testLogPath);
+			}
+
+			//Returns the number of gzip members and the uncompressed size in the trailer of the last one
+			const auto& readFrames = [this](const std::string& filename)
+			{
+				std::ifstream inFile(testLogPath + "/" + filename, std::ios::binary);
+				const std::string content((std::istreambuf_iterator<char>(inFile)), std::istreambuf_iterator<char>());
+				const std::string header("\x1F\x8B\x08\x00\x00\x00\x00\x00\x00\xFF", 10);
+
+				int frameCount = 0;
+				for (auto position = content.find(header); position != std::string::npos; position = content.find(header, position + 1))
+				{
+					++frameCount;
+				}
+
+				int lastFrameSize = -1;
+				if (content.size() >= 18)
+				{
+					lastFrameSize = 0;
+					for (int i = 0; i < 4; ++i)
+					{
+						lastFrameSize |= static_cast<unsigned char>(content[content.size() - 4 + i]) << (8 * i);
+					}
+				}
+				return std::make_pair(frameCount, lastFrameSize);
+			};
+
+			//Every line ends its own frame
+			aether_cpplogger::CompressionPolicy compressionPolicy;
+			compressionPolicy.FrameSize = 0;
+			aether_cpplogger::Logger::init(testLogPath, false, aether_cpplogger::LogSeverity::ERROR, 40);
+			aether_cpplogger::Logger::setCompressionPolicy(compressionPolicy);
+			aether_cpplogger::Logger::setLogFileMode(aether_cpplogger::LogFileMode::COMPRESSED);
+
+			LoggerMock::writeLogToFileTest(testMessage, testDateTime);
+			LoggerMock::writeLogToFileTest(testMessage, testDateTime);
+
+			//The frames are complete on the disk while the file is still open
+			const int lineSize = static_cast<int>(testMessage.size() + 1);
+			const auto& openFrames = readFrames("2022-03-22.log.gz");
+			Assert::AreEqual(2, openFrames.first, L"Each line should be written as a complete frame");
+			Assert::AreEqual(lineSize, openFrames.second, L"The last frame should contain the last line");
+
+			//The size limit applies to the uncompressed size, so the fourth line starts the next file
+			LoggerMock::writeLogToFileTest(testMessage, testDateTime);
+			LoggerMock::writeLogToFileTest(testMessage, testDateTime);
+			aether_cpplogger::Logger::shutdown();
+			aether_cpplogger::Logger::setLogFileMode(aether_cpplogger::LogFileMode::BUFFERED);
+			aether_cpplogger::Logger::setCompressionPolicy(aether_cpplogger::CompressionPolicy());
+
+			Assert::AreEqual(3, readFrames("2022-03-22.log.gz").first, L"The first file should contain three frames");
+			Assert::AreEqual(1, readFrames("2022-03-22_2.log.gz").first, L"The next file should contain the fourth line");
+			Assert::IsFalse(std::filesystem::exists(testLogPath + "/" + "2022-03-22.log"), L"No plain log file should be created");
+
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(MappedLogFileCrashRecoveryTest)
+		{
+			if (std::filesystem::exists(testLogPath))
+			{
+				std::filesystem::remove_all(testLogPath);
+			}
+
+			//A crash leaves the preallocated tail of the file filled with NUL bytes
+			std::filesystem::create_directories(testLogPath);
+			std::ofstream crashedLogFile(testLogPath + "/" + testLogFilename, std::ios::binary);
+			crashedLogFile << testMessage << "\n" << std::string(100, '\0');
+			crashedLogFile.close();
+
+			aether_cpplogger::Logger::init(testLogPath, false, aether_cpplogger::LogSeverity::ERROR, 4096);
+			aether_cpplogger::Logger::setLogFileMode(aether_cpplogger::LogFileMode::MAPPED);
+			LoggerMock::writeLogToFileTest(testMessage, testDateTime);
+			aether_cpplogger::Logger::shutdown();
+			aether_cpplogger::Logger::setLogFileMode(aether_cpplogger::LogFileMode::BUFFERED);
+
+			std::ifstream inLogFile;
+			inLogFile.open(testLogPath + "/" + testLogFilename, std::ios::binary);
+			std::string fileContent;
+			fileContent.assign((std::istreambuf_iterator<char>(inLogFile)),
+				std::istreambuf_iterator<char>());
+			inLogFile.close();
+
+			Assert::AreEqual(testMessage + "\n" + testMessage + "\n", fileContent, L"The new line should follow the written data");
+
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(MappedLogFileConcurrentTest)
+		{
+			if (std::filesystem::exists(testLogPath))
+			{
+				std::filesystem::remove_all(testLogPath);
+			}
+
+			aether_cpplogger::Logger::init(testLogPath, false, aether_cpplogger::LogSeverity::ERROR, 4096);
+			aether_cpplogger::Logger::setLogFileMode(aether_cpplogger::LogFileMode::MAPPED);
+
+			const int threadCount = 4;
+			const int logCount = 500;
+			std::vector<std::thread> threads;
+			for (int i = 0; i < threadCount; ++i)
+			{
+				threads.emplace_back([this]()
+					{
+						for (int j = 0; j < logCount; ++j)
+						{
+							LoggerMock::writeLogToFileTest(testMessage, testDateTime);
+						}
+					});
+			}
+			for (auto& thread : threads)
+			{
+				thread.join();
+			}
+			aether_cpplogger::Logger::shutdown();
+			aether_cpplogger::Logger::setLogFileMode(aether_cpplogger::LogFileMode::BUFFERED);
+
+			//Every line is complete and the files contain nothing else
+			int lineCount = 0;
+			int fileCount = 0;
+			for (const auto& entry : std::filesystem::directory_iterator(testLogPath))
+			{
+				fileCount += 1;
+				std::ifstream inLogFile(entry.path());
+				std::string line;
+				while (std::getline(inLogFile, line))
+				{
+					Assert::AreEqual(testMessage, line, L"The line content is incorrect");
+					lineCount += 1;
+				}
+			}
+			Assert::AreEqual(threadCount * logCount, lineCount, L"Every log should be written");
+			Assert::IsTrue(fileCount > 1, L"The full files should be rotated");
+
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(WriteLogToFileFlushPolicyTest)
+		{
+			if (std::filesystem::exists(testLogPath))
+			{
+				std::filesystem::remove_all(testLogPath);
+			}
+
+			aether_cpplogger::FlushPolicy flushPolicy;
+			flushPolicy.BufferSize = 1024;
+			flushPolicy.FlushOnError = true;
+
+			aether_cpplogger::Logger::init(testLogPath, false, aether_cpplogger::LogSeverity::ERROR, 1048576);
+			aether_cpplogger::Logger::setFlushPolicy(flushPolicy);
+
+			//The INFO log stays in the buffer until the ERROR log triggers the flush
+			LoggerMock::writeLogToFileTest(testMessage, testDateTime, aether_cpplogger::LogSeverity::INFO);
+			Assert::AreEqual(std::uintmax_t(0), std::filesystem::file_size(testLogPath + "/" + testLogFilename), L"The INFO log should be buffered");
+
+			LoggerMock::writeLogToFileTest(testMessage, testDateTime, aether_cpplogger::LogSeverity::ERROR);
+			Assert::AreNotEqual(std::uintmax_t(0), std::filesystem::file_size(testLogPath + "/" + testLogFilename), L"The ERROR log should flush the buffer");
+
+			std::ifstream inLogFile;
+			inLogFile.open(testLogPath + "/" + testLogFilename);
+			std::string fileContent;
+			fileContent.assign((std::istreambuf_iterator<char>(inLogFile)),
+				std::istreambuf_iterator<char>());
+			inLogFile.close();
+
+			const std::string expectedMessage = testMessage + "\n" + testMessage + "\n";
+			Assert::AreEqual(expectedMessage, fileContent, L"The file content is incorrect");
+
+			aether_cpplogger::Logger::setFlushPolicy(aether_cpplogger::FlushPolicy());
+			aether_cpplogger::Logger::shutdown();
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(WriteLogToFileFlushIntervalTest)
+		{
+			if (std::filesystem::exists(testLogPath))
+			{
+				std::filesystem::remove_all(testLogPath);
+			}
+
+			aether_cpplogger::FlushPolicy flushPolicy;
+			flushPolicy.BufferSize = SIZE_MAX;
+			flushPolicy.Interval = std::chrono::milliseconds(50);
+
+			aether_cpplogger::Logger::init(testLogPath, false, aether_cpplogger::LogSeverity::ERROR, 1048576);
+			aether_cpplogger::Logger::setFlushPolicy(flushPolicy);
+
+			//No further log comes in sync mode, the background thread writes the buffered line after the interval
+			LoggerMock::writeLogToFileTest(testMessage, testDateTime, aether_cpplogger::LogSeverity::INFO);
+			Assert::AreEqual(std::uintmax_t(0), std::filesystem::file_size(testLogPath + "/" + testLogFilename), L"The INFO log should be buffered");
+
+			const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+			while (std::filesystem::file_size(testLogPath + "/" + testLogFilename) == 0 && std::chrono::steady_clock::now() < deadline)
+			{
+				std::this_thread::sleep_for(std::chrono::milliseconds(10));
+			}
+			Assert::AreEqual(std::uintmax_t(testMessage.size() + aether_cpplogger::LINE_ENDING.size()), std::filesystem::file_size(testLogPath + "/" + testLogFilename), L"The interval should flush a quiet logger");
+
+			aether_cpplogger::Logger::setFlushPolicy(aether_cpplogger::FlushPolicy());
+			aether_cpplogger::Logger::shutdown();
 			std::filesystem::remove_all(testLogPath);
 		}
 
@@ -369,5 +859,395 @@ namespace aether_cpplogger_tests
 			Assert::AreNotEqual(testMessage.c_str(), receiverMock2->testMessage().c_str(), "The message of the receiver is incorrect");
 			Assert::AreNotEqual(testMessage.c_str(), receiverMock3->testMessage().c_str(), "The message of the receiver is incorrect");
 		}
+
+		TEST_METHOD(RemoveMissingReceiverTest)
+		{
+			ReceiverMock attachedReceiver;
+			ReceiverMock missingReceiver;
+
+			aether_cpplogger::Logger::addReceiver(&attachedReceiver);
+			aether_cpplogger::Logger::removeReceiver(&missingReceiver);
+
+			LoggerMock::notifyReceiversTest(testMessage);
+			Assert::AreEqual(testMessage.c_str(), attachedReceiver.testMessage().c_str(), "Removing a missing receiver should not affect the attached ones");
+
+			aether_cpplogger::Logger::clearReceivers();
+		}
+
+		TEST_METHOD(ConcurrentReceiverRemovalTest)
+		{
+			std::atomic<bool> isRunning{ true };
+			std::vector<std::thread> threads;
+			for (int i = 0; i < 4; ++i)
+			{
+				threads.emplace_back([&isRunning, this]()
+					{
+						while (isRunning.load())
+						{
+							LoggerMock::notifyReceiversTest(testMessage);
+						}
+					});
+			}
+
+			for (int i = 0; i < 200; ++i)
+			{
+				auto receiverMock = std::make_unique<CountingReceiverMock>();
+				aether_cpplogger::Logger::addReceiver(receiverMock.get());
+				while (receiverMock->receivedCount() == 0)
+				{
+					std::this_thread::yield();
+				}
+
+				aether_cpplogger::Logger::removeReceiver(receiverMock.get());
+				Assert::AreEqual(0, receiverMock->activeCount(), L"The removal should wait for the running notifications of the receiver");
+
+				const int receivedCount = receiverMock->receivedCount();
+				std::this_thread::yield();
+				Assert::AreEqual(receivedCount, receiverMock->receivedCount(), L"A removed receiver should not be notified");
+			}
+
+			isRunning.store(false);
+			for (auto& thread : threads)
+			{
+				thread.join();
+			}
+		}
+
+		TEST_METHOD(AsyncLogFlushTest)
+		{
+			if (std::filesystem::exists(testLogPath))
+			{
+				std::filesystem::remove_all(testLogPath);
+			}
+
+			aether_cpplogger::Logger::init(testLogPath, false, aether_cpplogger::LogSeverity::INFO, 1048576);
+			aether_cpplogger::Logger::enableAsync();
+
+			const int logCount = 100;
+			for (int i = 0; i < logCount; ++i)
+			{
+				aether_cpplogger::Logger::logInfo(testMessage);
+			}
+			aether_cpplogger::Logger::flush();
+
+			int lineCount = 0;
+			for (const auto& entry : std::filesystem::directory_iterator(testLogPath))
+			{
+				std::ifstream inLogFile(entry.path());
+				std::string line;
+				while (std::getline(inLogFile, line))
+				{
+					lineCount += 1;
+				}
+			}
+			Assert::AreEqual(logCount, lineCount, L"Every queued log should be written after flush");
+
+			aether_cpplogger::Logger::shutdown();
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(AsyncDropNewestTest)
+		{
+			BlockingReceiverMock receiverMock;
+
+			aether_cpplogger::Logger::init(testLogPath, false, aether_cpplogger::LogSeverity::INFO, 1048576);
+			aether_cpplogger::Logger::enableAsync(4, aether_cpplogger::OverflowPolicy::DROP_NEWEST);
+			aether_cpplogger::Logger::addReceiver(&receiverMock);
+
+			//The writer thread is blocked by the receiver while handling the first log
+			aether_cpplogger::Logger::logInfo(testMessage);
+			receiverMock.waitForFirstMessage();
+
+			//The first log keeps its slot while it is processed, so the next 3 logs fill the queue and the last 4 are dropped
+			for (int i = 0; i < 7; ++i)
+			{
+				aether_cpplogger::Logger::logInfo(testMessage);
+			}
+			const auto droppedRecords = aether_cpplogger::Logger::droppedRecords();
+
+			receiverMock.release();
+			aether_cpplogger::Logger::flush();
+			Assert::AreEqual(std::uint64_t(4), droppedRecords, L"Logs over the queue capacity should be dropped");
+			Assert::AreEqual(4, receiverMock.receivedCount(), L"Every accepted log should reach the receiver");
+
+			aether_cpplogger::Logger::shutdown();
+			aether_cpplogger::Logger::clearReceivers();
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(PerThreadQueueMergeTest)
+		{
+			BlockingReceiverMock receiverMock;
+
+			aether_cpplogger::Logger::init(testLogPath, false, aether_cpplogger::LogSeverity::INFO, 1048576);
+			aether_cpplogger::Logger::enableAsync(16, aether_cpplogger::OverflowPolicy::BLOCK, aether_cpplogger::AsyncQueueMode::PER_THREAD);
+			aether_cpplogger::Logger::addReceiver(&receiverMock);
+
+			//The writer thread is blocked by the receiver while the threads fill their queues
+			aether_cpplogger::Logger::logInfo("first");
+			receiverMock.waitForFirstMessage();
+
+			//The logs alternate between the main thread and short-lived threads, each queue alone holds only a part of the sequence
+			std::thread([]() { aether_cpplogger::Logger::logInfo("1"); }).join();
+			aether_cpplogger::Logger::logInfo("2");
+			std::thread([]() { aether_cpplogger::Logger::logInfo("3"); }).join();
+			aether_cpplogger::Logger::logInfo("4");
+
+			receiverMock.release();
+			aether_cpplogger::Logger::flush();
+
+			const std::vector<std::string> expectedMessages = { "first", "1", "2", "3", "4" };
+			const auto& messages = receiverMock.messages();
+			Assert::AreEqual(expectedMessages.size(), messages.size(), L"Every log should reach the receiver");
+			for (std::size_t i = 0; i < expectedMessages.size(); ++i)
+			{
+				Assert::AreEqual(expectedMessages[i], messages[i], L"The logs of the queues should be merged in time order");
+			}
+
+			//The queues of the exited threads are removed after they are written
+			Assert::AreEqual(std::size_t(1), aether_cpplogger::Logger::droppedRecordsPerThread().size(), L"Only the queue of the main thread should be left");
+
+			aether_cpplogger::Logger::shutdown();
+			aether_cpplogger::Logger::clearReceivers();
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(PerThreadDropCountTest)
+		{
+			BlockingReceiverMock receiverMock;
+
+			aether_cpplogger::Logger::init(testLogPath, false, aether_cpplogger::LogSeverity::INFO, 1048576);
+			aether_cpplogger::Logger::enableAsync(4, aether_cpplogger::OverflowPolicy::DROP_NEWEST, aether_cpplogger::AsyncQueueMode::PER_THREAD);
+			aether_cpplogger::Logger::addReceiver(&receiverMock);
+
+			aether_cpplogger::Logger::logInfo(testMessage);
+			receiverMock.waitForFirstMessage();
+
+			//Only the queue of the busy thread overflows
+			std::thread::id busyThreadId;
+			std::thread([&busyThreadId, this]()
+				{
+					busyThreadId = std::this_thread::get_id();
+					for (int i = 0; i < 10; ++i)
+					{
+						aether_cpplogger::Logger::logInfo(testMessage);
+					}
+				}).join();
+			aether_cpplogger::Logger::logInfo(testMessage);
+
+			//The queue of the exited thread is kept until the writer thread drains it
+			const auto& dropCounts = aether_cpplogger::Logger::droppedRecordsPerThread();
+			const auto& droppedRecords = aether_cpplogger::Logger::droppedRecords();
+			receiverMock.release();
+			aether_cpplogger::Logger::flush();
+
+			Assert::AreEqual(std::size_t(2), dropCounts.size(), L"Every logging thread should have a queue");
+			for (const auto& dropCount : dropCounts)
+			{
+				const std::uint64_t expectedDroppedRecords = dropCount.ThreadId == busyThreadId ? 6 : 0;
+				Assert::AreEqual(expectedDroppedRecords, dropCount.DroppedRecords, L"The logs over the capacity of the thread's queue should be dropped");
+			}
+			Assert::AreEqual(std::uint64_t(6), droppedRecords, L"The total should include every thread");
+			Assert::AreEqual(std::uint64_t(6), aether_cpplogger::Logger::droppedRecords(), L"The removed queues should still be counted");
+			Assert::AreEqual(1 + 4 + 1, receiverMock.receivedCount(), L"Every accepted log should reach the receiver");
+
+			aether_cpplogger::Logger::shutdown();
+			aether_cpplogger::Logger::clearReceivers();
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(PerThreadDropOldestTest)
+		{
+			BlockingReceiverMock receiverMock;
+
+			aether_cpplogger::Logger::init(testLogPath, false, aether_cpplogger::LogSeverity::INFO, 1048576);
+			aether_cpplogger::Logger::enableAsync(4, aether_cpplogger::OverflowPolicy::DROP_OLDEST, aether_cpplogger::AsyncQueueMode::PER_THREAD);
+			aether_cpplogger::Logger::addReceiver(&receiverMock);
+
+			aether_cpplogger::Logger::logInfo("first");
+			receiverMock.waitForFirstMessage();
+
+			//The busy thread discards its own oldest logs while the writer thread is blocked
+			std::thread([]()
+				{
+					for (int i = 0; i < 10; ++i)
+					{
+						aether_cpplogger::Logger::logInfo(std::to_string(i));
+					}
+				}).join();
+
+			receiverMock.release();
+			aether_cpplogger::Logger::flush();
+
+			const std::vector<std::string> expectedMessages = { "first", "6", "7", "8", "9" };
+			const auto& messages = receiverMock.messages();
+			Assert::AreEqual(expectedMessages.size(), messages.size(), L"Only the newest logs should be kept");
+			for (std::size_t i = 0; i < expectedMessages.size(); ++i)
+			{
+				Assert::AreEqual(expectedMessages[i], messages[i], L"The oldest logs should be discarded");
+			}
+			Assert::AreEqual(std::uint64_t(6), aether_cpplogger::Logger::droppedRecords(), L"The discarded logs should be counted");
+
+			aether_cpplogger::Logger::shutdown();
+			aether_cpplogger::Logger::clearReceivers();
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(RecordReceiverTest)
+		{
+			RecordReceiverMock receiverMock;
+
+			aether_cpplogger::Logger::init(testLogPath, false, aether_cpplogger::LogSeverity::TRACE, 1048576);
+			aether_cpplogger::Logger::addReceiver(&receiverMock);
+
+			const auto timestamp = aether_cpplogger::Clock::now();
+			aether_cpplogger::Logger::logWarning(testMessage);
+			AETHER_LOG_DEBUG("value {}", 42); const int debugLine = __LINE__;
+
+			//In sync mode every log is a batch of its own
+			const auto& records = receiverMock.records();
+			Assert::AreEqual(std::size_t(2), records.size(), L"Every log should reach the receiver");
+			Assert::IsTrue(receiverMock.batchSizes() == std::vector<std::size_t>{ 1, 1 }, L"Every log should be a batch of its own in sync mode");
+			Assert::IsTrue(records[0].Severity == aether_cpplogger::LogSeverity::WARNING, L"The severity should be passed");
+			Assert::IsTrue(records[0].Timestamp >= timestamp, L"The creation time should be passed");
+			Assert::IsTrue(records[0].ThreadId == std::this_thread::get_id(), L"The logging thread should be passed");
+			Assert::IsTrue(records[0].Source.empty(), L"A log without source details should have no source");
+			Assert::AreEqual(testMessage, records[0].Message, L"The message should be passed");
+			Assert::IsTrue(records[1].Severity == aether_cpplogger::LogSeverity::DEBUG, L"The severity should be passed");
+			Assert::IsTrue(std::filesystem::path(records[1].Source).filename() == "LoggerTest.cpp", L"The source file should be passed");
+			Assert::AreEqual(debugLine, records[1].Line, L"The source line should be passed");
+
+			aether_cpplogger::Logger::shutdown();
+			aether_cpplogger::Logger::clearReceivers();
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(BatchReceiverTest)
+		{
+			BlockingReceiverMock blockingReceiverMock;
+			RecordReceiverMock recordReceiverMock;
+
+			aether_cpplogger::Logger::init(testLogPath, false, aether_cpplogger::LogSeverity::INFO, 1048576);
+			aether_cpplogger::Logger::enableAsync();
+			aether_cpplogger::Logger::addReceiver(&blockingReceiverMock);
+			aether_cpplogger::Logger::addReceiver(&recordReceiverMock);
+
+			//The writer thread is blocked by the receiver while the next logs are queued
+			aether_cpplogger::Logger::logInfo("first");
+			blockingReceiverMock.waitForFirstMessage();
+
+			std::thread([]() { aether_cpplogger::Logger::logInfo("other thread"); }).join();
+			for (int i = 0; i < 4; ++i)
+			{
+				aether_cpplogger::Logger::logInfo(testMessage);
+			}
+
+			blockingReceiverMock.release();
+			aether_cpplogger::Logger::flush();
+
+			//The logs drained together reach the receiver in a single call
+			Assert::IsTrue(recordReceiverMock.batchSizes() == std::vector<std::size_t>{ 1, 5 }, L"The queued logs should be passed as one batch");
+			const auto& records = recordReceiverMock.records();
+			Assert::AreEqual(std::size_t(6), records.size(), L"Every log should reach the receiver");
+			Assert::IsTrue(records[1].ThreadId != std::this_thread::get_id(), L"The thread which made the log should be passed, not the writer thread");
+			Assert::IsTrue(records[2].ThreadId == std::this_thread::get_id(), L"The thread which made the log should be passed, not the writer thread");
+			Assert::AreEqual(6, blockingReceiverMock.receivedCount(), L"The single message receiver should get every log");
+
+			aether_cpplogger::Logger::shutdown();
+			aether_cpplogger::Logger::clearReceivers();
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(PlaceholderCountTest)
+		{
+			static_assert(aether_cpplogger::countPlaceholders("user {} took {}us") == 2);
+			static_assert(aether_cpplogger::countPlaceholders("no placeholder") == 0);
+			static_assert(aether_cpplogger::countPlaceholders("{{escaped}} {}") == 1);
+			static_assert(aether_cpplogger::countPlaceholders("unmatched {") == -1);
+			static_assert(aether_cpplogger::countPlaceholders("named {id}") == -1);
+			static_assert(decltype(aether_cpplogger::countArguments(1, "two", 3.0))::value == 3);
+		}
+
+		TEST_METHOD(FormatMessageTest)
+		{
+			enum class TestEnum { FIRST, SECOND };
+			const std::string text = "text";
+
+			std::string message = "reused";
+			message.clear();
+			aether_cpplogger::formatMessage(message, "{} {} {} {} {} {} {} {{{}}}",
+				42, -7, 2.5, true, 'c', text, TestEnum::SECOND, std::string_view("view"));
+			Assert::AreEqual(std::string("42 -7 2.5 true c text 1 {view}"), message);
+
+			message.clear();
+			aether_cpplogger::formatMessage(message, "no placeholder");
+			Assert::AreEqual(std::string("no placeholder"), message);
+		}
+
+		TEST_METHOD(FormattedLogTest)
+		{
+			ReceiverMock receiverMock;
+
+			aether_cpplogger::Logger::init(testLogPath, false, aether_cpplogger::LogSeverity::INFO, 1048576);
+			aether_cpplogger::Logger::addReceiver(&receiverMock);
+
+			const int userId = 42;
+			const std::uint64_t duration = 1500;
+			AETHER_LOG_INFO("user {} took {}us", userId, duration);
+			Assert::AreEqual(std::string("user 42 took 1500us"), receiverMock.testMessage(), L"The formatted message should reach the receiver");
+
+			//Single argument logs are not formatted
+			AETHER_LOG_INFO("{} " + testMessage);
+			Assert::AreEqual("{} " + testMessage, receiverMock.testMessage(), L"A single argument should be logged as it is");
+
+			//Logs over the severity limit are not formatted and not forwarded
+			AETHER_LOG_DEBUG("user {}", userId);
+			Assert::AreEqual("{} " + testMessage, receiverMock.testMessage(), L"Logs over the severity limit should be discarded");
+
+			aether_cpplogger::Logger::shutdown();
+			aether_cpplogger::Logger::clearReceivers();
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(ArgumentCodecTest)
+		{
+			using Codec = aether_cpplogger::ArgumentCodec<int, const char*, double, std::string, bool>;
+
+			std::string arguments;
+			{
+				//The encoded arguments must not refer to the original strings
+				const std::string text = "text";
+				Codec::encode(arguments, -7, "literal", 2.5, text, false);
+			}
+
+			std::string message;
+			Codec::decode(message, "{} {} {} {} {}!", arguments.data());
+			Assert::AreEqual(std::string("-7 literal 2.5 text false!"), message);
+		}
+
+		TEST_METHOD(DeferredFormattingTest)
+		{
+			ReceiverMock receiverMock;
+
+			aether_cpplogger::Logger::init(testLogPath, false, aether_cpplogger::LogSeverity::TRACE, 1048576);
+			aether_cpplogger::Logger::enableAsync();
+			aether_cpplogger::Logger::setDeferredFormatting(true);
+			aether_cpplogger::Logger::addReceiver(&receiverMock);
+			Assert::IsTrue(aether_cpplogger::Logger::isDeferredFormatting(), L"Formatting should be deferred in async mode");
+
+			AETHER_LOG_INFO("user {} took {}us", std::string("deferred"), 1500);
+			aether_cpplogger::Logger::flush();
+			Assert::AreEqual(std::string("user deferred took 1500us"), receiverMock.testMessage(), L"The writer thread should format the log");
+
+			AETHER_LOG_DEBUG("value {}", 3);
+			aether_cpplogger::Logger::flush();
+			Assert::IsTrue(receiverMock.testMessage().rfind("value 3\t\tSOURCE: ", 0) == 0, L"Deferred DEBUG logs should contain the source details");
+
+			aether_cpplogger::Logger::shutdown();
+			aether_cpplogger::Logger::setDeferredFormatting(false);
+			aether_cpplogger::Logger::clearReceivers();
+			Assert::IsFalse(aether_cpplogger::Logger::isDeferredFormatting(), L"Formatting should not be deferred in sync mode");
+			std::filesystem::remove_all(testLogPath);
+		}
 	};
-}
+}
\ No newline at end of file
@@ -0,0 +1,208 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "ReceiverMock.h"
+#include "../aether_cpplogger/Logger.h"
+
+#include <chrono>
+#include <filesystem>
+#include <thread>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace aether_cpplogger_tests
+{
+	TEST_CLASS(ReceiverDispatchTest)
+	{
+	private:
+		const std::string testLogPath = "ReceiverDispatchTest";
+
+		TEST_METHOD_INITIALIZE(Setup)
+		{
+			aether_cpplogger::LoggerRegistry::clear();
+			if (std::filesystem::exists(testLogPath))
+			{
+				std::filesystem::remove_all(testLogPath);
+			}
+		}
+
+		TEST_METHOD(SlowReceiverTest)
+		{
+			constexpr int logCount = 20;
+			constexpr auto delay = std::chrono::milliseconds(20);
+			SlowReceiverMock receiverMock(delay);
+
+			aether_cpplogger::ReceiverPolicy receiverPolicy;
+			receiverPolicy.IsIsolated = true;
+
+			const auto& logger = aether_cpplogger::LoggerRegistry::get("dispatch");
+			logger->init(testLogPath, false, aether_cpplogger::LogSeverity::INFO, 1048576);
+			logger->addReceiver(&receiverMock, receiverPolicy);
+
+			//Notified directly, the receiver would keep the logging thread busy for 400ms
+			const auto start = std::chrono::steady_clock::now();
+			for (int i = 0; i < logCount; ++i)
+			{
+				logger->logInfo("slow receiver");
+			}
+			const auto elapsed = std::chrono::steady_clock::now() - start;
+			Assert::IsTrue(elapsed < delay * logCount / 4, L"The slow receiver should not delay the logging thread");
+
+			logger->flush();
+			Assert::AreEqual(logCount, receiverMock.receivedCount(), L"Every log should reach the receiver after the flush");
+
+			const auto& stats = logger->receiverStats(&receiverMock);
+			Assert::AreEqual(std::uint64_t(logCount), stats.ReceivedRecords, L"Every log should be queued");
+			Assert::AreEqual(std::uint64_t(logCount), stats.DeliveredRecords, L"Every log should be delivered");
+			Assert::AreEqual(std::uint64_t(0), stats.DroppedRecords, L"No log should be dropped");
+			Assert::AreEqual(std::uint64_t(0), stats.QueuedRecords, L"No log should be left in the queue");
+			Assert::IsTrue(stats.ReceiveTime >= delay * logCount, L"The time spent in the receiver should be counted");
+			Assert::IsTrue(stats.MaxReceiveTime >= delay, L"The longest notification should be counted");
+			Assert::IsTrue(stats.MaxLag >= stats.Lag, L"The largest lag should be kept");
+
+			logger->shutdown();
+			logger->clearReceivers();
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(DirectReceiverStatsTest)
+		{
+			BlockingReceiverMock receiverMock;
+			receiverMock.release();
+
+			const auto& logger = aether_cpplogger::LoggerRegistry::get("dispatch");
+			logger->init(testLogPath, false, aether_cpplogger::LogSeverity::INFO, 1048576);
+			logger->addReceiver(&receiverMock);
+
+			logger->logInfo("direct receiver");
+			Assert::AreEqual(1, receiverMock.receivedCount(), L"The receiver should be notified during the log");
+			Assert::AreEqual(std::uint64_t(0), logger->receiverStats(&receiverMock).ReceivedRecords, L"A receiver which is not isolated should have no counters");
+
+			logger->shutdown();
+			logger->clearReceivers();
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(DropNewestTest)
+		{
+			BlockingReceiverMock receiverMock;
+
+			aether_cpplogger::ReceiverPolicy receiverPolicy;
+			receiverPolicy.IsIsolated = true;
+			receiverPolicy.Capacity = 4;
+			receiverPolicy.Overflow = aether_cpplogger::OverflowPolicy::DROP_NEWEST;
+
+			const auto& logger = aether_cpplogger::LoggerRegistry::get("dispatch");
+			logger->init(testLogPath, false, aether_cpplogger::LogSeverity::INFO, 1048576);
+			logger->addReceiver(&receiverMock, receiverPolicy);
+
+			//The receiver blocks its dispatcher thread while the logging thread fills the queue
+			logger->logInfo("first");
+			receiverMock.waitForFirstMessage();
+			for (int i = 0; i < 10; ++i)
+			{
+				logger->logInfo(std::to_string(i));
+			}
+
+			auto stats = logger->receiverStats(&receiverMock);
+			Assert::AreEqual(std::uint64_t(6), stats.DroppedRecords, L"The logs over the capacity should be dropped");
+			Assert::AreEqual(std::uint64_t(5), stats.QueuedRecords, L"The queue should be full besides the log in the receiver");
+
+			receiverMock.release();
+			logger->flush();
+
+			const std::vector<std::string> expectedMessages = { "first", "0", "1", "2", "3" };
+			Assert::IsTrue(receiverMock.messages() == expectedMessages, L"The oldest logs should be kept");
+			stats = logger->receiverStats(&receiverMock);
+			Assert::AreEqual(std::uint64_t(5), stats.DeliveredRecords, L"The kept logs should be delivered");
+
+			logger->shutdown();
+			logger->clearReceivers();
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(DropOldestTest)
+		{
+			BlockingReceiverMock receiverMock;
+
+			aether_cpplogger::ReceiverPolicy receiverPolicy;
+			receiverPolicy.IsIsolated = true;
+			receiverPolicy.Capacity = 4;
+			receiverPolicy.Overflow = aether_cpplogger::OverflowPolicy::DROP_OLDEST;
+
+			const auto& logger = aether_cpplogger::LoggerRegistry::get("dispatch");
+			logger->init(testLogPath, false, aether_cpplogger::LogSeverity::INFO, 1048576);
+			logger->addReceiver(&receiverMock, receiverPolicy);
+
+			logger->logInfo("first");
+			receiverMock.waitForFirstMessage();
+			for (int i = 0; i < 10; ++i)
+			{
+				logger->logInfo(std::to_string(i));
+			}
+			receiverMock.release();
+
+			//The removal hands the queued logs to the receiver before it returns
+			logger->removeReceiver(&receiverMock);
+
+			const std::vector<std::string> expectedMessages = { "first", "6", "7", "8", "9" };
+			Assert::IsTrue(receiverMock.messages() == expectedMessages, L"The newest logs should be kept");
+
+			logger->shutdown();
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(AsyncWriterIsolationTest)
+		{
+			BlockingReceiverMock blockingReceiverMock;
+			RecordReceiverMock recordReceiverMock;
+
+			aether_cpplogger::ReceiverPolicy receiverPolicy;
+			receiverPolicy.IsIsolated = true;
+
+			const auto& logger = aether_cpplogger::LoggerRegistry::get("dispatch");
+			logger->init(testLogPath, false, aether_cpplogger::LogSeverity::INFO, 1048576);
+			logger->enableAsync();
+			logger->addReceiver(&blockingReceiverMock, receiverPolicy);
+			logger->addReceiver(&recordReceiverMock);
+
+			//The blocked isolated receiver does not stop the writer thread from notifying the other receiver
+			logger->logInfo("first");
+			blockingReceiverMock.waitForFirstMessage();
+			logger->logInfo("second");
+			for (int i = 0; i < 1000 && recordReceiverMock.records().size() < 2; ++i)
+			{
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			}
+			Assert::AreEqual(std::size_t(2), recordReceiverMock.records().size(), L"The writer thread should not wait for the isolated receiver");
+			Assert::AreEqual(1, blockingReceiverMock.receivedCount(), L"The isolated receiver should still be blocked");
+
+			blockingReceiverMock.release();
+			logger->flush();
+			Assert::AreEqual(2, blockingReceiverMock.receivedCount(), L"The isolated receiver should get every log after the flush");
+
+			logger->shutdown();
+			logger->clearReceivers();
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(LoggingOnWriterThreadTest)
+		{
+			const auto& logger = aether_cpplogger::LoggerRegistry::get("dispatch");
+			logger->init(testLogPath, false, aether_cpplogger::LogSeverity::INFO, 1048576);
+			logger->enableAsync(4, aether_cpplogger::OverflowPolicy::BLOCK);
+
+			//The receiver overfills the queue and flushes on the writer thread, neither may wait for the writer thread itself
+			LoggingReceiverMock loggingReceiverMock(*logger, 16);
+			logger->addReceiver(&loggingReceiverMock);
+			logger->logInfo("trigger");
+			logger->flush();
+			Assert::IsTrue(loggingReceiverMock.isDone(), L"The receiver should finish logging on the writer thread");
+			Assert::IsTrue(logger->droppedRecords() > 0, L"The logs of the writer thread which do not fit should be dropped");
+
+			logger->shutdown();
+			logger->clearReceivers();
+			std::filesystem::remove_all(testLogPath);
+		}
+	};
+}
\ No newline at end of file
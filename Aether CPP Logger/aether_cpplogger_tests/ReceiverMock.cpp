@@ -1,6 +1,8 @@
 #include "pch.h"
 #include "ReceiverMock.h"
 
+#include <thread>
+
 namespace aether_cpplogger_tests
 {
 	void ReceiverMock::onReceive(std::string_view message)
@@ -11,4 +13,141 @@ namespace aether_cpplogger_tests
 	{
 		return m_testMessage;
 	}
+
+	void BlockingReceiverMock::onReceive(std::string_view message)
+	{
+		std::unique_lock lock(m_mutex);
+		m_receivedCount += 1;
+		m_messages.emplace_back(message);
+		m_condition.notify_all();
+		m_condition.wait(lock, [this]() { return m_isReleased; });
+	}
+	void BlockingReceiverMock::waitForFirstMessage()
+	{
+		std::unique_lock lock(m_mutex);
+		m_condition.wait(lock, [this]() { return m_receivedCount > 0; });
+	}
+	void BlockingReceiverMock::release()
+	{
+		std::lock_guard lock(m_mutex);
+		m_isReleased = true;
+		m_condition.notify_all();
+	}
+	int BlockingReceiverMock::receivedCount()
+	{
+		std::lock_guard lock(m_mutex);
+		return m_receivedCount;
+	}
+	std::vector<std::string> BlockingReceiverMock::messages()
+	{
+		std::lock_guard lock(m_mutex);
+		return m_messages;
+	}
+
+	void CountingReceiverMock::onReceive(std::string_view)
+	{
+		m_activeCount.fetch_add(1);
+		m_receivedCount.fetch_add(1);
+		//Keep the notification running for a while so the removal has something to wait for
+		std::this_thread::yield();
+		m_activeCount.fetch_sub(1);
+	}
+	int CountingReceiverMock::activeCount() const
+	{
+		return m_activeCount.load();
+	}
+	int CountingReceiverMock::receivedCount() const
+	{
+		return m_receivedCount.load();
+	}
+
+	SlowReceiverMock::SlowReceiverMock(const std::chrono::milliseconds delay) :
+		m_delay(delay)
+	{
+	}
+	void SlowReceiverMock::onReceive(std::string_view)
+	{
+		//Stands for a receiver which sends every log over the network
+		std::this_thread::sleep_for(m_delay);
+		m_receivedCount.fetch_add(1);
+	}
+	int SlowReceiverMock::receivedCount() const
+	{
+		return m_receivedCount.load();
+	}
+
+	void RecordReceiverMock::onReceiveBatch(const aether_cpplogger::RecordView* records, const std::size_t count)
+	{
+		std::lock_guard lock(m_mutex);
+		m_batchSizes.push_back(count);
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			const auto& record = records[i];
+			m_records.push_back({ record.Severity, record.Timestamp, record.ThreadId, std::string(record.Source), record.Line, std::string(record.Message) });
+		}
+	}
+	std::vector<RecordReceiverMock::ReceivedRecord> RecordReceiverMock::records()
+	{
+		std::lock_guard lock(m_mutex);
+		return m_records;
+	}
+	std::vector<std::size_t> RecordReceiverMock::batchSizes()
+	{
+		std::lock_guard lock(m_mutex);
+		return m_batchSizes;
+	}
+
+	LoggingReceiverMock::LoggingReceiverMock(aether_cpplogger::LoggerInstance& logger, const int logCount) :
+		m_logger(logger),
+		m_logCount(logCount)
+	{
+	}
+	void LoggingReceiverMock::onReceive(std::string_view message)
+	{
+		//Only the trigger logs, the logs of the receiver are notified too
+		if (message != "trigger")
+		{
+			return;
+		}
+
+		for (int i = 0; i < m_logCount; ++i)
+		{
+			m_logger.logInfo("logged by the receiver");
+		}
+		m_logger.flush();
+		m_isDone.store(true);
+	}
+	bool LoggingReceiverMock::isDone() const
+	{
+		return m_isDone.load();
+	}
+
+	void StatsReceiverMock::onReceiveStats(const aether_cpplogger::LoggerStats& stats)
+	{
+		std::lock_guard lock(m_mutex);
+		m_reportCount += 1;
+		m_lastStats = stats;
+		m_lastThreadId = std::this_thread::get_id();
+		m_condition.notify_all();
+	}
+	bool StatsReceiverMock::waitForReports(const int reportCount, const std::chrono::milliseconds timeout)
+	{
+		std::unique_lock lock(m_mutex);
+		return m_condition.wait_for(lock, timeout, [this, reportCount]() { return m_reportCount >= reportCount; });
+	}
+	int StatsReceiverMock::reportCount()
+	{
+		std::lock_guard lock(m_mutex);
+		return m_reportCount;
+	}
+	aether_cpplogger::LoggerStats StatsReceiverMock::lastStats()
+	{
+		std::lock_guard lock(m_mutex);
+		return m_lastStats;
+	}
+	std::thread::id StatsReceiverMock::lastThreadId()
+	{
+		std::lock_guard lock(m_mutex);
+		return m_lastThreadId;
+	}
 }
\ No newline at end of file
@@ -1,5 +1,14 @@
 #pragma once
-#include "..\aether_cpplogger\Receiver.h"
+#include "../aether_cpplogger/LoggerInstance.h"
+#include "../aether_cpplogger/Receiver.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
 
 namespace aether_cpplogger_tests
 {
@@ -13,4 +22,107 @@ namespace aether_cpplogger_tests
 
 		const std::string& testMessage() const;
 	};
+
+	class BlockingReceiverMock : public aether_cpplogger::Receiver
+	{
+	private:
+		std::mutex m_mutex;
+		std::condition_variable m_condition;
+		bool m_isReleased = false;
+		int m_receivedCount = 0;
+		std::vector<std::string> m_messages;
+
+	public:
+		void onReceive(std::string_view message) override;
+
+		void waitForFirstMessage();
+		void release();
+		int receivedCount();
+		std::vector<std::string> messages();
+	};
+
+	class CountingReceiverMock : public aether_cpplogger::Receiver
+	{
+	private:
+		std::atomic<int> m_activeCount{ 0 };
+		std::atomic<int> m_receivedCount{ 0 };
+
+	public:
+		void onReceive(std::string_view message) override;
+
+		int activeCount() const;
+		int receivedCount() const;
+	};
+
+	class SlowReceiverMock : public aether_cpplogger::Receiver
+	{
+	private:
+		const std::chrono::milliseconds m_delay;
+		std::atomic<int> m_receivedCount{ 0 };
+
+	public:
+		explicit SlowReceiverMock(const std::chrono::milliseconds delay);
+
+		void onReceive(std::string_view message) override;
+
+		int receivedCount() const;
+	};
+
+	class RecordReceiverMock : public aether_cpplogger::Receiver
+	{
+	public:
+		struct ReceivedRecord
+		{
+			aether_cpplogger::LogSeverity Severity;
+			std::int64_t Timestamp;
+			std::thread::id ThreadId;
+			std::string Source;
+			int Line;
+			std::string Message;
+		};
+
+	private:
+		std::mutex m_mutex;
+		std::vector<ReceivedRecord> m_records;
+		std::vector<std::size_t> m_batchSizes;
+
+	public:
+		void onReceiveBatch(const aether_cpplogger::RecordView* records, const std::size_t count) override;
+
+		std::vector<ReceivedRecord> records();
+		std::vector<std::size_t> batchSizes();
+	};
+
+	class LoggingReceiverMock : public aether_cpplogger::Receiver
+	{
+	private:
+		aether_cpplogger::LoggerInstance& m_logger;
+		const int m_logCount;
+		std::atomic<bool> m_isDone{ false };
+
+	public:
+		LoggingReceiverMock(aether_cpplogger::LoggerInstance& logger, const int logCount);
+
+		void onReceive(std::string_view message) override;
+
+		bool isDone() const;
+	};
+
+	class StatsReceiverMock : public aether_cpplogger::Receiver
+	{
+	private:
+		std::mutex m_mutex;
+		std::condition_variable m_condition;
+		int m_reportCount = 0;
+		aether_cpplogger::LoggerStats m_lastStats;
+		std::thread::id m_lastThreadId;
+
+	public:
+		void onReceiveStats(const aether_cpplogger::LoggerStats& stats) override;
+
+		bool waitForReports(const int reportCount, const std::chrono::milliseconds timeout);
+		int reportCount();
+		aether_cpplogger::LoggerStats lastStats();
+		std::thread::id lastThreadId();
+	};
 }
\ No newline at end of file
@@ -0,0 +1,126 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+
+#include "../aether_cpplogger/Logger.h"
+
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace aether_cpplogger_tests
+{
+	TEST_CLASS(StructuredLogTest)
+	{
+	private:
+		const std::string testLogPath = "StructuredLogTest";
+
+		/**
+		 * @brief Returns the lines of every log file of the test folder
+		*/
+		std::vector<std::string> readLogLines() const
+		{
+			std::vector<std::string> lines;
+			for (const auto& entry : std::filesystem::directory_iterator(testLogPath))
+			{
+				std::ifstream inLogFile(entry.path());
+				std::string line;
+				while (std::getline(inLogFile, line))
+				{
+					lines.push_back(line);
+				}
+			}
+
+			return lines;
+		}
+
+		/**
+		 * @brief Returns the part of the line after the time
+		*/
+		static std::string afterTime(const std::string& line, const std::string& timeEnd)
+		{
+			const auto position = line.find(timeEnd);
+			return position == std::string::npos ? std::string() : line.substr(position + timeEnd.size());
+		}
+
+		TEST_METHOD_INITIALIZE(Setup)
+		{
+			aether_cpplogger::LoggerRegistry::clear();
+			if (std::filesystem::exists(testLogPath))
+			{
+				std::filesystem::remove_all(testLogPath);
+			}
+		}
+
+		TEST_METHOD(JsonLineFormatTest)
+		{
+			const auto& logger = aether_cpplogger::LoggerRegistry::get("structured");
+			logger->init(testLogPath, false, aether_cpplogger::LogSeverity::TRACE, 1048576);
+			logger->setLineFormat(aether_cpplogger::LogLineFormat::JSON);
+
+			AETHER_LOG_INFO_FIELDS_TO(*logger, "request \"handled\"\n", { "user_id", 42 }, { "latency_us", 1.5 }, { "ok", true }, { "path", std::string("C:\\logs\\a b") });
+			AETHER_LOG_DEBUG_FIELDS_TO(*logger, "debug", { "count", 7u }); const int debugLine = __LINE__;
+			logger->logWarning("plain\tmessage with a longer text\x01");
+			logger->shutdown();
+
+			const auto& lines = readLogLines();
+			Assert::AreEqual(static_cast<std::size_t>(3), lines.size(), L"Every log should be written as a single line");
+
+			Assert::AreEqual(std::string("{\"time\":\""), lines[0].substr(0, 9), L"The line should start with the time");
+			Assert::AreEqual(std::string("\"severity\":\"INFO\",\"message\":\"request \\\"handled\\\"\\n\",\"user_id\":42,\"latency_us\":1.5,\"ok\":true,\"path\":\"C:\\\\logs\\\\a b\"}"),
+				afterTime(lines[0], "\","));
+
+			//Backslashes of the source path are escaped in JSON
+			std::string source;
+			for (const char character : std::string(__FILE__))
+			{
+				source += character == '\\' ? std::string("\\\\") : std::string(1, character);
+			}
+			Assert::AreEqual(std::string("\"severity\":\"DEBUG\",\"message\":\"debug\",\"count\":7,\"source\":\"") + source + "\",\"line\":" + std::to_string(debugLine) + "}",
+				afterTime(lines[1], "\","), L"The source details should be written as fields");
+
+			Assert::AreEqual(std::string("\"severity\":\"WARNING\",\"message\":\"plain\\tmessage with a longer text\\u0001\"}"), afterTime(lines[2], "\","));
+
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(LogfmtLineFormatTest)
+		{
+			const auto& logger = aether_cpplogger::LoggerRegistry::get("structured");
+			logger->init(testLogPath, false, aether_cpplogger::LogSeverity::ERROR, 1048576);
+			logger->setLineFormat(aether_cpplogger::LogLineFormat::LOGFMT);
+			logger->enableAsync();
+
+			AETHER_LOG_ERROR_FIELDS_TO(*logger, "request failed", { "user id", -3 }, { "reason", "time=out" }, { "empty", "" }, { "code", 'E' });
+			AETHER_LOG_INFO_TO(*logger, "user {} done", 5);
+			AETHER_LOG_DEBUG_FIELDS_TO(*logger, "discarded", { "count", 1 });
+			logger->shutdown();
+
+			const auto& lines = readLogLines();
+			Assert::AreEqual(static_cast<std::size_t>(2), lines.size(), L"Logs over the severity limit should be discarded");
+
+			Assert::AreEqual(std::string("time="), lines[0].substr(0, 5), L"The line should start with the time");
+			Assert::AreEqual(std::string("severity=ERROR message=\"request failed\" user_id=-3 reason=\"time=out\" empty=\"\" code=E"), afterTime(lines[0], " "));
+			Assert::AreEqual(std::string("severity=INFO message=\"user 5 done\""), afterTime(lines[1], " "));
+
+			std::filesystem::remove_all(testLogPath);
+		}
+
+		TEST_METHOD(TextLineFieldsTest)
+		{
+			const auto& logger = aether_cpplogger::LoggerRegistry::get("structured");
+			logger->init(testLogPath, false, aether_cpplogger::LogSeverity::INFO, 1048576);
+
+			logger->logStructured(aether_cpplogger::LogSeverity::INFO, "request handled", { { "user_id", 42 }, { "name", "alice" } });
+			logger->shutdown();
+
+			const auto& lines = readLogLines();
+			Assert::AreEqual(static_cast<std::size_t>(1), lines.size());
+			Assert::AreEqual(std::string("[INFO]\t\t"), lines[0].substr(0, 8), L"The line should start with the severity prefix");
+			Assert::AreEqual(std::string("\t\trequest handled\t\tuser_id=42 name=alice"), lines[0].substr(16), L"The fields should follow the message");
+
+			std::filesystem::remove_all(testLogPath);
+		}
+	};
+}
\ No newline at end of file
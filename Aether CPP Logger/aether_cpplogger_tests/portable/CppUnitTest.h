@@ -0,0 +1,236 @@
+#pragma once
+//Stand-in for the Microsoft C++ unit test framework, so the tests also build and run with CMake outside of Visual Studio.
+//It only provides what the tests use: TEST_CLASS, TEST_METHOD, TEST_METHOD_INITIALIZE and the Assert functions
+#include <cstring>
+#include <functional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace portable_unit_test
+{
+	/**
+	 * @brief Thrown by a failed assertion. The test runner catches it and reports the test as failed
+	*/
+	class AssertFailure : public std::runtime_error
+	{
+	public:
+		explicit AssertFailure(const std::string& message) :
+			std::runtime_error(message)
+		{
+		}
+	};
+
+	/**
+	 * @brief A registered test method
+	*/
+	struct TestMethod
+	{
+		std::string ClassName;
+		std::string MethodName;
+		std::function<void()> Run;
+	};
+
+	/**
+	 * @brief Returns the test methods in the order of their registration
+	*/
+	inline std::vector<TestMethod>& testMethods()
+	{
+		static std::vector<TestMethod> s_testMethods;
+		return s_testMethods;
+	}
+
+	/**
+	 * @brief The base of the test classes. Every test method runs on a new instance after its initialize method
+	 *
+	 * @tparam Name Type holding the name of the test class in its Value member
+	*/
+	template<typename T, typename Name>
+	class TestClass
+	{
+	public:
+		using ThisClass = T;
+
+		virtual ~TestClass() = default;
+
+		static const char* className()
+		{
+			return Name::Value;
+		}
+
+		virtual void initializeMethod()
+		{
+		}
+	};
+
+	/**
+	 * @brief Registers a test method of the given class during the static initialization
+	*/
+	template<typename T>
+	class TestRegistration
+	{
+	public:
+		TestRegistration(const char* className, const char* methodName, void (*method)(T&))
+		{
+			testMethods().push_back({ className, methodName, [method]()
+				{
+					T test;
+					test.initializeMethod();
+					method(test);
+				} });
+		}
+	};
+
+	/**
+	 * @brief Converts the value to a string for the failure message if it can be streamed
+	*/
+	template<typename T>
+	std::string toString(const T& value)
+	{
+		if constexpr (std::is_same_v<T, bool>)
+		{
+			return value ? "true" : "false";
+		}
+		else if constexpr (std::is_enum_v<T>)
+		{
+			return std::to_string(static_cast<std::underlying_type_t<T>>(value));
+		}
+		else if constexpr (std::is_convertible_v<decltype(std::declval<std::ostream&>() << value), std::ostream&>)
+		{
+			std::ostringstream stream;
+			stream << value;
+			return stream.str();
+		}
+		else
+		{
+			return "?";
+		}
+	}
+
+	/**
+	 * @brief Converts the message of an assertion to a narrow string. Only ASCII wide messages are expected
+	*/
+	inline std::string narrowMessage(const wchar_t* message)
+	{
+		std::string result;
+		for (; message && *message; ++message)
+		{
+			result += static_cast<char>(*message < 128 ? *message : '?');
+		}
+		return result;
+	}
+
+	inline std::string narrowMessage(const char* message)
+	{
+		return message ? std::string(message) : std::string();
+	}
+}
+
+namespace Microsoft
+{
+	namespace VisualStudio
+	{
+		namespace CppUnitTestFramework
+		{
+			class Assert
+			{
+			private:
+				template<typename Message>
+				static void fail(const std::string& assertion, const std::string& details, const Message& message)
+				{
+					std::string failure = assertion;
+					if (!details.empty())
+					{
+						failure += " (" + details + ")";
+					}
+
+					const auto& text = portable_unit_test::narrowMessage(message);
+					if (!text.empty())
+					{
+						failure += ": " + text;
+					}
+					throw portable_unit_test::AssertFailure(failure);
+				}
+
+			public:
+				template<typename Expected, typename Actual, typename Message = const wchar_t*>
+				static void AreEqual(const Expected& expected, const Actual& actual, const Message& message = nullptr)
+				{
+					if (!(expected == actual))
+					{
+						fail("AreEqual", "expected <" + portable_unit_test::toString(expected) + "> actual <" + portable_unit_test::toString(actual) + ">", message);
+					}
+				}
+
+				template<typename Message = const wchar_t*>
+				static void AreEqual(const char* expected, const char* actual, const Message& message = nullptr)
+				{
+					if (std::strcmp(expected, actual) != 0)
+					{
+						fail("AreEqual", "expected <" + std::string(expected) + "> actual <" + std::string(actual) + ">", message);
+					}
+				}
+
+				template<typename NotExpected, typename Actual, typename Message = const wchar_t*>
+				static void AreNotEqual(const NotExpected& notExpected, const Actual& actual, const Message& message = nullptr)
+				{
+					if (notExpected == actual)
+					{
+						fail("AreNotEqual", "both <" + portable_unit_test::toString(actual) + ">", message);
+					}
+				}
+
+				template<typename Message = const wchar_t*>
+				static void AreNotEqual(const char* notExpected, const char* actual, const Message& message = nullptr)
+				{
+					if (std::strcmp(notExpected, actual) == 0)
+					{
+						fail("AreNotEqual", "both <" + std::string(actual) + ">", message);
+					}
+				}
+
+				template<typename Message = const wchar_t*>
+				static void IsTrue(const bool condition, const Message& message = nullptr)
+				{
+					if (!condition)
+					{
+						fail("IsTrue", "", message);
+					}
+				}
+
+				template<typename Message = const wchar_t*>
+				static void IsFalse(const bool condition, const Message& message = nullptr)
+				{
+					if (condition)
+					{
+						fail("IsFalse", "", message);
+					}
+				}
+
+				template<typename Message = const wchar_t*>
+				static void Fail(const Message& message = nullptr)
+				{
+					fail("Fail", "", message);
+				}
+			};
+		}
+	}
+}
+
+#define TEST_CLASS(className) \
+	struct className##Name { static constexpr const char* Value = #className; }; \
+	class className : public ::portable_unit_test::TestClass<className, className##Name>
+
+#define TEST_METHOD_INITIALIZE(methodName) \
+	public: \
+	void initializeMethod() override { methodName(); } \
+	void methodName()
+
+#define TEST_METHOD(methodName) \
+	public: \
+	static void methodName##Run(ThisClass& test) { test.methodName(); } \
+	static inline const ::portable_unit_test::TestRegistration<ThisClass> methodName##Registration{ ThisClass::className(), #methodName, &ThisClass::methodName##Run }; \
+	void methodName()
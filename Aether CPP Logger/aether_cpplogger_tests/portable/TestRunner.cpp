@@ -0,0 +1,39 @@
+#include "CppUnitTest.h"
+
+#include <exception>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+int main(int argc, char* argv[])
+{
+	//Run every test or only the ones whose Class::Method name contains the first argument
+	const std::string_view filter = argc > 1 ? argv[1] : "";
+
+	int runCount = 0;
+	int failedCount = 0;
+	for (const auto& testMethod : portable_unit_test::testMethods())
+	{
+		const auto& name = testMethod.ClassName + "::" + testMethod.MethodName;
+		if (!filter.empty() && name.find(filter) == std::string::npos)
+		{
+			continue;
+		}
+
+		++runCount;
+		std::cout << "[ RUN  ] " << name << std::endl;
+		try
+		{
+			testMethod.Run();
+			std::cout << "[ PASS ] " << name << std::endl;
+		}
+		catch (const std::exception& ex)
+		{
+			++failedCount;
+			std::cout << "[ FAIL ] " << name << ": " << ex.what() << std::endl;
+		}
+	}
+
+	std::cout << runCount << " tests run, " << failedCount << " failed" << std::endl;
+	return failedCount == 0 ? 0 : 1;
+}
\ No newline at end of file
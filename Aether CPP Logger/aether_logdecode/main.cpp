@@ -0,0 +1,143 @@
+#include "BinaryLogReader.h"
+#include "LoggerException.h"
+
+#include <charconv>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+namespace
+{
+	/**
+	 * @brief The command line options of the decoder
+	*/
+	struct DecodeOptions
+	{
+		std::string InputPath;
+		std::string OutputPath;
+		bool HasFrom = false;
+		std::int64_t From = 0;
+		aether_cpplogger::TimestampPrecision Precision = aether_cpplogger::TimestampPrecision::SECONDS;
+	};
+
+	void printUsage()
+	{
+		std::fprintf(stderr,
+			"Usage: aether_logdecode <file.logb> [options]\n"
+			"Converts a binary log file into the text layout of the .log files\n"
+			"\n"
+			"  --from <timestamp>     Start at the first log created at or after the timestamp (microseconds since the Unix epoch)\n"
+			"  --precision <digits>   Fractional second digits of the time: seconds, milliseconds or microseconds\n"
+			"  --output <file>        Write the lines to the file instead of the standard output\n");
+	}
+
+	/**
+	 * @brief Parses the command line into the options
+	 *
+	 * @return False if the command line is invalid
+	*/
+	bool parseOptions(int argc, char* argv[], DecodeOptions& options)
+	{
+		for (int i = 1; i < argc; ++i)
+		{
+			const std::string_view argument = argv[i];
+			const bool hasValue = i + 1 < argc;
+
+			if (argument == "--from" && hasValue)
+			{
+				const std::string_view value = argv[++i];
+				const auto result = std::from_chars(value.data(), value.data() + value.size(), options.From);
+				if (result.ec != std::errc() || result.ptr != value.data() + value.size())
+				{
+					return false;
+				}
+				options.HasFrom = true;
+			}
+			else if (argument == "--precision" && hasValue)
+			{
+				const std::string_view value = argv[++i];
+				if (value == "seconds")
+				{
+					options.Precision = aether_cpplogger::TimestampPrecision::SECONDS;
+				}
+				else if (value == "milliseconds")
+				{
+					options.Precision = aether_cpplogger::TimestampPrecision::MILLISECONDS;
+				}
+				else if (value == "microseconds")
+				{
+					options.Precision = aether_cpplogger::TimestampPrecision::MICROSECONDS;
+				}
+				else
+				{
+					return false;
+				}
+			}
+			else if (argument == "--output" && hasValue)
+			{
+				options.OutputPath = argv[++i];
+			}
+			else if (options.InputPath.empty() && argument.substr(0, 2) != "--")
+			{
+				options.InputPath = argument;
+			}
+			else
+			{
+				return false;
+			}
+		}
+
+		return !options.InputPath.empty();
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	DecodeOptions options;
+	if (!parseOptions(argc, argv, options))
+	{
+		printUsage();
+		return 1;
+	}
+
+	std::ofstream outputFile;
+	if (!options.OutputPath.empty())
+	{
+		outputFile.open(options.OutputPath, std::ios::out | std::ios::trunc);
+		if (!outputFile.is_open())
+		{
+			std::fprintf(stderr, "Output file could not be opened: %s\n", options.OutputPath.c_str());
+			return 1;
+		}
+	}
+	std::ostream& output = outputFile.is_open() ? outputFile : std::cout;
+
+	try
+	{
+		aether_cpplogger::BinaryLogReader reader(options.InputPath);
+		if (options.HasFrom)
+		{
+			reader.seek(options.From);
+		}
+
+		aether_cpplogger::BinaryLogEntry entry;
+		std::string line;
+		while (reader.next(entry))
+		{
+			line.clear();
+			reader.formatLine(line, entry, options.Precision);
+			line += '\n';
+			output << line;
+		}
+	}
+	catch (const aether_cpplogger::LoggerException& ex)
+	{
+		std::fprintf(stderr, "%s\n", ex.what());
+		return 1;
+	}
+
+	output.flush();
+	return 0;
+}
\ No newline at end of file